@@ -20,6 +20,7 @@
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/ArraySerialization.hpp>
 #include <Reaktoro/Common/ArrayStream.hpp>
+#include <Reaktoro/Common/BinaryIO.hpp>
 #include <Reaktoro/Common/AutoDiff.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/ConvertUtils.hpp>
@@ -27,6 +28,7 @@
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Common/InterpolationUtils.hpp>
+#include <Reaktoro/Common/LookupIndex.hpp>
 #include <Reaktoro/Common/Macros.hpp>
 #include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Memoization.hpp>
@@ -41,6 +43,8 @@
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Common/Table.hpp>
 #include <Reaktoro/Common/TableUtils.hpp>
+#include <Reaktoro/Common/ThreadLocal.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
 #include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Common/TraitsUtils.hpp>
 #include <Reaktoro/Common/TypeOp.hpp>
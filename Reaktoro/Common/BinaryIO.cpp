@@ -0,0 +1,136 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "BinaryIO.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cstring>
+
+// POSIX includes
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Reaktoro {
+namespace {
+
+/// Return the smallest multiple of 8 that is greater than or equal to a given number of bytes.
+auto padded(Index size) -> Index
+{
+    return (size + 7) / 8 * 8;
+}
+
+} // namespace
+
+BinaryWriter::BinaryWriter(String const& path)
+: path(path), out(path, std::ios::binary | std::ios::trunc)
+{
+    errorif(!out, "Could not open file `", path, "` for writing.");
+}
+
+BinaryWriter::~BinaryWriter()
+{}
+
+auto BinaryWriter::writeBytes(void const* data, Index size) -> void
+{
+    const char zeros[8] = {};
+    out.write(static_cast<char const*>(data), size);
+    out.write(zeros, padded(size) - size);
+    errorif(!out, "Could not write to file `", path, "`.");
+    count += padded(size);
+}
+
+auto BinaryWriter::writeString(String const& str) -> void
+{
+    writeValue(str.size());
+    writeBytes(str.data(), str.size());
+}
+
+auto BinaryWriter::size() const -> Index
+{
+    return count;
+}
+
+BinaryReader::BinaryReader(String const& path)
+: path(path)
+{
+#if !defined(_WIN32)
+    // Try first to memory map the file (pages are mapped at addresses aligned at page boundaries, which are multiples of 8)
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    errorif(fd == -1, "Could not open file `", path, "` for reading.");
+    struct stat st = {};
+    const bool statted = ::fstat(fd, &st) == 0;
+    if(statted && st.st_size > 0)
+    {
+        void* addr = ::mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if(addr != MAP_FAILED)
+        {
+            mapping = addr;
+            bytes = static_cast<char const*>(addr);
+            count = st.st_size;
+        }
+    }
+    ::close(fd);
+    if(mapping || (statted && st.st_size == 0))
+        return;
+#endif
+
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    errorif(!in, "Could not open file `", path, "` for reading.");
+    count = in.tellg();
+    words.resize(padded(count) / 8);
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(words.data()), count);
+    errorif(!in, "Could not read the contents of file `", path, "`.");
+    bytes = reinterpret_cast<char const*>(words.data());
+}
+
+BinaryReader::~BinaryReader()
+{
+#if !defined(_WIN32)
+    if(mapping)
+        ::munmap(mapping, count);
+#endif
+}
+
+auto BinaryReader::readBytes(void* data, Index size) -> void
+{
+    errorif(size > remaining(), "The binary file `", path, "` is truncated or corrupted (expecting ", size, " more bytes but only ", remaining(), " remain).");
+    if(size == 0) return;
+    std::memcpy(data, bytes + offset, size);
+    offset += std::min(padded(size), count - offset);
+}
+
+auto BinaryReader::readString() -> String
+{
+    const auto size = readValue<Index>();
+    errorif(size > remaining(), "The binary file `", path, "` is corrupted (could not read a string with ", size, " characters).");
+    String str(size, '\0');
+    readBytes(str.data(), size);
+    return str;
+}
+
+auto BinaryReader::remaining() const -> Index
+{
+    return count - offset;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,214 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <type_traits>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to write binary files whose entries are aligned at 8-byte boundaries.
+/// Integer values are stored as 64-bit signed integers, `float` values as 32-bit
+/// floats and other floating-point values as 64-bit doubles, all in the byte order
+/// of the machine. Sequences of numbers are stored contiguously. Every entry (a
+/// number, a sequence of numbers, a string or raw bytes) is padded with zeros to
+/// a multiple of 8 bytes. This ensures that every number in the file is properly
+/// aligned when the file is read into (or memory mapped to) an 8-byte aligned buffer.
+/// @see BinaryReader
+class BinaryWriter
+{
+public:
+    /// Construct a BinaryWriter object that writes to a file with given path (overwritten if it exists).
+    explicit BinaryWriter(String const& path);
+
+    /// Destroy this BinaryWriter object (closing its file).
+    ~BinaryWriter();
+
+    /// Write a block of bytes (padded with zeros to a multiple of 8 bytes).
+    auto writeBytes(void const* data, Index size) -> void;
+
+    /// Write an integer or floating-point value.
+    template<typename T>
+    auto writeValue(T const& value) -> void
+    {
+        static_assert(std::is_arithmetic_v<T>, "BinaryWriter::writeValue expects an integer or floating-point value.");
+        const Stored<T> stored = value;
+        writeBytes(&stored, sizeof(stored));
+    }
+
+    /// Write a string (its length followed by its characters).
+    auto writeString(String const& str) -> void;
+
+    /// Write a sequence of integer values, floating-point values or strings (their number followed by the values).
+    template<typename Container>
+    auto writeValues(Container const& values) -> void
+    {
+        using Value = typename Container::value_type;
+        writeValue(values.size());
+        if constexpr(std::is_same_v<Value, String>)
+        {
+            for(auto const& value : values)
+                writeString(value);
+        }
+        else
+        {
+            static_assert(std::is_arithmetic_v<Value>, "BinaryWriter::writeValues expects a sequence of integer values, floating-point values or strings.");
+            const Vec<Stored<Value>> stored(values.begin(), values.end());
+            writeBytes(stored.data(), stored.size() * sizeof(Stored<Value>));
+        }
+    }
+
+    /// Write an Eigen vector, matrix or array (its dimensions followed by its coefficients in column-major order).
+    template<typename Derived>
+    auto writeMatrix(Eigen::DenseBase<Derived> const& mat) -> void
+    {
+        using Scalar = typename Derived::Scalar;
+        const Eigen::Matrix<Stored<Scalar>, -1, -1> stored = mat.template cast<Stored<Scalar>>();
+        writeValue(stored.rows());
+        writeValue(stored.cols());
+        writeBytes(stored.data(), stored.size() * sizeof(Stored<Scalar>));
+    }
+
+    /// Return the number of bytes written so far.
+    auto size() const -> Index;
+
+    /// The type used to store values of type `T` in the binary file.
+    template<typename T>
+    using Stored = std::conditional_t<std::is_integral_v<T>, std::int64_t, std::conditional_t<std::is_same_v<T, float>, float, double>>;
+
+private:
+    /// The path of the file.
+    String path;
+
+    /// The output stream of the file.
+    std::ofstream out;
+
+    /// The number of bytes written so far.
+    Index count = 0;
+};
+
+/// Used to read binary files written by BinaryWriter.
+/// The file is memory mapped read-only where supported (POSIX systems), which avoids
+/// reading it into an intermediate buffer. Otherwise, the file is read into an 8-byte
+/// aligned buffer. In both cases, every value read is copied into the object returned
+/// by the read methods, so the data built from a file is owned by each reader and is
+/// not shared among processes reading the same file.
+/// @see BinaryWriter
+class BinaryReader
+{
+public:
+    /// Construct a BinaryReader object that reads from a file with given path.
+    explicit BinaryReader(String const& path);
+
+    /// Destroy this BinaryReader object (unmapping its file if memory mapped).
+    ~BinaryReader();
+
+    /// Disable copy construction of BinaryReader objects.
+    BinaryReader(BinaryReader const&) = delete;
+
+    /// Disable copy assignment of BinaryReader objects.
+    auto operator=(BinaryReader const&) -> BinaryReader& = delete;
+
+    /// Read a block of bytes (skipping the zeros padded to a multiple of 8 bytes).
+    auto readBytes(void* data, Index size) -> void;
+
+    /// Read an integer or floating-point value.
+    template<typename T>
+    auto readValue() -> T
+    {
+        static_assert(std::is_arithmetic_v<T>, "BinaryReader::readValue expects an integer or floating-point type.");
+        BinaryWriter::Stored<T> stored;
+        readBytes(&stored, sizeof(stored));
+        return static_cast<T>(stored);
+    }
+
+    /// Read a string.
+    auto readString() -> String;
+
+    /// Read a sequence of integer values, floating-point values or strings.
+    template<typename Container>
+    auto readValues() -> Container
+    {
+        using Value = typename Container::value_type;
+        const auto size = readValue<Index>();
+        if constexpr(std::is_same_v<Value, String>)
+        {
+            errorif(size > remaining() / 8, "The binary file `", path, "` is corrupted (could not read a sequence of ", size, " strings).");
+            Container values(size);
+            for(auto& value : values)
+                value = readString();
+            return values;
+        }
+        else
+        {
+            using StoredValue = BinaryWriter::Stored<Value>;
+            errorif(size > remaining() / sizeof(StoredValue), "The binary file `", path, "` is corrupted (could not read a sequence of ", size, " values).");
+            Vec<StoredValue> stored(size);
+            readBytes(stored.data(), size * sizeof(StoredValue));
+            Container values(size);
+            std::transform(stored.begin(), stored.end(), values.begin(), [](StoredValue x) { return static_cast<Value>(x); });
+            return values;
+        }
+    }
+
+    /// Read an Eigen vector, matrix or array.
+    template<typename MatrixType>
+    auto readMatrix() -> MatrixType
+    {
+        using Scalar = typename MatrixType::Scalar;
+        using StoredScalar = BinaryWriter::Stored<Scalar>;
+        const auto rows = readValue<Index>();
+        const auto cols = readValue<Index>();
+        errorif(rows != 0 && cols > remaining() / sizeof(StoredScalar) / rows, "The binary file `", path, "` is corrupted (could not read a matrix with ", rows, " rows and ", cols, " columns).");
+        Eigen::Matrix<StoredScalar, -1, -1> stored(rows, cols);
+        readBytes(stored.data(), stored.size() * sizeof(StoredScalar));
+        return stored.template cast<Scalar>();
+    }
+
+    /// Return the number of bytes not yet read.
+    auto remaining() const -> Index;
+
+private:
+    /// The path of the file.
+    String path;
+
+    /// The contents of the file if not memory mapped (stored in 8-byte words to ensure proper alignment).
+    Vec<std::uint64_t> words;
+
+    /// The memory mapped contents of the file (`nullptr` if the file is not memory mapped).
+    void* mapping = nullptr;
+
+    /// The pointer to the first byte of the contents of the file (either in `mapping` or `words`).
+    char const* bytes = nullptr;
+
+    /// The number of bytes in the file.
+    Index count = 0;
+
+    /// The number of bytes read so far.
+    Index offset = 0;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,82 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <filesystem>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/BinaryIO.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing BinaryWriter and BinaryReader", "[BinaryIO]")
+{
+    const auto path = (std::filesystem::temp_directory_path() / "reaktoro-binaryio-test.bin").string();
+
+    const MatrixXd A = MatrixXd::Random(3, 4);
+    const ArrayXd b = ArrayXd::Random(5);
+    const ArrayXl c = ArrayXl::LinSpaced(7, 0, 6);
+
+    {
+        BinaryWriter writer(path);
+        writer.writeString("RKT");
+        writer.writeValue(Index(42));
+        writer.writeValue(-7L);
+        writer.writeValue(3.25);
+        writer.writeValues(Deque<Index>{ 5, 3, 1 });
+        writer.writeValues(Strings{ "H2O", "", "CO2(g)" });
+        writer.writeMatrix(A);
+        writer.writeMatrix(b);
+        writer.writeMatrix(c);
+        writer.writeString("");
+        writer.writeString("H2O(aq)");
+
+        CHECK( writer.size() % 8 == 0 );
+
+        const auto size = writer.size();
+        writer.writeValues(Vec<float>{ 1.5f, -2.25f, 3.0f });
+
+        CHECK( writer.size() == size + 8 + 16 ); // the number of values and three 4-byte floats padded to 16 bytes
+
+        writer.writeValue(0.5f);
+        writer.writeValues(Vec<bool>{ true, false });
+    }
+
+    BinaryReader reader(path);
+
+    CHECK( reader.readString() == "RKT" );
+    CHECK( reader.readValue<Index>() == 42 );
+    CHECK( reader.readValue<long>() == -7 );
+    CHECK( reader.readValue<double>() == 3.25 );
+    CHECK( reader.readValues<Deque<Index>>() == Deque<Index>{ 5, 3, 1 } );
+    CHECK( reader.readValues<Strings>() == Strings{ "H2O", "", "CO2(g)" } );
+    CHECK( reader.readMatrix<MatrixXd>() == A );
+    CHECK( (reader.readMatrix<ArrayXd>() == b).all() );
+    CHECK( (reader.readMatrix<ArrayXl>() == c).all() );
+    CHECK( reader.readString() == "" );
+    CHECK( reader.readString() == "H2O(aq)" );
+    CHECK( reader.readValues<Vec<float>>() == Vec<float>{ 1.5f, -2.25f, 3.0f } );
+    CHECK( reader.readValue<float>() == 0.5f );
+    CHECK( reader.readValues<Vec<bool>>() == Vec<bool>{ true, false } );
+    CHECK( reader.remaining() == 0 );
+
+    CHECK_THROWS( reader.readValue<double>() );
+
+    std::filesystem::remove(path);
+}
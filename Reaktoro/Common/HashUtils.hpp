@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <functional>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -75,3 +76,13 @@ struct std::hash<std::pair<L, R>>
         return Reaktoro::hashCombine(0, obj.first, obj.second);
     }
 };
+
+/// Specialize std::hash for `std::tuple<Args...>` so that it can be used as key in `std::unordered_map`.
+template<typename... Args>
+struct std::hash<std::tuple<Args...>>
+{
+    std::size_t operator()(std::tuple<Args...> const& obj) const
+    {
+        return std::apply([](auto const&... args) { return Reaktoro::hashCombine(0, args...); }, obj);
+    }
+};
@@ -0,0 +1,93 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <atomic>
+#include <memory>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to hold lookup tables of a container (e.g., hash maps from names to indices) that are built on demand.
+/// A container keeps a LookupIndex object next to its items and asks it for the
+/// lookup tables with @ref get, which builds them on first use. The container
+/// must call @ref reset (or @ref update) whenever its items may have changed.
+/// Concurrent calls to @ref get are thread-safe, so that a container can be
+/// queried from many threads at once, but calls to @ref reset and @ref update
+/// must not happen concurrently with any other call, like any modification of
+/// the container itself. Copies of a LookupIndex object share the same lookup
+/// tables, which are never modified after shared.
+template<typename T>
+class LookupIndex
+{
+public:
+    /// Construct a default LookupIndex object.
+    LookupIndex()
+    {}
+
+    /// Construct a copy of a LookupIndex object.
+    LookupIndex(LookupIndex const& other)
+    : mtables(std::atomic_load(&other.mtables))
+    {}
+
+    /// Assign another LookupIndex object to this.
+    auto operator=(LookupIndex const& other) -> LookupIndex&
+    {
+        mtables = std::atomic_load(&other.mtables);
+        return *this;
+    }
+
+    /// Return the lookup tables, building them with a given function if not available yet.
+    /// @param build The function of signature `T()` that builds the lookup tables.
+    template<typename Builder>
+    auto get(Builder const& build) const -> SharedPtr<T const>
+    {
+        SharedPtr<T const> current = std::atomic_load(&mtables);
+        if(current)
+            return current;
+        SharedPtr<T const> created = std::make_shared<T>(build());
+        if(std::atomic_compare_exchange_strong(&mtables, &current, created))
+            return created;
+        return current; // another thread built the lookup tables first
+    }
+
+    /// Discard the lookup tables, which are built again on the next call to @ref get.
+    auto reset() -> void
+    {
+        mtables.reset();
+    }
+
+    /// Update the lookup tables in place if they exist and are not shared with copies of this object, or otherwise discard them.
+    /// @param fn The function of signature `void(T&)` that updates the lookup tables.
+    template<typename Updater>
+    auto update(Updater const& fn) -> void
+    {
+        if(mtables.use_count() == 1)
+            fn(const_cast<T&>(*mtables)); // the lookup tables are created non-const in method get
+        else reset();
+    }
+
+private:
+    /// The lookup tables (or null if not built yet).
+    mutable SharedPtr<T const> mtables;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,99 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <atomic>
+#include <thread>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/LookupIndex.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing LookupIndex", "[LookupIndex]")
+{
+    Strings names = { "A", "B", "C" };
+
+    std::atomic<int> counter = 0; // the number of times the lookup table below has been built
+
+    const auto build = [&]
+    {
+        ++counter;
+        Map<String, Index> table;
+        for(auto i = 0; i < names.size(); ++i)
+            table.emplace(names[i], i);
+        return table;
+    };
+
+    LookupIndex<Map<String, Index>> lookup;
+
+    CHECK( lookup.get(build)->at("B") == 1 );
+    CHECK( lookup.get(build)->at("C") == 2 );
+    CHECK( counter == 1 );
+
+    SECTION("Checking the lookup table is updated in place when not shared")
+    {
+        names.push_back("D");
+        lookup.update([&](auto& table) { table.emplace("D", 3); });
+
+        CHECK( lookup.get(build)->at("D") == 3 );
+        CHECK( counter == 1 );
+    }
+
+    SECTION("Checking the lookup table is discarded when shared and then updated")
+    {
+        const auto copy = lookup;
+
+        names.push_back("D");
+        lookup.update([&](auto& table) { table.emplace("D", 3); });
+
+        CHECK( copy.get(build)->count("D") == 0 );
+        CHECK( lookup.get(build)->at("D") == 3 );
+        CHECK( counter == 2 );
+    }
+
+    SECTION("Checking the lookup table is built again after reset")
+    {
+        names[0] = "Z";
+        lookup.reset();
+
+        CHECK( lookup.get(build)->at("Z") == 0 );
+        CHECK( lookup.get(build)->count("A") == 0 );
+        CHECK( counter == 2 );
+    }
+
+    SECTION("Checking the lookup table can be built concurrently")
+    {
+        lookup.reset();
+
+        Vec<std::thread> threads;
+        Vec<Index> indices(8);
+
+        for(auto k = 0; k < 8; ++k)
+            threads.emplace_back([&, k] { indices[k] = lookup.get(build)->at("C"); });
+
+        for(auto& thread : threads)
+            thread.join();
+
+        for(auto i : indices)
+            CHECK( i == 2 );
+
+        CHECK( lookup.get(build) == lookup.get(build) ); // all threads end up using the same lookup table
+    }
+}
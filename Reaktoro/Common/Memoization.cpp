@@ -17,12 +17,15 @@
 
 #include "Memoization.hpp"
 
+// C++ includes
+#include <atomic>
+
 namespace Reaktoro {
 
-auto getMemoizationStatus() -> bool&
+auto getMemoizationStatus() -> std::atomic<bool>&
 {
     /// The global variable that holds status if memoization is currently enabled or disabled.
-    static bool memoization_active = true;
+    static std::atomic<bool> memoization_active = true;
     return memoization_active;
 }
 
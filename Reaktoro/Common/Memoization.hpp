@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Meta.hpp>
+#include <Reaktoro/Common/ThreadLocal.hpp>
 #include <Reaktoro/Common/TraitsUtils.hpp>
 #include <Reaktoro/Common/Types.hpp>
 
@@ -140,18 +141,32 @@ public:
 };
 
 /// Return a memoized version of given function `f`.
+/// The memoized function can be called concurrently from multiple threads.
+/// Each thread has its own cache and evaluates its own copy of `f`, so that
+/// objects captured by value in `f` are not shared among threads. Objects
+/// reached through captured pointers (e.g., a captured SharedPtr) are still
+/// shared, and `f` must not modify them unless they are safe for concurrent use.
 template<typename Ret, typename... Args>
 auto memoize(Fn<Ret(Args...)> f) -> Fn<Ret(Args...)>
 {
-    auto cache = std::make_shared<Map<Tuple<Args...>, Ret>>();
-    return [=](Args... args) mutable -> Ret
+    struct Cache
     {
+        Fn<Ret(Args...)> f;
+        Map<Tuple<Args...>, Ret> results;
+    };
+
+    ThreadLocal<Cache> caches([=] { return Cache{ f, {} }; });
+
+    return [=](Args... args) -> Ret
+    {
+        auto& cache = caches.local();
         if(Memoization::isDisabled())
-            return f(args...);
+            return cache.f(args...);
         Tuple<Args...> t(args...);
-        if(cache->find(t) == cache->end())
-            (*cache)[t] = f(args...);
-        return (*cache)[t];
+        if(auto it = cache.results.find(t); it != cache.results.end())
+            return it->second;
+        auto result = cache.f(args...);
+        return cache.results[t] = result;
     };
 }
 
@@ -163,21 +178,31 @@ auto memoize(Fun f)
 }
 
 /// Return a memoized version of given function `f` that caches only the arguments used in the last call.
+/// The memoized function can be called concurrently from multiple threads (see @ref memoize).
 template<typename Ret, typename... Args>
 auto memoizeLast(Fn<Ret(Args...)> f) -> Fn<Ret(Args...)>
 {
-    Tuple<detail::CacheType<Args>...> cache;
-    Ret result = Ret();
-    auto firsttime = true;
-    return [=](Args... args) mutable -> Ret
+    struct Cache
     {
+        Fn<Ret(Args...)> f;
+        Tuple<detail::CacheType<Args>...> args;
+        Ret result = Ret();
+        bool firsttime = true;
+    };
+
+    ThreadLocal<Cache> caches([=] { return Cache{ f }; });
+
+    return [=](Args... args) -> Ret
+    {
+        auto& cache = caches.local();
         if(Memoization::isDisabled())
-            return f(args...);
-        if(detail::sameValues(cache, std::tie(args...)) && !firsttime)
-            return Ret(result);
-        detail::assignValues(cache, std::tie(args...));
-        firsttime = false;
-        return result = f(args...);
+            return cache.f(args...);
+        if(detail::sameValues(cache.args, std::tie(args...)) && !cache.firsttime)
+            return Ret(cache.result);
+        cache.result = cache.f(args...);
+        detail::assignValues(cache.args, std::tie(args...));
+        cache.firsttime = false;
+        return cache.result;
     };
 }
 
@@ -189,29 +214,38 @@ auto memoizeLast(Fun f)
 }
 
 /// Return a memoized version of given function `f` that caches only the arguments used in the last call.
+/// The memoized function can be called concurrently from multiple threads (see @ref memoize).
 template<typename Ret, typename RetRef, typename... Args>
 auto memoizeLastUsingRef(Fn<void(RetRef, Args...)> f) -> Fn<void(RetRef, Args...)>
 {
-    Tuple<detail::CacheType<Args>...> cache;
-    Ret result = Ret();
-    auto firsttime = true;
-    return [=](RetRef res, Args... args) mutable -> void
+    struct Cache
+    {
+        Fn<void(RetRef, Args...)> f;
+        Tuple<detail::CacheType<Args>...> args;
+        Ret result = Ret();
+        bool firsttime = true;
+    };
+
+    ThreadLocal<Cache> caches([=] { return Cache{ f }; });
+
+    return [=](RetRef res, Args... args) -> void
     {
+        auto& cache = caches.local();
         if(Memoization::isDisabled())
-            f(res, args...);
-        else if(detail::sameValues(cache, std::tie(args...)) && !firsttime)
-            res = result;
+            cache.f(res, args...);
+        else if(detail::sameValues(cache.args, std::tie(args...)) && !cache.firsttime)
+            res = cache.result;
         else
         {
-            f(res, args...);
-            result = res;
-            detail::assignValues(cache, std::tie(args...));
+            cache.f(res, args...);
+            cache.result = res;
+            detail::assignValues(cache.args, std::tie(args...));
+            cache.firsttime = false;
         }
-        firsttime = false;
     };
 }
 
-/// Return a memoized version of given function `f` that caches only the arguments used in the last call./// Return a memoized version of given function `f` that caches only the arguments used in the last call.
+/// Return a memoized version of given function `f` that caches only the arguments used in the last call.
 /// This overload is used when `f` is a lambda function or free function.
 /// Use `memoizeLastUsingRef<Ret>(f)` to explicitly specify the `Ret` type.
 template<typename Ret, typename Fun, Requires<!isFunction<Fun>> = true>
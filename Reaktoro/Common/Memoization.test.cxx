@@ -15,6 +15,10 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <atomic>
+#include <thread>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -126,3 +130,60 @@ TEST_CASE("Testing Memoization - memoizeLast without return", "[Memoization]")
 
     CHECK( counter == 5 ); // two increments above, in f1 and f2, because of different arguments
 }
+
+TEST_CASE("Testing Memoization - memoized functions called from multiple threads", "[Memoization]")
+{
+    std::atomic<int> counter = 0; // a counter for how many times f1 below has been fully evaluated
+
+    // A function with mutable captured state, which must not be shared among threads
+    Fn<double(double, int)> f1 = [&, workspace = 0.0](double x, int y) mutable
+    {
+        ++counter;
+        workspace = x * y;
+        return workspace;
+    };
+
+    auto f2 = memoizeLast(f1);
+
+    Fn<void(DummyResult&, double, int)> g1 = [&, workspace = 0.0](DummyResult& res, double x, int y) mutable -> void
+    {
+        ++counter;
+        workspace = x + y;
+        res.r = workspace;
+        res.s = x * y;
+    };
+
+    auto g2 = memoizeLastUsingRef(g1);
+
+    const auto numthreads = 8;
+    const auto numcalls = 1000;
+
+    std::atomic<int> failures = 0;
+
+    Vec<std::thread> threads;
+    for(auto k = 0; k < numthreads; ++k)
+    {
+        threads.emplace_back([&, k]
+        {
+            DummyResult res;
+            for(auto i = 0; i < numcalls; ++i)
+            {
+                const double x = k + 1.0;
+                const int y = i / 10; // each argument is repeated ten times in a row to exercise the cache
+                if(f2(x, y) != x * y)
+                    ++failures;
+                g2(res, x, y);
+                if(res.r != x + y || res.s != x * y)
+                    ++failures;
+            }
+        });
+    }
+
+    for(auto& thread : threads)
+        thread.join();
+
+    CHECK( failures == 0 );
+
+    // Each thread evaluates f1 and g1 only when the arguments change (i.e., numcalls/10 times each)
+    CHECK( counter == 2 * numthreads * numcalls / 10 );
+}
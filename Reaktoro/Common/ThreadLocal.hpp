@@ -0,0 +1,158 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <iterator>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+namespace detail {
+
+/// Return a new identifier, unique among all threads and never reused, for a ThreadLocal object.
+auto createThreadLocalID() -> Index;
+
+} // namespace detail
+
+/// Used to hold a separate instance of an object of type `T` for each thread accessing it.
+/// A ThreadLocal object can be captured by value in function objects that are
+/// shared among threads (e.g., models stored in a ChemicalSystem object) to
+/// hold workspace or caches that would otherwise be mutated concurrently. The
+/// instance for the calling thread is created on its first call to @ref local
+/// using the initializer function given at construction. Copies of a
+/// ThreadLocal object share the same instances (one per thread). The instances
+/// of a thread are destroyed when the thread exits or, after the last copy of
+/// the ThreadLocal object is destroyed, when the thread later creates other
+/// thread-local instances of the same type `T`. Each thread remembers the
+/// instances it accessed most recently, so that repeated calls to @ref local
+/// usually skip the lookup in its hash table of instances.
+template<typename T>
+class ThreadLocal
+{
+public:
+    /// Construct a ThreadLocal object whose instances are default constructed.
+    ThreadLocal()
+    : ThreadLocal([] { return T(); })
+    {}
+
+    /// Construct a ThreadLocal object whose instances are created with a given initializer function.
+    explicit ThreadLocal(Fn<T()> const& initializer)
+    : mtoken(std::make_shared<Token>(Token{ detail::createThreadLocalID(), initializer }))
+    {}
+
+    /// Return the instance of type `T` of the calling thread.
+    auto local() const -> T&
+    {
+        auto& table = threadTable();
+        auto const id = mtoken->id;
+
+        // The identifiers are never reused, so a matching recent entry is the instance of this ThreadLocal object
+        auto& recent = table.recent[id % Table::numrecent];
+        if(recent.first == id)
+            return *recent.second;
+
+        if(auto it = table.entries.find(id); it != table.entries.end())
+        {
+            recent = { id, it->second.value.get() };
+            return *recent.second;
+        }
+
+        // Release the instances of expired ThreadLocal objects before the table grows too large
+        if(table.entries.size() >= table.threshold)
+        {
+            for(auto it = table.entries.begin(); it != table.entries.end();)
+                it = it->second.owner.expired() ? table.entries.erase(it) : std::next(it);
+            table.threshold = std::max<Index>(64, 2 * table.entries.size());
+            table.recent.fill({ Table::noid, nullptr });
+        }
+
+        auto value = std::make_unique<T>(mtoken->initializer());
+        auto const [it, _] = table.entries.emplace(id, Entry{ mtoken, std::move(value) });
+        recent = { id, it->second.value.get() };
+        return *recent.second;
+    }
+
+    /// Return the instance of type `T` of the calling thread.
+    auto operator*() const -> T& { return local(); }
+
+    /// Return a pointer to the instance of type `T` of the calling thread.
+    auto operator->() const -> T* { return &local(); }
+
+private:
+    /// The data shared among all copies of a ThreadLocal object.
+    struct Token
+    {
+        /// The unique identifier of the ThreadLocal object.
+        Index id;
+
+        /// The function that creates the instance of each thread.
+        Fn<T()> initializer;
+    };
+
+    /// The instance of type `T` of a thread for a ThreadLocal object.
+    struct Entry
+    {
+        /// The data of the ThreadLocal object owning this entry (used to detect when it is destroyed).
+        std::weak_ptr<Token> owner;
+
+        /// The instance of type `T` (kept in the heap so that references to it are never invalidated).
+        Ptr<T> value;
+    };
+
+    /// The table of instances of type `T` of a thread for all ThreadLocal objects.
+    struct Table
+    {
+        /// The instances of type `T` of the thread indexed by the identifiers of the ThreadLocal objects.
+        Map<Index, Entry> entries;
+
+        /// The size of the table at which instances of expired ThreadLocal objects are released.
+        Index threshold = 64;
+
+        /// The number of recently accessed instances remembered by the thread.
+        static constexpr Index numrecent = 8;
+
+        /// The identifier used in `recent` for no ThreadLocal object.
+        static constexpr Index noid = -1;
+
+        /// The recently accessed instances and the identifiers of their ThreadLocal objects, indexed by identifier modulo `numrecent`.
+        Array<Pair<Index, T*>, numrecent> recent = makeRecent();
+
+        /// Return the initial value of `recent`, with no remembered instance.
+        static auto makeRecent() -> Array<Pair<Index, T*>, numrecent>
+        {
+            Array<Pair<Index, T*>, numrecent> recent;
+            recent.fill({ noid, nullptr });
+            return recent;
+        }
+    };
+
+    /// Return the table of instances of type `T` of the calling thread.
+    static auto threadTable() -> Table&
+    {
+        thread_local Table table;
+        return table;
+    }
+
+    /// The data shared among all copies of this ThreadLocal object.
+    SharedPtr<Token> mtoken;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,102 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <thread>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ThreadLocal.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ThreadLocal", "[ThreadLocal]")
+{
+    ThreadLocal<Vec<int>> values([] { return Vec<int>{ 1, 2, 3 }; });
+
+    CHECK( values.local() == Vec<int>{ 1, 2, 3 } );
+
+    values.local().push_back(4);
+
+    CHECK( values->size() == 4 );
+
+    SECTION("Checking copies share the same instance in the same thread")
+    {
+        auto copy = values;
+        CHECK( copy->size() == 4 );
+        CHECK( &copy.local() == &values.local() );
+    }
+
+    SECTION("Checking different ThreadLocal objects have different instances")
+    {
+        ThreadLocal<Vec<int>> others;
+        CHECK( others->empty() );
+        CHECK( &others.local() != &values.local() );
+    }
+
+    SECTION("Checking other threads have their own instances")
+    {
+        Vec<std::thread> threads;
+        Vec<Index> sizes(4);
+        Vec<Vec<int>*> addresses(4);
+
+        for(auto k = 0; k < 4; ++k)
+            threads.emplace_back([&, k]
+            {
+                for(auto i = 0; i < k; ++i)
+                    values->push_back(i);
+                sizes[k] = values->size();
+                addresses[k] = &values.local();
+            });
+
+        for(auto& thread : threads)
+            thread.join();
+
+        for(auto k = 0; k < 4; ++k)
+        {
+            CHECK( sizes[k] == 3 + k );
+            CHECK( addresses[k] != &values.local() );
+        }
+
+        CHECK( values->size() == 4 ); // the instance in this thread was not affected
+    }
+
+    SECTION("Checking instances of destroyed ThreadLocal objects are released")
+    {
+        auto counter = std::make_shared<int>(0);
+
+        for(auto i = 0; i < 1000; ++i)
+        {
+            ThreadLocal<SharedPtr<int>> local([=] { return counter; });
+            local.local();
+        }
+
+        CHECK( counter.use_count() < 200 ); // only instances created after the last release of expired ones remain alive
+    }
+
+    SECTION("Checking many ThreadLocal objects accessed alternately have their own instances")
+    {
+        Vec<ThreadLocal<int>> locals;
+        for(auto i = 0; i < 20; ++i)
+            locals.emplace_back([=] { return i; }); // more objects than the recently accessed instances remembered by a thread
+
+        for(auto repeat = 0; repeat < 3; ++repeat)
+            for(auto i = 0; i < 20; ++i)
+                CHECK( locals[i].local()++ == i + repeat );
+    }
+}
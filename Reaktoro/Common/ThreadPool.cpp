@@ -0,0 +1,245 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ThreadPool.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The ThreadPool::Impl object whose parallel loop is being executed by the calling thread (or null if none).
+thread_local void const* activepool = nullptr;
+
+} // namespace
+
+struct ThreadPool::Impl
+{
+    /// The range `[begin, end)` of iterations in a chunk of a parallel loop.
+    using Chunk = Pair<Index, Index>;
+
+    /// The queue of chunks owned by a worker thread (from which other worker threads can steal).
+    struct Queue
+    {
+        /// The mutex used to protect the chunks in the queue.
+        std::mutex mutex;
+
+        /// The chunks of iterations still to be executed.
+        Deque<Chunk> chunks;
+    };
+
+    /// The number of worker threads in the pool (including the calling thread).
+    const Index numthreads;
+
+    /// The queues of chunks of each worker thread.
+    Deque<Queue> queues;
+
+    /// The helper threads (worker threads 1, 2, ..., numthreads - 1).
+    Vec<std::thread> threads;
+
+    /// The mutex used to synchronize the start and end of parallel loops.
+    std::mutex mutex;
+
+    /// The mutex used to serialize concurrent calls to parallelFor.
+    std::mutex runmutex;
+
+    /// The condition variable used to wake up helper threads when a new parallel loop starts.
+    std::condition_variable cvstart;
+
+    /// The condition variable used to wake up the calling thread when all helper threads are done.
+    std::condition_variable cvdone;
+
+    /// The counter of parallel loops executed so far (used by helper threads to detect new work).
+    Index generation = 0;
+
+    /// The number of helper threads still working on the current parallel loop.
+    Index pending = 0;
+
+    /// The flag indicating the pool is being destroyed.
+    bool stopping = false;
+
+    /// The task executed in the current parallel loop.
+    TaskFn const* task = nullptr;
+
+    /// The first exception thrown during the current parallel loop.
+    std::exception_ptr exception;
+
+    /// Construct a ThreadPool::Impl object.
+    Impl(Index n)
+    : numthreads(n == 0 ? numHardwareThreads() : n), queues(numthreads)
+    {
+        for(Index i = 1; i < numthreads; ++i)
+            threads.emplace_back([this, i] { loop(i); });
+    }
+
+    /// Destroy this ThreadPool::Impl object.
+    ~Impl()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cvstart.notify_all();
+        for(auto& thread : threads)
+            thread.join();
+    }
+
+    /// The loop executed by each helper thread while the pool is alive.
+    auto loop(Index ithread) -> void
+    {
+        Index seen = 0;
+        while(true)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cvstart.wait(lock, [&] { return stopping || generation != seen; });
+            if(stopping)
+                return;
+            seen = generation;
+            lock.unlock();
+
+            work(ithread);
+
+            lock.lock();
+            if(--pending == 0)
+                cvdone.notify_one();
+        }
+    }
+
+    /// Pop the next chunk from the front of the queue of a worker thread.
+    auto pop(Index ithread, Chunk& chunk) -> bool
+    {
+        auto& queue = queues[ithread];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if(queue.chunks.empty())
+            return false;
+        chunk = queue.chunks.front();
+        queue.chunks.pop_front();
+        return true;
+    }
+
+    /// Steal a chunk from the back of the queue of another worker thread.
+    auto steal(Index ithread, Chunk& chunk) -> bool
+    {
+        for(Index j = 1; j < numthreads; ++j)
+        {
+            auto& queue = queues[(ithread + j) % numthreads];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if(queue.chunks.empty())
+                continue;
+            chunk = queue.chunks.back();
+            queue.chunks.pop_back();
+            return true;
+        }
+        return false;
+    }
+
+    /// Execute chunks of the current parallel loop until none is left in any queue.
+    auto work(Index ithread) -> void
+    {
+        const auto previous = std::exchange(activepool, this);
+        Chunk chunk;
+        while(pop(ithread, chunk) || steal(ithread, chunk))
+        {
+            for(Index i = chunk.first; i < chunk.second; ++i)
+            {
+                try { (*task)(ithread, i); }
+                catch(...)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if(!exception)
+                        exception = std::current_exception();
+                }
+            }
+        }
+        activepool = previous;
+    }
+
+    /// Execute `task(ithread, i)` for every `i` in `[0, size)`.
+    auto parallelFor(Index size, Index chunksize, TaskFn const& fn) -> void
+    {
+        if(size == 0)
+            return;
+
+        chunksize = std::max<Index>(chunksize, 1);
+
+        // A nested parallel loop would wait forever for the worker threads busy with the current one
+        errorif(activepool == this, "ThreadPool::parallelFor cannot be called from within an iteration of a parallel loop of the same ThreadPool object.");
+
+        std::lock_guard<std::mutex> runlock(runmutex);
+
+        // Distribute the chunks in contiguous blocks among the worker threads to preserve locality
+        const auto numchunks = (size + chunksize - 1) / chunksize;
+        for(Index k = 0; k < numchunks; ++k)
+        {
+            const auto ithread = k * numthreads / numchunks;
+            const auto begin = k * chunksize;
+            const auto end = std::min(begin + chunksize, size);
+            queues[ithread].chunks.push_back({ begin, end });
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            task = &fn;
+            exception = nullptr;
+            pending = threads.size();
+            ++generation;
+        }
+        cvstart.notify_all();
+
+        work(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        cvdone.wait(lock, [&] { return pending == 0; });
+        task = nullptr;
+
+        if(exception)
+            std::rethrow_exception(std::exchange(exception, nullptr));
+    }
+};
+
+ThreadPool::ThreadPool(Index numthreads)
+: pimpl(new Impl(numthreads))
+{}
+
+ThreadPool::~ThreadPool()
+{}
+
+auto ThreadPool::numThreads() const -> Index
+{
+    return pimpl->numthreads;
+}
+
+auto ThreadPool::parallelFor(Index size, Index chunksize, TaskFn const& task) -> void
+{
+    pimpl->parallelFor(size, chunksize, task);
+}
+
+auto ThreadPool::numHardwareThreads() -> Index
+{
+    return std::max<Index>(std::thread::hardware_concurrency(), 1);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,80 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to execute loops in parallel using a fixed set of worker threads.
+/// The iterations of a loop are split into chunks, which are initially
+/// distributed in contiguous blocks among the worker threads. A worker thread
+/// that runs out of chunks steals the last chunk of another worker thread, so
+/// that load imbalance among iterations (e.g., equilibrium calculations that
+/// need more or fewer iterations to converge) does not leave threads idle.
+/// The thread calling @ref parallelFor participates as worker thread zero.
+class ThreadPool
+{
+public:
+    /// The function type executed for each iteration of a parallel loop.
+    /// The first argument is the index of the worker thread executing the
+    /// iteration (in the range `[0, numThreads())`) and the second is the
+    /// index of the iteration.
+    using TaskFn = Fn<void(Index ithread, Index i)>;
+
+    /// Construct a ThreadPool object with given number of worker threads.
+    /// @param numthreads The number of worker threads (zero means the number of hardware threads available)
+    explicit ThreadPool(Index numthreads = 0);
+
+    /// Destroy this ThreadPool object (waiting for all worker threads to finish).
+    ~ThreadPool();
+
+    /// Deleted copy constructor.
+    ThreadPool(ThreadPool const&) = delete;
+
+    /// Deleted copy assignment operator.
+    auto operator=(ThreadPool const&) -> ThreadPool& = delete;
+
+    /// Return the number of worker threads in the pool (including the calling thread).
+    auto numThreads() const -> Index;
+
+    /// Execute `task(ithread, i)` for every `i` in `[0, size)` using the worker threads of the pool.
+    /// This method returns only after all iterations have been executed. If
+    /// an iteration throws an exception, the remaining iterations are still
+    /// executed and the first exception caught is rethrown afterwards.
+    /// Concurrent calls to this method on the same ThreadPool object are
+    /// executed one after the other.
+    /// @warning An exception is thrown if this method is called from within an
+    /// iteration of a parallel loop of the same ThreadPool object, since such a
+    /// nested loop would deadlock. Use a different ThreadPool object instead.
+    /// @param size The number of iterations in the loop
+    /// @param chunksize The number of consecutive iterations claimed at once by a worker thread
+    /// @param task The function executed for each iteration
+    auto parallelFor(Index size, Index chunksize, TaskFn const& task) -> void;
+
+    /// Return the number of hardware threads available (at least one).
+    static auto numHardwareThreads() -> Index;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,95 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <atomic>
+#include <stdexcept>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ThreadPool.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ThreadPool", "[ThreadPool]")
+{
+    ThreadPool pool(4);
+
+    CHECK( pool.numThreads() == 4 );
+
+    const Index size = 1003;
+
+    SECTION("Checking every iteration is executed exactly once")
+    {
+        Vec<Index> counts(size, 0);
+        Vec<Index> threads(size, 0);
+
+        pool.parallelFor(size, 10, [&](Index ithread, Index i) { counts[i] += 1; threads[i] = ithread; });
+
+        for(auto i = 0; i < size; ++i)
+        {
+            CHECK( counts[i] == 1 );
+            CHECK( threads[i] < 4 );
+        }
+    }
+
+    SECTION("Checking the pool can be reused for many parallel loops")
+    {
+        std::atomic<Index> sum = 0;
+        for(auto k = 0; k < 20; ++k)
+            pool.parallelFor(size, 7, [&](Index ithread, Index i) { sum += i; });
+        CHECK( sum == 20 * size * (size - 1) / 2 );
+    }
+
+    SECTION("Checking empty loops and chunks larger than the loop")
+    {
+        Index count = 0;
+        pool.parallelFor(0, 10, [&](Index ithread, Index i) { ++count; });
+        CHECK( count == 0 );
+        pool.parallelFor(3, 100, [&](Index ithread, Index i) { ++count; });
+        CHECK( count == 3 );
+    }
+
+    SECTION("Checking exceptions thrown in iterations are rethrown")
+    {
+        std::atomic<Index> count = 0;
+        auto task = [&](Index ithread, Index i) { ++count; if(i == 17) throw std::runtime_error("failure"); };
+        CHECK_THROWS( pool.parallelFor(size, 5, task) );
+        CHECK( count == size );
+    }
+
+    SECTION("Checking nested parallel loops on the same pool throw instead of deadlocking")
+    {
+        std::atomic<Index> count = 0;
+        auto task = [&](Index ithread, Index i) { pool.parallelFor(2, 1, [&](Index, Index) { ++count; }); };
+        CHECK_THROWS( pool.parallelFor(8, 1, task) );
+        CHECK( count == 0 );
+
+        ThreadPool other(2);
+        pool.parallelFor(8, 1, [&](Index ithread, Index i) { other.parallelFor(2, 1, [&](Index, Index) { ++count; }); });
+        CHECK( count == 16 );
+    }
+
+    SECTION("Checking a pool with a single thread executes in the calling thread")
+    {
+        ThreadPool single(1);
+        Index count = 0;
+        single.parallelFor(size, 3, [&](Index ithread, Index i) { CHECK( ithread == 0 ); ++count; });
+        CHECK( count == size );
+    }
+}
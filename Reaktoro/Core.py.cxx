@@ -51,6 +51,7 @@ void exportSpeciesList(py::module& m);
 void exportSpeciesThermoProps(py::module& m);
 void exportStandardThermoModel(py::module& m);
 void exportStandardThermoProps(py::module& m);
+void exportStandardThermoPropsCache(py::module& m);
 void exportStateOfMatter(py::module& m);
 void exportSurface(py::module& m);
 void exportSurfaceAreaModel(py::module& m);
@@ -94,6 +95,7 @@ void exportCore(py::module& m)
     exportSpeciesThermoProps(m);
     exportStandardThermoProps(m);
     exportStandardThermoModel(m);
+    exportStandardThermoPropsCache(m);
     exportStateOfMatter(m);
     exportSurface(m);
     exportSurfaceAreaModel(m);
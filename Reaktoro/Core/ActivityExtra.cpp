@@ -0,0 +1,79 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ActivityExtra.hpp"
+
+// C++ includes
+#include <mutex>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+namespace detail {
+
+auto activityExtraSlotIndex(String const& name, std::type_index type) -> Index
+{
+    static std::mutex mutex;
+    static Map<String, Pair<Index, std::type_index>> slots;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(auto it = slots.find(name); it != slots.end())
+    {
+        errorif(it->second.second != type, "Cannot register the ActivityExtra slot `", name, "` with a type different from the one it was first registered with.");
+        return it->second.first;
+    }
+
+    const auto index = slots.size();
+    slots.emplace(name, Pair<Index, std::type_index>{ index, type });
+    return index;
+}
+
+} // namespace detail
+
+auto ActivityExtraAccesses::recordWrite(Index slot, Index model) -> void
+{
+    if(slot >= m_writers.size())
+        m_writers.resize(slot + 1, -1);
+    m_writers[slot] = model;
+}
+
+auto ActivityExtraAccesses::recordRead(Index slot, Index model) -> void
+{
+    if(slot >= m_writers.size() || m_writers[slot] == -1)
+        return;
+    const Index other = m_writers[slot];
+    if(other == model || dependsOn(model, other))
+        return;
+    m_dependencies.push_back({ model, other });
+}
+
+auto ActivityExtraAccesses::dependsOn(Index model, Index other) const -> bool
+{
+    for(auto const& [i, j] : m_dependencies)
+        if(i == model && j == other)
+            return true;
+    return false;
+}
+
+auto ActivityExtraAccesses::numDependencies() const -> Index
+{
+    return m_dependencies.size();
+}
+
+} // namespace Reaktoro
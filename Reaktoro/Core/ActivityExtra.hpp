@@ -0,0 +1,169 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <typeindex>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+namespace detail {
+
+/// Return the index of the ActivityExtra slot with given name, registering it on its first request.
+auto activityExtraSlotIndex(String const& name, std::type_index type) -> Index;
+
+} // namespace detail
+
+/// Used as a handle to a typed slot in ActivityExtra objects.
+/// A slot is identified by a unique name (e.g., `"AqueousMixtureState"`)
+/// and registered once, when its first handle is constructed. Activity
+/// models create their handles at construction time, so that writing and
+/// reading data through them during model evaluation is a plain indexed
+/// access, with no string hashing or comparison. Registering the same name
+/// with a different type `T` is an error.
+template<typename T>
+class ActivityExtraSlot
+{
+public:
+    /// The type of the data in the slot.
+    using Type = T;
+
+    /// Construct an ActivityExtraSlot object with given unique name.
+    explicit ActivityExtraSlot(String const& name)
+    : m_index(detail::activityExtraSlotIndex(name, typeid(T)))
+    {}
+
+    /// Return the index of the slot in ActivityExtra objects.
+    auto index() const -> Index
+    {
+        return m_index;
+    }
+
+private:
+    /// The index of the slot in ActivityExtra objects.
+    Index m_index;
+};
+
+/// Used to record which activity models read the data set in ActivityExtra slots by other activity models.
+/// The activity models are identified by indices (e.g., the indices of their phases in a chemical system).
+/// The activity model of a phase can only depend on the state of another phase through these data, so the
+/// recorded accesses determine which phases have chemical properties depending on the state of other phases.
+/// @see ActivityExtra::record
+class ActivityExtraAccesses
+{
+public:
+    /// Record that the activity model with given index set the data in a slot.
+    auto recordWrite(Index slot, Index model) -> void;
+
+    /// Record that the activity model with given index read the data in a slot.
+    auto recordRead(Index slot, Index model) -> void;
+
+    /// Return true if the activity model with index `model` has read data set by the activity model with index `other`.
+    auto dependsOn(Index model, Index other) const -> bool;
+
+    /// Return the number of distinct dependencies among activity models recorded so far.
+    /// Dependencies are never removed, so a change in this number indicates new dependencies.
+    auto numDependencies() const -> Index;
+
+private:
+    /// The index of the activity model that last set the data in each slot (or -1 if none).
+    Vec<long> m_writers;
+
+    /// The recorded dependencies as pairs of indices of an activity model and the activity model whose data it has read.
+    Vec<Pair<Index, Index>> m_dependencies;
+};
+
+/// Used to store extra data produced by activity models that may be reused by subsequent models or other consumers.
+/// The data are accessed via ActivityExtraSlot handles and shared with their
+/// producer (e.g., the activity model that computed them), so that they
+/// remain valid even after the producer no longer holds them (e.g., after the
+/// thread in which an activity model was evaluated has exited).
+class ActivityExtra
+{
+public:
+    /// Construct a default ActivityExtra object.
+    ActivityExtra() = default;
+
+    /// Construct a copy of an ActivityExtra object (its data only, not the recording of its accesses).
+    ActivityExtra(ActivityExtra const& other)
+    : m_data(other.m_data)
+    {}
+
+    /// Assign the data of another ActivityExtra object to this (the recording of accesses of this object is kept).
+    auto operator=(ActivityExtra const& other) -> ActivityExtra&
+    {
+        m_data = other.m_data;
+        return *this;
+    }
+
+    /// Start recording the accesses to the slots of this ActivityExtra object as made by the activity model with given index.
+    /// @param accesses The object in which the accesses are recorded (must outlive the recording).
+    /// @param model The index of the activity model making the accesses until the next call to @ref record or @ref stopRecording.
+    auto record(ActivityExtraAccesses& accesses, Index model) -> void
+    {
+        m_accesses = &accesses;
+        m_model = model;
+    }
+
+    /// Stop recording the accesses to the slots of this ActivityExtra object.
+    auto stopRecording() -> void
+    {
+        m_accesses = nullptr;
+    }
+
+    /// Set the data in a slot of this ActivityExtra object.
+    template<typename T>
+    auto set(ActivityExtraSlot<T> const& slot, SharedPtr<typename ActivityExtraSlot<T>::Type const> const& data) -> void
+    {
+        if(slot.index() >= m_data.size())
+            m_data.resize(slot.index() + 1);
+        m_data[slot.index()] = data;
+        if(m_accesses)
+            m_accesses->recordWrite(slot.index(), m_model);
+    }
+
+    /// Return the data in a slot of this ActivityExtra object or `nullptr` if it has not been set.
+    template<typename T>
+    auto get(ActivityExtraSlot<T> const& slot) const -> T const*
+    {
+        if(m_accesses)
+            m_accesses->recordRead(slot.index(), m_model);
+        return slot.index() < m_data.size() ? static_cast<T const*>(m_data[slot.index()].get()) : nullptr;
+    }
+
+    /// Return true if the data in a slot of this ActivityExtra object has been set.
+    template<typename T>
+    auto has(ActivityExtraSlot<T> const& slot) const -> bool
+    {
+        return get(slot) != nullptr;
+    }
+
+private:
+    /// The shared pointers to the data in each slot indexed by ActivityExtraSlot::index.
+    Vec<SharedPtr<void const>> m_data;
+
+    /// The object in which the accesses to the slots are recorded (`nullptr` if not recording).
+    ActivityExtraAccesses* m_accesses = nullptr;
+
+    /// The index of the activity model making the accesses while recording.
+    Index m_model = 0;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,128 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <thread>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ThreadLocal.hpp>
+#include <Reaktoro/Core/ActivityExtra.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ActivityExtra", "[ActivityExtra]")
+{
+    const ActivityExtraSlot<double> slotA("ActivityExtraTestSlotA");
+    const ActivityExtraSlot<String> slotB("ActivityExtraTestSlotB");
+
+    SECTION("Checking slots are registered once by name")
+    {
+        CHECK( slotA.index() != slotB.index() );
+        CHECK( ActivityExtraSlot<double>("ActivityExtraTestSlotA").index() == slotA.index() );
+        CHECK_THROWS( ActivityExtraSlot<int>("ActivityExtraTestSlotA") );
+    }
+
+    SECTION("Checking data can be set and retrieved via slots")
+    {
+        ActivityExtra extra;
+
+        CHECK( extra.get(slotA) == nullptr );
+        CHECK( extra.get(slotB) == nullptr );
+        CHECK_FALSE( extra.has(slotA) );
+
+        const auto a = std::make_shared<double>(1.0);
+        const auto b = std::make_shared<String>("b");
+
+        extra.set(slotB, b);
+
+        CHECK( extra.get(slotA) == nullptr );
+        CHECK( extra.get(slotB) == b.get() );
+
+        extra.set(slotA, a);
+
+        CHECK( extra.has(slotA) );
+        CHECK( *extra.get(slotA) == 1.0 );
+        CHECK( *extra.get(slotB) == "b" );
+
+        const ActivityExtra copy = extra;
+
+        CHECK( copy.get(slotA) == a.get() );
+        CHECK( copy.get(slotB) == b.get() );
+    }
+
+    SECTION("Checking data remain valid after their producer thread has exited")
+    {
+        ActivityExtra extra;
+
+        // The data produced in the thread are held in thread-local storage, as done in activity models
+        ThreadLocal<SharedPtr<double>> values([] { return std::make_shared<double>(0.0); });
+
+        std::thread producer([&]
+        {
+            auto const& value = values.local();
+            *value = 123.0;
+            extra.set(slotA, value);
+        });
+
+        producer.join();
+
+        REQUIRE( extra.has(slotA) );
+        CHECK( *extra.get(slotA) == 123.0 );
+    }
+
+    SECTION("Checking the accesses of activity models to the slots are recorded")
+    {
+        ActivityExtra extra;
+        ActivityExtraAccesses accesses;
+
+        extra.record(accesses, 0);
+        extra.set(slotA, std::make_shared<double>(1.0));
+        extra.get(slotA); // a model reading its own data does not depend on another model
+
+        extra.record(accesses, 1);
+        extra.get(slotB); // a slot not set by any model does not create a dependency
+
+        CHECK( accesses.numDependencies() == 0 );
+
+        extra.get(slotA);
+
+        extra.record(accesses, 2);
+        extra.set(slotB, std::make_shared<String>("b"));
+
+        extra.stopRecording();
+        extra.get(slotB); // not recorded
+
+        CHECK( accesses.numDependencies() == 1 );
+        CHECK( accesses.dependsOn(1, 0) );
+        CHECK_FALSE( accesses.dependsOn(0, 1) );
+        CHECK_FALSE( accesses.dependsOn(1, 2) );
+
+        // Copies of an ActivityExtra object do not record their accesses
+        const ActivityExtra copy = extra;
+        extra.record(accesses, 3);
+        copy.get(slotA);
+
+        CHECK( accesses.numDependencies() == 1 );
+
+        extra.get(slotB);
+
+        CHECK( accesses.numDependencies() == 2 );
+        CHECK( accesses.dependsOn(3, 2) );
+    }
+}
@@ -17,13 +17,11 @@
 
 #pragma once
 
-// C++ includes
-#include <any>
-
 // Reaktoro includes
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/TypeOp.hpp>
+#include <Reaktoro/Core/ActivityExtra.hpp>
 #include <Reaktoro/Core/Model.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
 
@@ -88,7 +86,7 @@ struct ActivityPropsBase
     TypeOp<StateOfMatter> som;
 
     /// The extra data produced by an activity model that may be reused by subsequent models within a chained activity model.
-    TypeOp<Map<String, Any>> extra;
+    TypeOp<ActivityExtra> extra;
 
     /// Assign a common value to all properties in this ActivityPropsBase object.
     auto operator=(real value) -> ActivityPropsBase&
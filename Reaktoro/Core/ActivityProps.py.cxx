@@ -24,6 +24,10 @@ using namespace Reaktoro;
 
 void exportActivityProps(py::module& m)
 {
+    py::class_<ActivityExtra>(m, "ActivityExtra")
+        .def(py::init<>())
+        ;
+
     py::class_<ActivityProps>(m, "ActivityProps")
         .def(py::init<>())
         .def_readwrite("Vx", &ActivityProps::Vx)
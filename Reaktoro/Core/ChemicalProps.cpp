@@ -26,10 +26,12 @@ using namespace tabulate;
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/AutoDiff.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Core/ChemicalPropsPhase.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/Utils.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelBatch.hpp>
 
 namespace Reaktoro {
 
@@ -83,23 +85,7 @@ auto ChemicalProps::update(ChemicalState const& state) -> void
 
 auto ChemicalProps::update(real const& T0, real const& P0, ArrayXrConstRef n0) -> void
 {
-    mstateid += 1;
-
-    assert(T0 >= 0.0);
-    assert(P0 >= 0.0);
-    assert(n0.size() == n.size() && (n0 >= 0.0).all());
-
-    T = T0;
-    P = P0;
-
-    auto offset = 0;
-    for(auto const& [i, phase] : enumerate(msystem.phases()))
-    {
-        const auto size = phase.species().size();
-        const auto np = n0.segment(offset, size);
-        phasePropsRef(i).update(T, P, np, m_extra);
-        offset += size;
-    }
+    _update<false>(T0, P0, n0);
 }
 
 auto ChemicalProps::update(ArrayXrConstRef data) -> void
@@ -124,23 +110,7 @@ auto ChemicalProps::updateIdeal(ChemicalState const& state) -> void
 
 auto ChemicalProps::updateIdeal(real const& T0, real const& P0, ArrayXrConstRef n0) -> void
 {
-    mstateid += 1;
-
-    assert(T0 >= 0.0);
-    assert(P0 >= 0.0);
-    assert(n0.size() == n.size() && (n0 >= 0.0).all());
-
-    T = T0;
-    P = P0;
-
-    auto offset = 0;
-    for(auto const& [i, phase] : enumerate(msystem.phases()))
-    {
-        const auto size = phase.species().size();
-        const auto np = n0.segment(offset, size);
-        phasePropsRef(i).updateIdeal(T, P, np, m_extra);
-        offset += size;
-    }
+    _update<true>(T0, P0, n0);
 }
 
 auto ChemicalProps::serialize(ArrayStream<real>& stream) const -> void
@@ -165,6 +135,72 @@ auto ChemicalProps::deserialize(const ArrayStream<double>& stream) -> void
     stream.to(T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
+auto ChemicalProps::stripDerivatives() -> void
+{
+    mstateid += 1;
+
+    // Set to zero the derivative value (i.e., the entry at index 1) of each autodiff number in the given arguments
+    auto strip = [](auto&... args)
+    {
+        auto stripone = [](auto& arg)
+        {
+            if constexpr(detail::isArray<decltype(arg)>)
+                for(auto& val : arg) val[1] = 0.0;
+            else arg[1] = 0.0;
+        };
+        (stripone(args), ...);
+    };
+
+    strip(T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
+}
+
+template<bool use_ideal_activity_models>
+auto ChemicalProps::_update(real const& T0, real const& P0, ArrayXrConstRef n0) -> void
+{
+    mstateid += 1;
+
+    assert(T0 >= 0.0);
+    assert(P0 >= 0.0);
+    assert(n0.size() == n.size() && (n0 >= 0.0).all());
+
+    T = T0;
+    P = P0;
+
+    // The cache of standard thermodynamic properties is used only if temperature and pressure carry no derivative information
+    auto const& cache = msystem.standardThermoPropsCache();
+    const auto usecache = cache.enabled() && grad(T) == 0.0 && grad(P) == 0.0;
+    const auto entry = usecache ? cache.find(T.val(), P.val()) : nullptr;
+
+    if(entry)
+    {
+        G0  = entry->G0.cast<real>();
+        H0  = entry->H0.cast<real>();
+        V0  = entry->V0.cast<real>();
+        VT0 = entry->VT0.cast<real>();
+        VP0 = entry->VP0.cast<real>();
+        Cp0 = entry->Cp0.cast<real>();
+    }
+    else msystem.standardThermoModelBatch().eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+
+    auto offset = 0;
+    for(auto const& [i, phase] : enumerate(msystem.phases()))
+    {
+        const auto size = phase.species().size();
+        const auto np = n0.segment(offset, size);
+        auto phaseprops = phasePropsRef(i);
+        m_extra.record(m_extra_accesses, i);
+        if constexpr(use_ideal_activity_models)
+            phaseprops.updateIdealSkipStandardThermoProps(T, P, np, m_extra);
+        else phaseprops.updateSkipStandardThermoProps(T, P, np, m_extra);
+        offset += size;
+    }
+
+    m_extra.stopRecording();
+
+    if(usecache && !entry)
+        cache.insert(T.val(), P.val(), { G0.cast<double>(), H0.cast<double>(), V0.cast<double>(), VT0.cast<double>(), VP0.cast<double>(), Cp0.cast<double>() });
+}
+
 auto ChemicalProps::stateid() const -> Index
 {
     return mstateid;
@@ -214,11 +250,16 @@ auto ChemicalProps::phasePropsRef(StringOrIndex phaseid) -> ChemicalPropsPhaseRe
     });
 }
 
-auto ChemicalProps::extra() const -> const Map<String, Any>&
+auto ChemicalProps::extra() const -> const ActivityExtra&
 {
     return m_extra;
 }
 
+auto ChemicalProps::extraAccesses() const -> ActivityExtraAccesses const&
+{
+    return m_extra_accesses;
+}
+
 auto ChemicalProps::temperature() const -> real
 {
     return T;
@@ -86,6 +86,11 @@ public:
     /// @param stream The array stream containing the serialized chemical properties.
     auto deserialize(const ArrayStream<double>& stream) -> void;
 
+    /// Set to zero the derivative values of the chemical properties without changing their values.
+    /// This is a cheaper alternative to serializing the chemical properties into an array
+    /// stream of double numbers and deserializing them back from it.
+    auto stripDerivatives() -> void;
+
     /// Return the state identification number of this ChemicalProps object.
     /// Each time this ChemicalProps object is updated, its state identification
     /// number (`stateid`) is incremented. This is useful for memorizing
@@ -106,7 +111,13 @@ public:
     auto phaseProps(StringOrIndex phase) const -> ChemicalPropsPhaseConstRef;
 
     /// Return the extra data produced during the evaluation of activity models.
-    auto extra() const -> const Map<String, Any>&;
+    auto extra() const -> const ActivityExtra&;
+
+    /// Return the accesses of the activity models of the phases to the extra data produced by the activity models of other phases.
+    /// The activity models are identified by the indices of their phases. These accesses are recorded in every evaluation of the
+    /// activity models since the construction of this object, and they determine which phases have chemical properties depending
+    /// on the species amounts in other phases (e.g., an ion exchange phase depending on the aqueous phase).
+    auto extraAccesses() const -> ActivityExtraAccesses const&;
 
     /// Return the temperature of the system (in K).
     auto temperature() const -> real;
@@ -559,11 +570,18 @@ private:
     /// The extra data produced during the evaluation of activity models. This
     /// extra data allows the activity model of a phase to reuse calculated
     /// data from the activity model of a previous phase if needed.
-    Map<String, Any> m_extra;
+    ActivityExtra m_extra;
+
+    /// The accesses of the activity models of the phases to the extra data produced by the activity models of other phases.
+    ActivityExtraAccesses m_extra_accesses;
 
     /// Return a mutable view to the chemical properties of a phase with given index.
     /// @param phase The name or index of the phase in the system.
     auto phasePropsRef(StringOrIndex phase) -> ChemicalPropsPhaseRef;
+
+    /// Update the chemical properties of the system (using the cache of standard thermodynamic properties of the system if enabled).
+    template<bool use_ideal_activity_models>
+    auto _update(real const& T, real const& P, ArrayXrConstRef n) -> void;
 };
 
 /// Output a ChemicalProps object to an output stream.
@@ -703,5 +703,100 @@ TEST_CASE("Testing ChemicalProps class", "[ChemicalProps]")
         props.serialize(dstream);
         props.deserialize(dstream);
         CHECK(props.stateid() == 9);
+
+        // Checking stateid with ChemicalProps::stripDerivatives() method
+        props.stripDerivatives();
+        CHECK(props.stateid() == 10);
+    }
+
+    SECTION("Testing the use of the cache of standard thermodynamic properties of the system")
+    {
+        auto const& cache = system.standardThermoPropsCache();
+
+        CHECK( cache.enabled() == false );
+
+        real T = 3.0;
+        real P = 5.0;
+        ArrayXr n = ArrayXr{{ 4.0, 6.0, 5.0 }};
+
+        ChemicalProps expected(system);
+        expected.update(T, P, n);
+
+        CHECK( cache.size() == 0 ); // nothing is stored while the cache is disabled
+
+        cache.setCapacity(2);
+
+        props.update(T, P, n);
+
+        CHECK( cache.size() == 1 );
+        CHECK( cache.misses() == 1 );
+        CHECK( cache.hits() == 0 );
+        CHECK( VectorXd(props) == VectorXd(expected) );
+
+        props.update(T, P, 2.0 * n); // same temperature and pressure, different species amounts
+
+        CHECK( cache.size() == 1 );
+        CHECK( cache.hits() == 1 );
+
+        expected.update(T, P, 2.0 * n);
+
+        CHECK( VectorXd(props) == VectorXd(expected) );
+
+        props.updateIdeal(T, P, n); // ideal activity models also use the cache
+
+        CHECK( cache.hits() == 2 );
+
+        // Check the cache is not used when temperature is seeded for automatic differentiation
+        autodiff::seed(T);
+        props.update(T, P, n);
+        autodiff::unseed(T);
+
+        CHECK( cache.hits() == 2 );
+        CHECK( cache.misses() == 1 );
+        CHECK( grad(props.speciesStandardGibbsEnergies()).isZero() == false );
+
+        // Check the cache is shared among copies of the system
+        ChemicalSystem systemcopy = system;
+        ChemicalProps other(systemcopy);
+        other.update(T, P, n);
+
+        CHECK( &systemcopy.standardThermoPropsCache() == &cache );
+        CHECK( cache.hits() == 3 );
+
+        cache.clear();
+
+        CHECK( cache.size() == 0 );
+        CHECK( cache.hits() == 0 );
+        CHECK( cache.misses() == 0 );
+    }
+
+    SECTION("Testing the removal of derivative values of the chemical properties")
+    {
+        ChemicalState state(system);
+        state.temperature(345.6, "K");
+        state.pressure(1.234, "bar");
+        state.setSpeciesAmounts(0.1234);
+
+        real T = state.temperature();
+        real P = state.pressure();
+        ArrayXr n = state.speciesAmounts();
+
+        autodiff::seed(T);
+
+        ChemicalProps props(system);
+        props.update(T, P, n);
+
+        const VectorXd values = VectorXd(props);
+
+        CHECK( grad(props.temperature()) == 1.0 );
+        CHECK( grad(props.speciesChemicalPotentials()).isZero() == false );
+
+        props.stripDerivatives();
+
+        ArrayStream<real> stream;
+        props.serialize(stream);
+
+        CHECK( grad(ArrayXr(stream)).isZero() );
+        CHECK( VectorXd(props) == values );
     }
 }
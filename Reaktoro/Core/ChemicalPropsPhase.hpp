@@ -21,6 +21,7 @@
 #include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/TypeOp.hpp>
+#include <Reaktoro/Core/ActivityExtra.hpp>
 #include <Reaktoro/Core/Phase.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
 
@@ -216,7 +217,7 @@ public:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra properties evaluated in the activity models
-    auto update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    auto update(const real& T, const real& P, ArrayXrConstRef n, ActivityExtra& extra)
     {
         _update<false>(T, P, n, extra);
     }
@@ -226,11 +227,33 @@ public:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra properties evaluated in the activity models
-    auto updateIdeal(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    auto updateIdeal(const real& T, const real& P, ArrayXrConstRef n, ActivityExtra& extra)
     {
         _update<true>(T, P, n, extra);
     }
 
+    /// Update the chemical properties of the phase except the standard thermodynamic properties of its species.
+    /// This method assumes that the standard thermodynamic properties of the species have already been set for the given temperature and pressure (e.g., from StandardThermoPropsCache).
+    /// @param T The temperature condition (in K)
+    /// @param P The pressure condition (in Pa)
+    /// @param n The amounts of the species in the phase (in mol)
+    /// @param extra The extra properties evaluated in the activity models
+    auto updateSkipStandardThermoProps(const real& T, const real& P, ArrayXrConstRef n, ActivityExtra& extra)
+    {
+        _update<false, false>(T, P, n, extra);
+    }
+
+    /// Update the chemical properties of the phase using ideal activity models except the standard thermodynamic properties of its species.
+    /// This method assumes that the standard thermodynamic properties of the species have already been set for the given temperature and pressure (e.g., from StandardThermoPropsCache).
+    /// @param T The temperature condition (in K)
+    /// @param P The pressure condition (in Pa)
+    /// @param n The amounts of the species in the phase (in mol)
+    /// @param extra The extra properties evaluated in the activity models
+    auto updateIdealSkipStandardThermoProps(const real& T, const real& P, ArrayXrConstRef n, ActivityExtra& extra)
+    {
+        _update<true, false>(T, P, n, extra);
+    }
+
     /// Update the chemical properties of the phase with given data.
     auto updateWithData(const ChemicalPropsPhaseBaseData<TypeOp>& data)
     {
@@ -623,8 +646,8 @@ private:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra data mapped to activity mode
-    template<bool use_ideal_activity_model>
-    auto _update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    template<bool use_ideal_activity_model, bool update_standard_thermo_props = true>
+    auto _update(const real& T, const real& P, ArrayXrConstRef n, ActivityExtra& extra)
     {
         mdata.T = T;
         mdata.P = P;
@@ -668,17 +691,20 @@ private:
         assert(    u.size() == N );
         assert(   Vxi.size() == N );
 
-        // Compute the standard thermodynamic properties of the species in the phase.
-        StandardThermoProps aux;
-        for(auto i = 0; i < N; ++i)
+        // Compute the standard thermodynamic properties of the species in the phase (unless these have been set beforehand).
+        if constexpr(update_standard_thermo_props)
         {
-            aux = species[i].standardThermoProps(T, P);
-            G0[i]  = aux.G0;
-            H0[i]  = aux.H0;
-            V0[i]  = aux.V0;
-            VT0[i] = aux.VT0;
-            VP0[i] = aux.VP0;
-            Cp0[i] = aux.Cp0;
+            StandardThermoProps aux;
+            for(auto i = 0; i < N; ++i)
+            {
+                aux = species[i].standardThermoProps(T, P);
+                G0[i]  = aux.G0;
+                H0[i]  = aux.H0;
+                V0[i]  = aux.V0;
+                VT0[i] = aux.VT0;
+                VP0[i] = aux.VP0;
+                Cp0[i] = aux.Cp0;
+            }
         }
 
         // Compute the amount of the phase
@@ -158,7 +158,7 @@ TEST_CASE("Testing ChemicalPropsPhase class", "[ChemicalPropsPhase]")
         const real Cptot = nsum * Cp;
         const real Cvtot = nsum * Cv;
 
-        Map<String, Any> extra;
+        ActivityExtra extra;
 
         CHECK_NOTHROW( props.update(T, P, n, extra) );
 
@@ -610,7 +610,7 @@ TEST_CASE("Testing ChemicalPropsPhase class", "[ChemicalPropsPhase]")
 
         const ArrayXr n = ArrayXr{{ 0.0, 0.0, 0.0, 0.0 }};
 
-        Map<String, Any> extra;
+        ActivityExtra extra;
 
         CHECK_THROWS( props.update(T, P, n, extra) );
     }
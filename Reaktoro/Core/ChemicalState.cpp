@@ -934,6 +934,11 @@ auto ChemicalState::Equilibrium::optimaState() const -> Optima::State const&
     return pimpl->optstate;
 }
 
+auto ChemicalState::Equilibrium::optimaState() -> Optima::State&
+{
+    return pimpl->optstate;
+}
+
 auto operator<<(std::ostream& out, ChemicalState const& state) -> std::ostream&
 {
     auto const& n = state.speciesAmounts();
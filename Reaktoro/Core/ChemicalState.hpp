@@ -453,6 +453,10 @@ public:
     /// Return the Optima::State object computed as part of the equilibrium calculation.
     auto optimaState() const -> Optima::State const&;
 
+    /// Return the Optima::State object computed as part of the equilibrium calculation.
+    /// This allows an equilibrium solver to update the state in place, without copying it.
+    auto optimaState() -> Optima::State&;
+
 private:
     struct Impl;
 
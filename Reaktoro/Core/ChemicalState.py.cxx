@@ -128,6 +128,7 @@ void exportChemicalState(py::module& m)
         .def("p", &ChemicalState::Equilibrium::p, return_internal_ref)
         .def("q", &ChemicalState::Equilibrium::q, return_internal_ref)
         .def("c", &ChemicalState::Equilibrium::c, return_internal_ref)
-        .def("optimaState", &ChemicalState::Equilibrium::optimaState, return_internal_ref)
+        .def("optimaState", py::overload_cast<>(&ChemicalState::Equilibrium::optimaState, py::const_), return_internal_ref)
+        .def("optimaState", py::overload_cast<>(&ChemicalState::Equilibrium::optimaState), return_internal_ref)
         ;
 }
@@ -18,19 +18,22 @@
 #include "ChemicalSystem.hpp"
 
 // C++ includes
+#include <atomic>
 #include <iostream>
+#include <utility>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Core/Utils.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelBatch.hpp>
 
 namespace Reaktoro {
 namespace detail {
 
 auto computeChemicalSystemID() -> Index
 {
-    static thread_local Index counter = 0;
+    static std::atomic<Index> counter = 0; // atomic so that ids are unique among systems created in different threads
     return counter++;
 }
 
@@ -75,6 +78,12 @@ struct ChemicalSystem::Impl
     /// The stoichiometric matrix of the reactions in the system with respect to its species.
     MatrixXd stoichiometric_matrix;
 
+    /// The cache of standard thermodynamic properties of the species in the system.
+    StandardThermoPropsCache standard_thermo_props_cache;
+
+    /// The standard thermodynamic models of the species in the system grouped for evaluation in batches.
+    StandardThermoModelBatch standard_thermo_model_batch;
+
     /// Construct a default ChemicalSystem::Impl object.
     Impl()
     {}
@@ -101,7 +110,8 @@ struct ChemicalSystem::Impl
     Impl(Database const& database0, PhaseList const& phases0, ReactionList const& reactions0, SurfaceList const& surfaces0)
     : database(database0), phases(phases0), reactions(reactions0), surfaces(surfaces0)
     {
-        errorif(database.species().empty(), "Expecting at least one species in the Database object provided when creating a ChemicalSystem object.");
+        // Do not query all species of a lazy database, which would create all of them
+        errorif(!database.isLazy() && database.species().empty(), "Expecting at least one species in the Database object provided when creating a ChemicalSystem object.");
         errorif(phases.empty(), "Expecting at least one phase when creating a ChemicalSystem object, but none was provided.");
 
         species = phases.species();
@@ -113,6 +123,8 @@ struct ChemicalSystem::Impl
         detail::fixDuplicateNames(species);
         detail::fixDuplicateNames(reactions);
         detail::fixDuplicateNames(surfaces);
+
+        standard_thermo_model_batch = StandardThermoModelBatch(species);
     }
 
     /// Construct a ChemicalSystem::Impl object with given database, phases, reactions, and surfaces.
@@ -198,7 +210,7 @@ auto ChemicalSystem::elements() const -> ElementList const&
 
 auto ChemicalSystem::species(Index index) const -> Species const&
 {
-    return pimpl->species[index];
+    return std::as_const(pimpl->species)[index];
 }
 
 auto ChemicalSystem::species() const -> SpeciesList const&
@@ -208,7 +220,7 @@ auto ChemicalSystem::species() const -> SpeciesList const&
 
 auto ChemicalSystem::phase(Index index) const -> Phase const&
 {
-    return pimpl->phases[index];
+    return std::as_const(pimpl->phases)[index];
 }
 
 auto ChemicalSystem::phases() const -> PhaseList const&
@@ -256,6 +268,16 @@ auto ChemicalSystem::stoichiometricMatrix() const -> MatrixXdConstRef
     return pimpl->stoichiometric_matrix;
 }
 
+auto ChemicalSystem::standardThermoPropsCache() const -> StandardThermoPropsCache const&
+{
+    return pimpl->standard_thermo_props_cache;
+}
+
+auto ChemicalSystem::standardThermoModelBatch() const -> StandardThermoModelBatch const&
+{
+    return pimpl->standard_thermo_model_batch;
+}
+
 auto operator<<(std::ostream& out, ChemicalSystem const& system) -> std::ostream&
 {
     // auto const& phases = system.phases();
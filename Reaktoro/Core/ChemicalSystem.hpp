@@ -33,6 +33,7 @@
 #include <Reaktoro/Core/Reactions.hpp>
 #include <Reaktoro/Core/Species.hpp>
 #include <Reaktoro/Core/SpeciesList.hpp>
+#include <Reaktoro/Core/StandardThermoPropsCache.hpp>
 #include <Reaktoro/Core/Surface.hpp>
 #include <Reaktoro/Core/SurfaceList.hpp>
 #include <Reaktoro/Core/Surfaces.hpp>
@@ -41,6 +42,7 @@ namespace Reaktoro {
 
 // Forward declarations
 class ChemicalSystem;
+class StandardThermoModelBatch;
 
 template<typename T, typename... Ts>
 constexpr auto _arePhaseReactionOrSurfaceConvertible()
@@ -64,6 +66,11 @@ template<typename... Args>
 auto createChemicalSystem(Database const& db, Args const&... args) -> ChemicalSystem;
 
 /// The class used to represent a chemical system and its attributes and properties.
+/// A ChemicalSystem object is immutable once constructed and its copies share the
+/// same underlying data. It is safe to use the same ChemicalSystem object (or its
+/// copies) concurrently from multiple threads, e.g., when evaluating the
+/// properties of different chemical states, because the memoized models of its
+/// phases and species keep separate caches and workspace for each thread.
 /// @see Species, Phase
 /// @ingroup Core
 class ChemicalSystem
@@ -155,6 +162,16 @@ public:
     /// is given by the coefficient of the *i*th species in the *j*th reaction.
     auto stoichiometricMatrix() const -> MatrixXdConstRef;
 
+    /// Return the cache of standard thermodynamic properties of the species in the system.
+    /// This cache is shared among the copies of this ChemicalSystem object and it is
+    /// consulted in ChemicalProps::update to avoid evaluating the standard thermodynamic
+    /// models of the species at temperature and pressure values already seen. It is
+    /// disabled by default; use StandardThermoPropsCache::setCapacity to enable it.
+    auto standardThermoPropsCache() const -> StandardThermoPropsCache const&;
+
+    /// Return the object used to evaluate the standard thermodynamic models of the species in the system in batches.
+    auto standardThermoModelBatch() const -> StandardThermoModelBatch const&;
+
 private:
     struct Impl;
 
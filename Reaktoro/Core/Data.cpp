@@ -28,6 +28,7 @@ using json = nlohmann::json;
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/BinaryIO.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 
 namespace Reaktoro {
@@ -249,6 +250,86 @@ auto convertDataToJson(Data const& data) -> json
     return convertDataTo<json>(data);
 }
 
+// ==========================================================================================
+// METHODS TO CONVERT DATA TO AND FROM BINARY
+// ==========================================================================================
+
+/// The string identifying the binary files written by Data::saveBinary.
+const auto dataBinaryFileMagic = "ReaktoroData";
+
+/// The version of the format of the binary files written by Data::saveBinary.
+const Index dataBinaryFileVersion = 1;
+
+/// The tags identifying the types of the Data objects stored in binary files.
+enum class DataBinaryTag : Index { Null, Boolean, String, Integer, Float, Dict, List };
+
+auto writeDataBinary(BinaryWriter& writer, Data const& data) -> void
+{
+    auto writeTag = [&](DataBinaryTag tag) { writer.writeValue(static_cast<Index>(tag)); };
+
+    if(data.isNull()) writeTag(DataBinaryTag::Null);
+    else if(data.isBoolean()) { writeTag(DataBinaryTag::Boolean); writer.writeValue(data.asBoolean()); }
+    else if(data.isString()) { writeTag(DataBinaryTag::String); writer.writeString(data.asString()); }
+    else if(data.isInteger()) { writeTag(DataBinaryTag::Integer); writer.writeValue(data.asInteger()); }
+    else if(data.isFloat()) { writeTag(DataBinaryTag::Float); writer.writeValue(data.asFloat()); }
+    else if(data.isDict())
+    {
+        writeTag(DataBinaryTag::Dict);
+        writer.writeValue(data.asDict().size());
+        for(auto const& [key, value] : data.asDict())
+        {
+            writer.writeString(key);
+            writeDataBinary(writer, value);
+        }
+    }
+    else if(data.isList())
+    {
+        writeTag(DataBinaryTag::List);
+        writer.writeValue(data.asList().size());
+        for(auto const& value : data.asList())
+            writeDataBinary(writer, value);
+    }
+    else errorif(true, "Could not convert this Data object to binary as the Data object is not in a valid state.");
+}
+
+auto readDataBinary(BinaryReader& reader, String const& path) -> Data
+{
+    const auto tag = static_cast<DataBinaryTag>(reader.readValue<Index>());
+
+    switch(tag)
+    {
+        case DataBinaryTag::Null: return {};
+        case DataBinaryTag::Boolean: return reader.readValue<bool>();
+        case DataBinaryTag::String: return reader.readString();
+        case DataBinaryTag::Integer: return reader.readValue<int>();
+        case DataBinaryTag::Float: return reader.readValue<double>();
+        case DataBinaryTag::Dict:
+        {
+            const auto size = reader.readValue<Index>();
+            errorif(size > reader.remaining() / 8, "The binary file `", path, "` is corrupted (could not read a dictionary with ", size, " entries).");
+            Data data = Dict<String, Data>();
+            for(auto i = 0; i < size; ++i)
+            {
+                auto key = reader.readString();
+                data.add(key, readDataBinary(reader, path));
+            }
+            return data;
+        }
+        case DataBinaryTag::List:
+        {
+            const auto size = reader.readValue<Index>();
+            errorif(size > reader.remaining() / 8, "The binary file `", path, "` is corrupted (could not read a list with ", size, " entries).");
+            Data data = Vec<Data>();
+            for(auto i = 0; i < size; ++i)
+                data.add(readDataBinary(reader, path));
+            return data;
+        }
+    }
+
+    errorif(true, "The binary file `", path, "` is corrupted (unknown type tag ", static_cast<Index>(tag), ").");
+    return {};
+}
+
 // ==========================================================================================
 // CLASS TO ENSURE A COMMON LOCALE IS KEPT WHEN DEALING WITH YAML AND JSON
 // ==========================================================================================
@@ -356,6 +437,20 @@ auto Data::loadYaml(String const& path) -> Data
     return convertYamlToData(doc);
 }
 
+auto Data::loadBinary(String const& path) -> Data
+{
+    BinaryReader reader(path);
+    const String magic = dataBinaryFileMagic;
+    const auto size = reader.remaining() >= 8 ? reader.readValue<Index>() : 0;
+    String str(magic.size(), '\0');
+    if(size == magic.size() && reader.remaining() >= size)
+        reader.readBytes(str.data(), size);
+    errorif(str != magic, "The file `", path, "` is not a binary file written with Data::saveBinary.");
+    const auto version = reader.readValue<Index>();
+    errorif(version != dataBinaryFileVersion, "The binary file `", path, "` has format version ", version, ", but only version ", dataBinaryFileVersion, " is supported. Please regenerate this file from its YAML or JSON source.");
+    return readDataBinary(reader, path);
+}
+
 auto Data::loadJson(String const& path) -> Data
 {
     std::ifstream f(path);
@@ -576,7 +671,7 @@ auto Data::exists(String const& key) const -> bool
 {
     if(!isDict())
         return false;
-    auto obj = asDict();
+    auto const& obj = asDict();
     return obj.find(key) != obj.end();
 }
 
@@ -616,6 +711,14 @@ auto Data::saveJson(String const& filepath) const -> void
     file.close();
 }
 
+auto Data::saveBinary(String const& filepath) const -> void
+{
+    BinaryWriter writer(filepath);
+    writer.writeString(dataBinaryFileMagic);
+    writer.writeValue(dataBinaryFileVersion);
+    writeDataBinary(writer, *this);
+}
+
 auto Data::repr() const -> String
 {
     return dumpYaml();
@@ -15,6 +15,10 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <filesystem>
+#include <fstream>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -705,6 +709,39 @@ TEST_CASE("Testing Data class", "[Data]")
         // CHECK( data.dumpJson() == nlohmann::json::parse(json_testing_string).dump(2) ); // indent=2
     }
 
+    SECTION("Checking saving and loading of Data objects to/from binary files")
+    {
+        const auto path = (std::filesystem::temp_directory_path() / "reaktoro-data-test.rkdata").string();
+
+        Data data1 = Data::parseYaml(yaml_testing_string);
+        data1["Empty"]["List"] = Vec<Data>();
+        data1["Empty"]["Dict"] = Dict<String, Data>();
+        data1["Empty"]["String"] = "";
+        data1["Empty"]["Null"] = nullptr;
+        data1["Boolean"] = true;
+        data1["Integer"] = -123;
+        data1["Float"] = 1.0/3.0;
+
+        data1.saveBinary(path);
+
+        const Data data2 = Data::loadBinary(path);
+
+        CHECK( data2.dumpJson() == data1.dumpJson() );
+        CHECK( data2["Empty"]["List"].isList() );
+        CHECK( data2["Empty"]["Dict"].isDict() );
+        CHECK( data2["Empty"]["String"].asString() == "" );
+        CHECK( data2["Empty"]["Null"].isNull() );
+        CHECK( data2["Boolean"].asBoolean() == true );
+        CHECK( data2["Integer"].asInteger() == -123 );
+        CHECK( data2["Float"].asFloat() == 1.0/3.0 ); // no loss of precision in binary files
+
+        std::ofstream(path) << yaml_testing_string;
+
+        CHECK_THROWS( Data::loadBinary(path) ); // not a binary file written by Data::saveBinary
+
+        std::filesystem::remove(path);
+    }
+
     SECTION("Checking encoding/decoding of custom types to/from Data objects")
     {
         const auto str = R"#(
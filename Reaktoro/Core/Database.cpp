@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <fstream>
+#include <mutex>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
@@ -27,8 +28,20 @@
 #include <Reaktoro/Core/Data.hpp>
 #include <Reaktoro/Core/Embedded.hpp>
 #include <Reaktoro/Core/Support/DatabaseParser.hpp>
+#include <Reaktoro/Serialization/Core.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// A mutex whose copies are new unlocked mutexes, so that it can be a member of a copyable class.
+struct CopyableMutex : std::mutex
+{
+    CopyableMutex() = default;
+    CopyableMutex(CopyableMutex const&) {}
+    auto operator=(CopyableMutex const&) -> CopyableMutex& { return *this; }
+};
+
+} // namespace
 
 struct Database::Impl
 {
@@ -50,6 +63,27 @@ struct Database::Impl
     /// The species in the database grouped in terms of their aggregate state
     Map<AggregateState, SpeciesList> species_with_aggregate_state;
 
+    /// The parser of the database file from which Species objects are created on demand if the database is lazy.
+    Optional<DatabaseParser> parser;
+
+    /// The index in `species` of the Species object of each species record in `parser` (or -1 if not created yet).
+    Indices records_species;
+
+    /// The number of species records in `parser` whose Species objects have not been created yet.
+    Index num_pending_records = 0;
+
+    /// The indices in `species` of the species added with addSpecies in a lazy database (i.e., not created from species records).
+    Indices added_species;
+
+    /// The mutex used to serialize the creation of Species objects in the const methods of a lazy database.
+    CopyableMutex mutex;
+
+    /// Return a lock on `mutex` if the database is lazy, or an empty lock otherwise.
+    auto lock() -> std::unique_lock<std::mutex>
+    {
+        return parser ? std::unique_lock<std::mutex>(mutex) : std::unique_lock<std::mutex>();
+    }
+
     /// Add an element in the database.
     auto addElement(Element const& element) -> void
     {
@@ -117,9 +151,72 @@ struct Database::Impl
         species_with_aggregate_state[newspecies.aggregateState()].push_back(newspecies);
     }
 
+    /// Reserve space for the Species objects still to be created so that references to existing ones remain valid.
+    auto reservePendingSpecies() -> void
+    {
+        species.reserve(species.size() + num_pending_records);
+    }
+
+    /// Create and add the Species object of the species record with given index in a lazy database and return its index in `species`.
+    auto addSpeciesFromRecord(Index irecord) -> Index
+    {
+        if(records_species[irecord] < species.size())
+            return records_species[irecord];
+        addSpecies(parser->createSpecies(irecord));
+        records_species[irecord] = species.size() - 1;
+        --num_pending_records;
+        return records_species[irecord];
+    }
+
+    /// Create and add the Species object of the species record with given name in a lazy database, if any.
+    auto addSpeciesFromRecordWithName(String const& name) -> void
+    {
+        const auto irecord = parser->findSpeciesRecord(name);
+        if(irecord < records_species.size())
+            addSpeciesFromRecord(irecord);
+    }
+
+    /// Create and add the Species objects of all species records in a lazy database.
+    auto addSpeciesFromAllRecords() -> void
+    {
+        if(num_pending_records == 0)
+            return;
+        for(Index i = 0; i < records_species.size(); ++i)
+            addSpeciesFromRecord(i);
+    }
+
+    /// Return the species with given aggregate state whose names and element symbols satisfy a given predicate.
+    template<typename Predicate>
+    auto speciesWithAggregateState(AggregateState option, Predicate const& pred) -> SpeciesList
+    {
+        if(!parser)
+        {
+            const auto it = species_with_aggregate_state.find(option);
+            if(it == species_with_aggregate_state.end())
+                return {};
+            return filter(it->second, RKT_LAMBDA(s, pred(s.name(), s.elements().symbols())));
+        }
+
+        // In a lazy database, select the species records first and create only the Species objects of the selected ones.
+        SpeciesList selected;
+        SpeciesList const& allspecies = species; // use const access so that the lookup tables of `species` are kept
+        auto const& records = parser->speciesRecords();
+        for(auto const irecord : parser->speciesRecordsWithAggregateState(option))
+            if(pred(records[irecord].name, records[irecord].elements))
+                selected.append(allspecies[addSpeciesFromRecord(irecord)]);
+        for(auto const ispecies : added_species)
+            if(allspecies[ispecies].aggregateState() == option && pred(allspecies[ispecies].name(), allspecies[ispecies].elements().symbols()))
+                selected.append(allspecies[ispecies]);
+        return selected;
+    }
+
     /// Construct a reaction with given equation.
-    auto reaction(String const& equation) const -> Reaction
+    auto reaction(String const& equation) -> Reaction
     {
+        if(parser)
+            for(auto const& [name, coeff] : parseReactionEquation(equation))
+                if(species.find(name) == species.size())
+                    addSpeciesFromRecordWithName(name);
         return Reaction().withEquation(ReactionEquation(equation, species));
     }
 };
@@ -129,8 +226,12 @@ Database::Database()
 {}
 
 Database::Database(Database const& other)
-: pimpl(new Impl(*other.pimpl))
-{}
+{
+    auto const lock = other.pimpl->lock();
+    pimpl.reset(new Impl(*other.pimpl));
+    if(pimpl->parser)
+        pimpl->reservePendingSpecies();
+}
 
 Database::Database(Vec<Element> const& elements, Vec<Species> const& species)
 : Database()
@@ -148,6 +249,27 @@ Database::Database(Vec<Species> const& species)
         addSpecies(x);
 }
 
+Database::Database(DatabaseParser const& parser)
+: Database()
+{
+    for(auto const& x : parser.elements())
+        addElement(x);
+
+    if(!parser.isLazy())
+    {
+        for(auto const& x : parser.species())
+            addSpecies(x);
+        return;
+    }
+
+    // Species objects already created by a lazy parser are added only when requested, like the others.
+    const auto num_records = parser.speciesRecords().size();
+    pimpl->parser = parser;
+    pimpl->records_species.resize(num_records, -1);
+    pimpl->num_pending_records = num_records;
+    pimpl->reservePendingSpecies();
+}
+
 Database::~Database()
 {}
 
@@ -169,6 +291,12 @@ auto Database::addElement(Element const& element) -> void
 
 auto Database::addSpecies(Species const& species) -> void
 {
+    if(pimpl->parser)
+    {
+        // Ensure a species in the database file with the same name is added first, as if the database were not lazy.
+        pimpl->addSpeciesFromRecordWithName(species.name());
+        pimpl->added_species.push_back(pimpl->species.size());
+    }
     pimpl->addSpecies(species);
 }
 
@@ -202,17 +330,36 @@ auto Database::elements() const -> ElementList const&
 
 auto Database::species() const -> SpeciesList const&
 {
+    auto const lock = pimpl->lock();
+    pimpl->addSpeciesFromAllRecords();
     return pimpl->species;
 }
 
 auto Database::speciesWithAggregateState(AggregateState option) const -> SpeciesList
 {
+    if(pimpl->parser)
+    {
+        auto const lock = pimpl->lock();
+        return pimpl->speciesWithAggregateState(option, [](auto const& name, auto const& symbols) { return true; });
+    }
     auto it = pimpl->species_with_aggregate_state.find(option);
     if(it == pimpl->species_with_aggregate_state.end())
         return {};
     return it->second;
 }
 
+auto Database::speciesWithAggregateStateAndElements(AggregateState option, StringList const& symbols) const -> SpeciesList
+{
+    auto const lock = pimpl->lock();
+    return pimpl->speciesWithAggregateState(option, [&](auto const& name, auto const& elements) { return contained(elements, symbols); });
+}
+
+auto Database::speciesWithAggregateStateAndNames(AggregateState option, StringList const& names) const -> SpeciesList
+{
+    auto const lock = pimpl->lock();
+    return pimpl->speciesWithAggregateState(option, [&](auto const& name, auto const& elements) { return contains(names, name); });
+}
+
 auto Database::element(String const& symbol) const -> Element const&
 {
     return elements().getWithSymbol(symbol);
@@ -220,20 +367,38 @@ auto Database::element(String const& symbol) const -> Element const&
 
 auto Database::species(String const& name) const -> Species const&
 {
-    return species().getWithName(name);
+    auto const lock = pimpl->lock();
+    if(pimpl->parser && pimpl->species.find(name) == pimpl->species.size())
+        pimpl->addSpeciesFromRecordWithName(name);
+    return pimpl->species.getWithName(name);
 }
 
 auto Database::reaction(String const& equation) const -> Reaction
 {
+    auto const lock = pimpl->lock();
     return pimpl->reaction(equation);
 }
 
+auto Database::isLazy() const -> bool
+{
+    return pimpl->parser.has_value();
+}
+
+auto Database::saveBinary(String const& path) const -> void
+{
+    const Data doc = *this;
+    doc.saveBinary(path);
+}
+
 auto Database::attachedData() const -> Any const&
 {
     return pimpl->attached_data;
 }
 
-auto Database::fromFile(String const& path) -> Database
+namespace {
+
+/// Return the Data object with the contents of a given local database file.
+auto parseDatabaseFile(String const& path) -> Data
 {
     std::ifstream file(path);
     errorif(!file.is_open(),
@@ -243,23 +408,18 @@ auto Database::fromFile(String const& path) -> Database
         "try a full path to the file (e.g., "
         "in Windows, `C:\\User\\username\\mydata\\mydatabase.yaml`, "
         "in Linux and macOS, `/home/username/mydata/mydatabase.yaml`). "
-        "File formats accepted are JSON and YAML and expected file extensions are .json, .yaml, or .yml.");
+        "File formats accepted are JSON, YAML and binary and expected file extensions are .json, .yaml, .yml, or .rkdb.");
+    if(endswith(path, ".rkdb"))
+        return Data::loadBinary(path);
     auto isJson = endswith(path, ".json");
     auto isYaml = endswith(path, ".yaml") || endswith(path, ".yml");
-    errorifnot(isJson || isYaml, "The file `", path, "` must be a JSON or YAML file terminating with .json, .yaml, or .yml.");
-    auto doc = isJson ? Data::parseJson(file) : Data::parseYaml(file);
-    DatabaseParser dbparser(doc);
-    return Database(dbparser);
-}
-
-auto Database::fromEmbeddedFile(String const& path) -> Database
-{
-    const String contents = Embedded::get("databases/reaktoro/" + path);
-    return fromContents(contents);
+    errorifnot(isJson || isYaml, "The file `", path, "` must be a JSON, YAML or binary file terminating with .json, .yaml, .yml, or .rkdb.");
+    return isJson ? Data::parseJson(file) : Data::parseYaml(file);
 }
 
+/// Return the Data object with the contents of a given database text (in YAML or JSON format).
 template<typename Source>
-auto createDatabaseFromContents(Source& contents)
+auto parseDatabaseContents(Source& contents) -> Data
 {
     Data doc;
 
@@ -273,18 +433,52 @@ auto createDatabaseFromContents(Source& contents)
         }
     }
 
-    DatabaseParser dbparser(doc);
+    return doc;
+}
+
+} // namespace
+
+auto Database::fromFile(String const& path) -> Database
+{
+    DatabaseParser dbparser(parseDatabaseFile(path));
+    return Database(dbparser);
+}
+
+auto Database::fromFileLazy(String const& path) -> Database
+{
+    DatabaseParser dbparser(parseDatabaseFile(path), true);
+    return Database(dbparser);
+}
+
+auto Database::fromBinaryFile(String const& path) -> Database
+{
+    DatabaseParser dbparser(Data::loadBinary(path), true);
+    return Database(dbparser);
+}
+
+auto Database::fromEmbeddedFile(String const& path) -> Database
+{
+    const String contents = Embedded::get("databases/reaktoro/" + path);
+    return fromContents(contents);
+}
+
+auto Database::fromEmbeddedFileLazy(String const& path) -> Database
+{
+    const String contents = Embedded::get("databases/reaktoro/" + path);
+    DatabaseParser dbparser(parseDatabaseContents(contents), true);
     return Database(dbparser);
 }
 
 auto Database::fromContents(String const& contents) -> Database
 {
-    return createDatabaseFromContents(contents);
+    DatabaseParser dbparser(parseDatabaseContents(contents));
+    return Database(dbparser);
 }
 
 auto Database::fromStream(std::istream& stream) -> Database
 {
-    return createDatabaseFromContents(stream);
+    DatabaseParser dbparser(parseDatabaseContents(stream));
+    return Database(dbparser);
 }
 
 auto Database::local(String const& path) -> Database
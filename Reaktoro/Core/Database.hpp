@@ -25,6 +25,9 @@
 
 namespace Reaktoro {
 
+// Forward declarations
+class DatabaseParser;
+
 /// The class used to store and retrieve data of chemical species.
 /// @see Element, Species
 /// @ingroup Core
@@ -32,15 +35,42 @@ class Database
 {
 public:
     /// Return a Database object constructed with a given local file.
+    /// The file can be in YAML (`.yaml` or `.yml`), JSON (`.json`) or binary (`.rkdb`) format.
     /// @warning An exception is thrown if `path` does not point to a valid local database file.
     /// @param path The path, including file name, to the local database file.
     static auto fromFile(String const& path) -> Database;
 
+    /// Return a lazy Database object constructed with a given local file.
+    /// The species in the file are indexed by name and aggregate state, but their Species objects
+    /// (with their standard thermodynamic models) are only created when needed, for example, when
+    /// constructing the phases of a ChemicalSystem object. This reduces the time and memory needed
+    /// to load large databases of which only a few species are used.
+    /// @warning An exception is thrown if `path` does not point to a valid local database file.
+    /// @param path The path, including file name, to the local database file.
+    /// @see fromFile
+    static auto fromFileLazy(String const& path) -> Database;
+
+    /// Return a lazy Database object constructed with a given local binary file written with @ref saveBinary.
+    /// Loading a binary database file is much faster than loading its YAML or JSON counterpart, since no text
+    /// parsing is needed. The file is memory mapped where supported, which only avoids an intermediate copy
+    /// of its contents; each process loading the file still constructs its own Database object in memory.
+    /// The returned database is lazy (see @ref fromFileLazy), so the Species objects are only created when needed.
+    /// Use @ref fromFile with the same binary file to create all Species objects at once.
+    /// @warning An exception is thrown if `path` does not point to a valid binary database file.
+    /// @param path The path, including file name, to the local binary database file.
+    static auto fromBinaryFile(String const& path) -> Database;
+
     /// Return a Database object constructed with a given embedded file.
     /// @warning An exception is thrown if `path` does not point to a valid embedded database file.
     /// @param path The path, including file name, to the embedded database file.
     static auto fromEmbeddedFile(String const& path) -> Database;
 
+    /// Return a lazy Database object constructed with a given embedded file.
+    /// @warning An exception is thrown if `path` does not point to a valid embedded database file.
+    /// @param path The path, including file name, to the embedded database file.
+    /// @see fromFileLazy
+    static auto fromEmbeddedFileLazy(String const& path) -> Database;
+
     /// Return a Database object constructed with given database text contents.
     /// @param contents The contents of the database as a string.
     static auto fromContents(String const& contents) -> Database;
@@ -67,6 +97,10 @@ public:
     /// Construct a Database object with given species (elements extracted from them).
     explicit Database(Vec<Species> const& species);
 
+    /// Construct a Database object with the elements and species in a parsed database file.
+    /// If the DatabaseParser object is lazy, the Species objects are created on demand.
+    explicit Database(DatabaseParser const& parser);
+
     /// Destroy this Database object.
     ~Database();
 
@@ -99,11 +133,24 @@ public:
     auto elements() const -> ElementList const&;
 
     /// Return all species in the database.
+    /// @note In a lazy database, this creates all Species objects not created yet.
     auto species() const -> SpeciesList const&;
 
     /// Return all species in the database with given aggregate state.
     auto speciesWithAggregateState(AggregateState option) const -> SpeciesList;
 
+    /// Return all species in the database with given aggregate state and composed only of given elements.
+    /// In a lazy database, only the Species objects of the returned species are created.
+    /// @param option The aggregate state of the species.
+    /// @param symbols The symbols of the elements.
+    auto speciesWithAggregateStateAndElements(AggregateState option, StringList const& symbols) const -> SpeciesList;
+
+    /// Return all species in the database with given aggregate state and with names among given ones.
+    /// In a lazy database, only the Species objects of the returned species are created.
+    /// @param option The aggregate state of the species.
+    /// @param names The names of the species (names not found with given aggregate state are ignored).
+    auto speciesWithAggregateStateAndNames(AggregateState option, StringList const& names) const -> SpeciesList;
+
     /// Return an element with given symbol in the database.
     /// @warning An exception is thrown if no element with given symbol exists.
     auto element(String const& symbol) const -> Element const&;
@@ -116,6 +163,18 @@ public:
     /// @warning An exception is thrown if the reaction has an inexistent species in the database.
     auto reaction(String const& equation) const -> Reaction;
 
+    /// Return true if the Species objects in this database are created on demand.
+    /// The const methods of a lazy Database object may create and store new Species objects. They are
+    /// serialized with a mutex, so that a lazy Database object can be queried from several threads.
+    /// References to Species objects returned earlier remain valid when new ones are created.
+    auto isLazy() const -> bool;
+
+    /// Save this database into a versioned binary file (with elements, species and their model parameters).
+    /// This is the only representation of `.rkdb` files, also used by the `reaktoro-database-converter` utility.
+    /// @param path The path, including file name, of the binary database file (ideally with extension `.rkdb`).
+    /// @see fromBinaryFile
+    auto saveBinary(String const& path) const -> void;
+
     /// Return the attached data to this database whose type is known at runtime only.
     auto attachedData() const -> Any const&;
 
@@ -49,12 +49,19 @@ void exportDatabase(py::module& m)
         .def("elements", &Database::elements)
         .def("species", py::overload_cast<>(&Database::species, py::const_))
         .def("speciesWithAggregateState", &Database::speciesWithAggregateState)
+        .def("speciesWithAggregateStateAndElements", &Database::speciesWithAggregateStateAndElements)
+        .def("speciesWithAggregateStateAndNames", &Database::speciesWithAggregateStateAndNames)
         .def("element", &Database::element, return_internal_ref)
         .def("species", py::overload_cast<const String&>(&Database::species, py::const_), return_internal_ref)
         .def("reaction", &Database::reaction)
+        .def("isLazy", &Database::isLazy)
         .def("attachedData", &Database::attachedData)
+        .def("saveBinary", &Database::saveBinary)
         .def_static("fromFile", &Database::fromFile)
+        .def_static("fromFileLazy", &Database::fromFileLazy)
+        .def_static("fromBinaryFile", &Database::fromBinaryFile)
         .def_static("fromEmbeddedFile", &Database::fromEmbeddedFile)
+        .def_static("fromEmbeddedFileLazy", &Database::fromEmbeddedFileLazy)
         .def_static("fromContents", &Database::fromContents)
         .def_static("fromStream", &Database::fromStream)
         .def_static("local", &Database::local)
@@ -15,6 +15,9 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <filesystem>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -323,3 +326,76 @@ TEST_CASE("Testing Database object creation using Database::fromContents using J
     CHECK(db.species()[0].name() == "Akermanite");
     CHECK(db.species()[0].formula() == "Ca2MgSi2O7");
 }
+
+TEST_CASE("Testing Database object creation using Database::fromBinaryFile", "[Database]")
+{
+    String contents = R"#(
+        Species:
+          Akermanite:
+            Name: Akermanite
+            Formula: Ca2MgSi2O7
+            Elements: 2:Ca 1:Mg 2:Si 7:O
+            AggregateState: Solid
+            StandardThermoModel:
+              MaierKelley:
+                Gf: -3679250.6
+                Hf: -3876463.4
+                Sr: 209.32552
+                Vr: 9.281e-05
+                a: 251.41656
+                b: 0.0476976
+                c: -4769760.0
+                Tmax: 1700.0
+          Quartz:
+            Name: Quartz
+            Formula: SiO2
+            Elements: 1:Si 2:O
+            AggregateState: Solid
+            StandardThermoModel:
+              MaierKelley:
+                Gf: -856238.86
+                Hf: -910699.92
+                Sr: 41.33792
+                Vr: 2.269e-05
+                a: 46.94
+                b: 0.034309
+                c: -1129680.0
+                Tmax: 848.0
+        )#";
+
+    const auto path = (std::filesystem::temp_directory_path() / "reaktoro-database-test.rkdb").string();
+
+    const Database db1 = Database::fromContents(contents);
+
+    db1.saveBinary(path);
+
+    const Database db2 = Database::fromBinaryFile(path);
+    const Database db3 = Database::fromFile(path);
+
+    CHECK( db2.isLazy() );
+    CHECK_FALSE( db3.isLazy() );
+
+    for(auto const& db : { db2, db3 })
+    {
+        REQUIRE( db.elements().size() == db1.elements().size() );
+        REQUIRE( db.species().size() == db1.species().size() );
+
+        for(auto i = 0; i < db1.elements().size(); ++i)
+        {
+            CHECK( db.elements()[i].symbol() == db1.elements()[i].symbol() );
+            CHECK( db.elements()[i].molarMass() == db1.elements()[i].molarMass() );
+        }
+
+        for(auto i = 0; i < db1.species().size(); ++i)
+        {
+            CHECK( db.species()[i].name() == db1.species()[i].name() );
+            CHECK( db.species()[i].formula() == db1.species()[i].formula() );
+            CHECK( db.species()[i].aggregateState() == db1.species()[i].aggregateState() );
+            CHECK( db.species()[i].standardThermoProps(350.0, 10.0e5).G0 == db1.species()[i].standardThermoProps(350.0, 10.0e5).G0 );
+        }
+    }
+
+    std::filesystem::remove(path);
+
+    CHECK_THROWS( Database::fromBinaryFile(path) ); // file no longer exists
+}
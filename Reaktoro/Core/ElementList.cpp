@@ -24,6 +24,23 @@
 
 namespace Reaktoro {
 
+/// The hash tables used to find elements by symbol and name.
+struct ElementList::Lookup
+{
+    /// The index of the first element with each symbol.
+    Map<String, Index> symbols;
+
+    /// The index of the first element with each name.
+    Map<String, Index> names;
+
+    /// Register the element with given index in the lookup tables.
+    auto add(const Element& element, Index i) -> void
+    {
+        symbols.emplace(element.symbol(), i);
+        names.emplace(element.name(), i);
+    }
+};
+
 ElementList::ElementList()
 {}
 
@@ -37,6 +54,7 @@ ElementList::ElementList(const Vec<Element>& elements)
 
 auto ElementList::append(const Element& element) -> void
 {
+    m_lookup.update([&](Lookup& lookup) { lookup.add(element, m_elements.size()); });
     m_elements.push_back(element);
 }
 
@@ -67,12 +85,16 @@ auto ElementList::find(const String& symbol) const -> Index
 
 auto ElementList::findWithSymbol(const String& symbol) const -> Index
 {
-    return indexfn(m_elements, RKT_LAMBDA(e, e.symbol() == symbol));
+    const auto lookup = this->lookup();
+    const auto it = lookup->symbols.find(symbol);
+    return it != lookup->symbols.end() ? it->second : size();
 }
 
 auto ElementList::findWithName(const String& name) const -> Index
 {
-    return indexfn(m_elements, RKT_LAMBDA(e, e.name() == name));
+    const auto lookup = this->lookup();
+    const auto it = lookup->names.find(name);
+    return it != lookup->names.end() ? it->second : size();
 }
 
 auto ElementList::index(const String& symbol) const -> Index
@@ -141,6 +163,7 @@ auto ElementList::withoutTags(const StringList& tags) const -> ElementList
 
 ElementList::operator Vec<Element>&()
 {
+    m_lookup.reset(); // the returned elements may be modified
     return m_elements;
 }
 
@@ -149,6 +172,17 @@ ElementList::operator Vec<Element>const&() const
     return m_elements;
 }
 
+auto ElementList::lookup() const -> SharedPtr<Lookup const>
+{
+    return m_lookup.get([&]
+    {
+        Lookup lookup;
+        for(auto i = 0; i < m_elements.size(); ++i)
+            lookup.add(m_elements[i], i);
+        return lookup;
+    });
+}
+
 auto operator+(const ElementList& a, const ElementList& b) -> ElementList
 {
     return concatenate(a, b);
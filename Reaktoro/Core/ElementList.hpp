@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/LookupIndex.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/Element.hpp>
 
@@ -106,6 +107,15 @@ private:
     /// The elements stored in the list.
     Vec<Element> m_elements;
 
+    /// The hash tables used to find elements by symbol and name.
+    struct Lookup;
+
+    /// The lookup tables of the elements in the list, built on demand and discarded when the list may have changed.
+    LookupIndex<Lookup> m_lookup;
+
+    /// Return the lookup tables of the elements in the list, building them if needed.
+    auto lookup() const -> SharedPtr<Lookup const>;
+
 public:
     /// Construct an ElementList object with given begin and end iterators.
     template<typename InputIterator>
@@ -115,20 +125,20 @@ public:
     auto begin() const { return m_elements.begin(); }
 
     /// Return begin iterator of this ElementList instance (for STL compatibility reasons).
-    auto begin() { return m_elements.begin(); }
+    auto begin() { m_lookup.reset(); return m_elements.begin(); }
 
     /// Return end const iterator of this ElementList instance (for STL compatibility reasons).
     auto end() const { return m_elements.end(); }
 
     /// Return end iterator of this ElementList instance (for STL compatibility reasons).
-    auto end() { return m_elements.end(); }
+    auto end() { m_lookup.reset(); return m_elements.end(); }
 
     /// Append a new Element at the back of the container (for STL compatibility reasons).
     auto push_back(const Element& elements) -> void { append(elements); }
 
     /// Insert a container of Element objects into this ElementList instance (for STL compatibility reasons).
     template<typename Iterator, typename InputIterator>
-    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_elements.insert(pos, begin, end); }
+    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_lookup.reset(); m_elements.insert(pos, begin, end); }
 
     /// The type of the value stored in a ElementList (for STL compatibility reasons).
     using value_type = Element;
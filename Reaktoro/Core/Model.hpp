@@ -162,6 +162,22 @@ public:
         return m_params;
     }
 
+    /// Return a copy of this Model function object with the parameters of the underlying model function as given to it.
+    /// Unlike the parameters in @ref params, which are stored as `double` numbers in a Data object, these parameters are
+    /// kept intact (e.g., with their derivative seeds), so that they can be used to evaluate the model in other ways.
+    auto withOriginalParams(Any const& params) const -> Model
+    {
+        Model copy = *this;
+        copy.m_originalparams = params;
+        return copy;
+    }
+
+    /// Return the parameters of the underlying model function as given to it (empty if not set with @ref withOriginalParams).
+    auto originalParams() const -> Any const&
+    {
+        return m_originalparams;
+    }
+
     /// Return a constant Model function object.
     /// @param param The parameter with the constant value always returned by the Model function object.
     static auto Constant(String const& name, real const& value) -> Model
@@ -181,6 +197,9 @@ private:
 
     /// The parameters of the underlying model function.
     Data m_params;
+
+    /// The parameters of the underlying model function as given to it.
+    Any m_originalparams;
 };
 
 /// Return a reaction thermodynamic model resulting from chaining other models.
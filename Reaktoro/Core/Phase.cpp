@@ -17,6 +17,9 @@
 
 #include "Phase.hpp"
 
+// C++ includes
+#include <utility>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
@@ -143,7 +146,7 @@ auto Phase::species() const -> const SpeciesList&
 
 auto Phase::species(Index idx) const -> const Species&
 {
-    return pimpl->species[idx];
+    return std::as_const(pimpl->species)[idx];
 }
 
 auto Phase::speciesMolarMasses() const -> ArrayXdConstRef
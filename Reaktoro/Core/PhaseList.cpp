@@ -25,6 +25,28 @@
 
 namespace Reaktoro {
 
+/// The hash tables used to find phases by name and by the names and indices of their species.
+struct PhaseList::Lookup
+{
+    /// The index of the first phase with each name.
+    Map<String, Index> names;
+
+    /// The index of the first phase containing a species with each name.
+    Map<String, Index> species;
+
+    /// The number of species over all phases up to each phase (with one more entry for the total number of species).
+    Indices offsets = { 0 };
+
+    /// Register the phase with given index in the lookup tables.
+    auto add(const Phase& phase, Index i) -> void
+    {
+        names.emplace(phase.name(), i);
+        for(const auto& s : phase.species())
+            species.emplace(s.name(), i);
+        offsets.push_back(offsets.back() + phase.species().size());
+    }
+};
+
 PhaseList::PhaseList()
 {}
 
@@ -38,6 +60,7 @@ PhaseList::PhaseList(const Vec<Phase>& phases)
 
 auto PhaseList::append(const Phase& phase) -> void
 {
+    m_lookup.update([&](Lookup& lookup) { lookup.add(phase, m_phases.size()); });
     m_phases.push_back(phase);
 }
 
@@ -75,6 +98,7 @@ auto PhaseList::operator[](Index i) const -> const Phase&
 
 auto PhaseList::operator[](Index i) -> Phase&
 {
+    m_lookup.reset(); // the returned phase may be modified
     return m_phases[i];
 }
 
@@ -85,23 +109,24 @@ auto PhaseList::find(const String& name) const -> Index
 
 auto PhaseList::findWithName(const String& name) const -> Index
 {
-    return indexfn(m_phases, RKT_LAMBDA(p, p.name() == name));
+    const auto lookup = this->lookup();
+    const auto it = lookup->names.find(name);
+    return it != lookup->names.end() ? it->second : size();
 }
 
 auto PhaseList::findWithSpecies(Index index) const -> Index
 {
-    auto counter = 0;
-    for(auto i = 0; i < size(); ++i) {
-        counter += m_phases[i].species().size();
-        if(counter > index)
-            return i;
-    }
-    return size();
+    const auto lookup = this->lookup();
+    const auto& offsets = lookup->offsets;
+    const auto it = std::upper_bound(offsets.begin(), offsets.end(), index); // the first phase whose species come after the given one
+    return it != offsets.end() ? it - offsets.begin() - 1 : size();
 }
 
 auto PhaseList::findWithSpecies(const String& name) const -> Index
 {
-    return indexfn(m_phases, RKT_LAMBDA(p, containsfn(p.species(), RKT_LAMBDA(s, s.name() == name))));
+    const auto lookup = this->lookup();
+    const auto it = lookup->species.find(name);
+    return it != lookup->species.end() ? it->second : size();
 }
 
 auto PhaseList::findWithAggregateState(AggregateState option) const -> Index
@@ -181,10 +206,7 @@ auto PhaseList::withAggregateState(AggregateState option) const -> PhaseList
 
 auto PhaseList::numSpeciesUntilPhase(Index iphase) const -> Index
 {
-    auto sum = 0;
-    for(auto i = 0; i < iphase; ++i)
-        sum += m_phases[i].species().size();
-    return sum;
+    return lookup()->offsets[iphase];
 }
 
 auto PhaseList::indicesPhasesArePure() const -> Indices
@@ -249,6 +271,7 @@ auto PhaseList::indicesSpeciesInPhases(const Indices& iphases) const -> Indices
 
 PhaseList::operator Vec<Phase>&()
 {
+    m_lookup.reset(); // the returned phases may be modified
     return m_phases;
 }
 
@@ -257,6 +280,17 @@ PhaseList::operator Vec<Phase>const&() const
     return m_phases;
 }
 
+auto PhaseList::lookup() const -> SharedPtr<Lookup const>
+{
+    return m_lookup.get([&]
+    {
+        Lookup lookup;
+        for(auto i = 0; i < m_phases.size(); ++i)
+            lookup.add(m_phases[i], i);
+        return lookup;
+    });
+}
+
 auto operator+(const PhaseList& a, const PhaseList& b) -> PhaseList
 {
     return concatenate(a, b);
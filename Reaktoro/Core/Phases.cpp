@@ -22,6 +22,33 @@
 #include <Reaktoro/Common/ParseUtils.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// Return the species in a database with given aggregate states that have given names or, if no names are given, that are composed only of given elements.
+/// Only the Species objects of the selected species are created if the database is lazy.
+auto selectSpecies(const Database& db, AggregateState aggregatestate, const Vec<AggregateState>& other_aggregate_states, const Strings& names, const Strings& symbols) -> SpeciesList
+{
+    const auto select = [&](AggregateState option)
+    {
+        return names.size() ?
+            db.speciesWithAggregateStateAndNames(option, names) :
+            db.speciesWithAggregateStateAndElements(option, symbols);
+    };
+
+    auto species = select(aggregatestate);
+
+    // If additional aggregate states provided, consider also other species in the database
+    for(auto other_aggregate_state : other_aggregate_states)
+    {
+        auto other_species = select(other_aggregate_state);
+        if(other_species.size())
+            species = concatenate(species, other_species);
+    }
+
+    return species;
+}
+
+} // namespace
 
 auto speciate(StringList const& substances) -> Speciate
 {
@@ -163,20 +190,11 @@ auto GeneralPhase::convert(const Database& db, const Strings& elements) const ->
         "GeneralPhase::convert requires an AggregateState value to be specified.\n"
         "Use method GeneralPhase::setAggregateState to fix this.");
 
-    auto species = db.speciesWithAggregateState(aggregatestate);
+    auto species = selectSpecies(db, aggregatestate, other_aggregate_states, names, symbols.size() ? symbols : elements);
 
-    // If additional aggregate states provided, consider also other species in the database
-    for(auto other_aggregate_state : other_aggregate_states)
-    {
-        auto other_species = db.speciesWithAggregateState(other_aggregate_state);
-        if(other_species.size())
-            species = concatenate(species, other_species);
-    }
-
-    species =
-        names.size() ? species.withNames(names) :
-        symbols.size() ? species.withElements(symbols) :
-            species.withElements(elements);
+    // Ensure the selected species follow the order of the given names, if any
+    if(names.size())
+        species = species.withNames(names);
 
     // Filter out species with provided tags in the exclude function
     if(excludetags.size())
@@ -303,20 +321,11 @@ auto GeneralPhasesGenerator::convert(const Database& db, const Strings& elements
         "GeneralPhasesGenerator::convert requires an AggregateState value to be specified. "
         "Use method GeneralPhasesGenerator::set(AggregateState) to fix this.");
 
-    auto species = db.speciesWithAggregateState(aggregatestate);
-
-    // If additional aggregate states provided, consider also other species in the database
-    for(auto other_aggregate_state : other_aggregate_states)
-    {
-        auto other_species = db.speciesWithAggregateState(other_aggregate_state);
-        if(other_species.size())
-            species = concatenate(species, other_species);
-    }
+    auto species = selectSpecies(db, aggregatestate, other_aggregate_states, names, symbols.size() ? symbols : elements);
 
-    species =
-        names.size() ? species.withNames(names) :
-        symbols.size() ? species.withElements(symbols) :
-            species.withElements(elements);
+    // Ensure the selected species follow the order of the given names, if any
+    if(names.size())
+        species = species.withNames(names);
 
     // Filter out species with provided tags in the exclude function
     if(excludetags.size())
@@ -384,7 +393,7 @@ auto Phases::convert() const -> Vec<Phase>
             if(phase.elements().size())
                 result = merge(result, phase.elements());
             if(phase.species().size())
-                for(auto&& s : db.species().withNames(phase.species()))
+                for(auto&& s : selectSpecies(db, phase.aggregateState(), phase.additionalAggregateStates(), phase.species(), {}))
                     result = merge(result, s.elements().symbols());
             if(phase.aggregateState() == AggregateState::Aqueous)
                 result = merge(result, Strings{"H", "O"}); // ensure both H and O are considered in case there is aqueous phases
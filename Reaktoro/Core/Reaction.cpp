@@ -37,6 +37,9 @@ struct Reaction::Impl
     /// The function that computes the rate of the reaction (in mol/s).
     ReactionRateModel ratemodel;
 
+    /// The names of the phases on which the rate of the reaction depends (empty if it depends on all phases).
+    Strings ratedeps;
+
     /// Construct a default Reaction::Impl object
     Impl()
     {
@@ -104,6 +107,13 @@ auto Reaction::withRateModel(ReactionRateModel const& model) const -> Reaction
     return copy;
 }
 
+auto Reaction::withRateDependencies(Strings const& phases) const -> Reaction
+{
+    Reaction copy = clone();
+    copy.pimpl->ratedeps = phases;
+    return copy;
+}
+
 auto Reaction::name() const -> String
 {
     return pimpl->name;
@@ -119,6 +129,11 @@ auto Reaction::rateModel() const -> ReactionRateModel const&
     return pimpl->ratemodel;
 }
 
+auto Reaction::rateDependencies() const -> Strings const&
+{
+    return pimpl->ratedeps;
+}
+
 auto Reaction::props(real T, real P) const -> ReactionThermoProps
 {
     return pimpl->props(T, P);
@@ -56,6 +56,14 @@ public:
     /// Return a duplicate of this Reaction object with new reaction rate model.
     auto withRateModel(ReactionRateModel const& model) const -> Reaction;
 
+    /// Return a duplicate of this Reaction object with new names of the phases on which its rate depends.
+    /// The rate of the reaction is assumed to depend only on the amounts of the species in these phases
+    /// (and in the phases whose chemical properties are coupled with them, e.g., an ion exchange phase
+    /// coupled with an aqueous phase). This permits the Jacobian of the reaction rates with respect to
+    /// species amounts to be assembled sparsely in kinetics calculations. If no phases are given, the
+    /// rate of the reaction is assumed to depend on the amounts of all species in the system.
+    auto withRateDependencies(Strings const& phases) const -> Reaction;
+
     /// Return the name of the reaction.
     auto name() const -> String;
 
@@ -65,6 +73,9 @@ public:
     /// Return the rate model of the reaction.
     auto rateModel() const -> ReactionRateModel const&;
 
+    /// Return the names of the phases on which the rate of the reaction depends (empty if it depends on all phases).
+    auto rateDependencies() const -> Strings const&;
+
     /// Calculate the complete set of thermodynamic properties of the reaction.
     /// @param T The temperature for the calculation (in K)
     /// @param P The pressure for the calculation (in Pa)
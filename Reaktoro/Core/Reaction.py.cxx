@@ -31,9 +31,11 @@ void exportReaction(py::module& m)
         .def("withName", &Reaction::withName)
         .def("withEquation", &Reaction::withEquation)
         .def("withRateModel", &Reaction::withRateModel)
+        .def("withRateDependencies", &Reaction::withRateDependencies)
         .def("name", &Reaction::name)
         .def("equation", &Reaction::equation)
         .def("rateModel", &Reaction::rateModel)
+        .def("rateDependencies", &Reaction::rateDependencies)
         .def("props", py::overload_cast<real, real>(&Reaction::props, py::const_))
         .def("props", py::overload_cast<real, Chars, real, Chars>(&Reaction::props, py::const_))
         .def("rate", &Reaction::rate)
@@ -46,6 +46,12 @@ TEST_CASE("Testing Reaction class", "[Reaction]")
     REQUIRE( reaction.equation().coefficient("Ca++") == 1 );
     REQUIRE( reaction.equation().coefficient("CO3--") == 1 );
     REQUIRE( reaction.rateModel().initialized() );
+    REQUIRE( reaction.rateDependencies().empty() );
+
+    reaction = reaction.withRateDependencies({ "AqueousPhase", "Dolomite" });
+
+    REQUIRE( reaction.rateDependencies() == Strings{ "AqueousPhase", "Dolomite" } );
+    REQUIRE( reaction.name() == "Dolomite" );
 
     //-------------------------------------------------------------------------
     // TESTING METHOD: Reaction::props
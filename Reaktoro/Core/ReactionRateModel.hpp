@@ -60,6 +60,13 @@ struct ReactionRateModelGeneratorArgs
 
     /// The surfaces in the chemical system where the reaction belongs to.
     SurfaceList const& surfaces;
+
+    /// The names of the phases on which the rate of the reaction depends.
+    /// A ReactionRateModelGenerator can append to this list the names of the
+    /// phases whose properties are used by the generated ReactionRateModel.
+    /// These are used as the rate dependencies of the reaction unless these
+    /// have been explicitly set with GeneralReaction::setRateDependencies.
+    Strings& dependencies;
 };
 
 /// The function signature for functions that generates a ReactionRateModel for a reaction.
@@ -18,6 +18,7 @@
 #include "Reactions.hpp"
 
 // Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Core/ReactionEquation.hpp>
 
 namespace Reaktoro {
@@ -62,6 +63,12 @@ auto GeneralReaction::set(ReactionRateModelGenerator const& model_generator) ->
     return setRateModel(model_generator);
 }
 
+auto GeneralReaction::setRateDependencies(StringList const& phases) -> GeneralReaction&
+{
+    rate_dependencies = phases;
+    return *this;
+}
+
 auto GeneralReaction::name() const -> String const&
 {
     return reaction_name;
@@ -82,6 +89,11 @@ auto GeneralReaction::rateModelGenerator() const -> ReactionRateModelGenerator
     return rate_model_generator;
 }
 
+auto GeneralReaction::rateDependencies() const -> Strings const&
+{
+    return rate_dependencies;
+}
+
 auto GeneralReaction::operator()(ReactionGeneratorArgs args) const -> Reaction
 {
     // Ensure reaction name, equation, and rate model are given at the time of conversion
@@ -93,6 +105,9 @@ auto GeneralReaction::operator()(ReactionGeneratorArgs args) const -> Reaction
     // Construct the ReactionEquation object from string representation in `reaction_equation`
     ReactionEquation reaction_equation_obj(reaction_equation, args.species);
 
+    // The names of the phases on which the reaction rate depends as declared by the reaction rate model generator, if any
+    Strings generated_dependencies;
+
     // Collect the necessary data for reaction rate model generator.
     ReactionRateModelGeneratorArgs rargs{
         reaction_name,
@@ -101,16 +116,21 @@ auto GeneralReaction::operator()(ReactionGeneratorArgs args) const -> Reaction
         args.species,
         args.phases,
         args.surfaces,
+        generated_dependencies,
     };
 
     // Resolve the reaction rate model of the reaction, either given or to be generated from a reaction rate model generator
     auto reaction_rate_model = rate_model ? rate_model : rate_model_generator(rargs);
 
+    // Resolve the rate dependencies of the reaction, giving preference to those explicitly set with GeneralReaction::setRateDependencies
+    auto const& reaction_rate_dependencies = rate_dependencies.empty() ? unique(generated_dependencies) : rate_dependencies;
+
     // Return the fully specified Reaction object
     return Reaction()
         .withName(reaction_name)
         .withEquation(reaction_equation_obj)
-        .withRateModel(reaction_rate_model);
+        .withRateModel(reaction_rate_model)
+        .withRateDependencies(reaction_rate_dependencies);
 }
 
 Reactions::Reactions()
@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Common/TraitsUtils.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/Reaction.hpp>
@@ -93,6 +94,17 @@ public:
     /// Set the reaction rate model generator of the reaction (equivalent to GeneralReaction::setRateModel).
     auto set(ReactionRateModelGenerator const& model_generator) -> GeneralReaction&;
 
+    /// Set the names of the phases on which the rate of the reaction depends.
+    /// Use this method to declare that the reaction rate model uses only the
+    /// chemical properties of the given phases (e.g., `"AqueousPhase Calcite"`
+    /// for a mineral reaction whose rate depends on the aqueous solution and
+    /// on the amount of the mineral). This permits the Jacobian of the rate with
+    /// respect to species amounts to be assembled sparsely in kinetics calculations.
+    /// If not set, the phases declared by the reaction rate model generator, if
+    /// any, are used instead (see ReactionRateModelGeneratorArgs::dependencies).
+    /// @see Reaction::withRateDependencies
+    auto setRateDependencies(StringList const& phases) -> GeneralReaction&;
+
     /// Return the name of the reaction.
     auto name() const -> String const&;
 
@@ -105,6 +117,9 @@ public:
     /// Return the reaction rate model generator of the reaction.
     auto rateModelGenerator() const -> ReactionRateModelGenerator const&;
 
+    /// Return the names of the phases on which the rate of the reaction depends (empty if it depends on all phases).
+    auto rateDependencies() const -> Strings const&;
+
     /// Convert this GeneralReaction object into a Reaction object.
     auto operator()(ReactionGeneratorArgs args) const -> Reaction;
 
@@ -120,6 +135,9 @@ private:
 
     /// The rate model generator of the reaction.
     ReactionRateModelGenerator rate_model_generator;
+
+    /// The names of the phases on which the rate of the reaction depends.
+    Strings rate_dependencies;
 };
 
 /// Used to represent a collection of reactions controlled kinetically.
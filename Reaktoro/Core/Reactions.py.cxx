@@ -68,10 +68,12 @@ void exportReactions(py::module& m)
         .def("setEquation", &GeneralReaction::setEquation, return_internal_ref, "Set the equation of the reaction as a formatted string.")
         .def("setRateModel", setRateModel, return_internal_ref, "Set a reaction rate model or a reaction rate model generator for the reaction using a Python function.")
         .def("set", setRateModel, return_internal_ref, "Set a reaction rate model or a reaction rate model generator for the reaction using a Python function (equvalent to GeneralReaction.setRateModel).")
+        .def("setRateDependencies", &GeneralReaction::setRateDependencies, return_internal_ref, "Set the names of the phases on which the rate of the reaction depends.")
         .def("name", &GeneralReaction::name, return_internal_ref, "Return the name of the reaction.")
         .def("equation", &GeneralReaction::equation, return_internal_ref, "Return the reaction equation of the reaction.")
         .def("rateModel", &GeneralReaction::rateModel, return_internal_ref, "Return the reaction rate model of the reaction.")
         .def("rateModelGenerator", &GeneralReaction::rateModelGenerator, return_internal_ref, "Return the reaction rate model generator of the reaction.")
+        .def("rateDependencies", &GeneralReaction::rateDependencies, return_internal_ref, "Return the names of the phases on which the rate of the reaction depends.")
         .def("convert", &GeneralReaction::operator(), "Convert this GeneralReaction object into a Reaction object.") // NOTE: Do not use __call__ here because pybind11 will gladly cast a Python GeneralReaction object to a std::function of any type without any runtime errors! When checking if an argument in a ChemicalSystem constructor is of type ReactionGenerator or SurfaceGenerator (both objects of class std::function), the Python GeneralReaction object will be sucessfully converted, which is not expected.
         ;
 
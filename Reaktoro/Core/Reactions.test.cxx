@@ -19,6 +19,7 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Core/Database.hpp>
@@ -124,3 +125,30 @@ TEST_CASE("Testing Reactions class", "[Reactions]")
     checkReactionsConversion(reactionsA);
     checkReactionsConversion(reactionsB);
 }
+
+TEST_CASE("Testing rate dependencies declared by a ReactionRateModelGenerator", "[Reactions]")
+{
+    ChemicalSystem system = test::createChemicalSystem();
+
+    ReactionGeneratorArgs args{ system.database(), system.species(), system.phases(), system.surfaces() };
+
+    const auto aqueousphase = system.phases()[0].name();
+    const auto gaseousphase = system.phases()[1].name();
+
+    ReactionRateModelGenerator generator = [=](ReactionRateModelGeneratorArgs args) -> ReactionRateModel
+    {
+        args.dependencies.push_back(gaseousphase);
+        args.dependencies.push_back(aqueousphase);
+        args.dependencies.push_back(gaseousphase);
+        return test::createReactionRateModel(1.0);
+    };
+
+    GeneralReaction reaction("CO2(g) = CO2(aq)");
+    reaction.setRateModel(generator);
+
+    CHECK( reaction(args).rateDependencies() == unique(Strings{ aqueousphase, gaseousphase }) );
+
+    reaction.setRateDependencies(Strings{ gaseousphase });
+
+    CHECK( reaction(args).rateDependencies() == Strings{ gaseousphase } );
+}
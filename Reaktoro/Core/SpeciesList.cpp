@@ -17,6 +17,9 @@
 
 #include "SpeciesList.hpp"
 
+// C++ includes
+#include <cstdio>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
@@ -25,6 +28,88 @@
 #include <Reaktoro/Core/ChemicalFormula.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// Return a key that is the same for equivalent chemical formulas (i.e., same elements, coefficients and charge).
+auto formulaKey(const ChemicalFormula& formula) -> String
+{
+    // Print numbers exactly (in hexadecimal notation), with -0.0 printed as 0.0, so that equal numbers produce equal keys
+    const auto str = [](double x)
+    {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%a", x == 0.0 ? 0.0 : x);
+        return String(buffer);
+    };
+
+    auto elements = formula.elements();
+    std::sort(elements.begin(), elements.end());
+
+    String key;
+    for(const auto& [symbol, coeff] : elements)
+        key += symbol + ":" + str(coeff) + " ";
+    return key + "|" + str(formula.charge());
+}
+
+} // namespace
+
+/// The hash tables used to find species by name and substance.
+struct SpeciesList::NameLookup
+{
+    /// The index of the first species with each name.
+    Map<String, Index> names;
+
+    /// The index of the first species with each substance name.
+    Map<String, Index> substances;
+
+    /// Register the species with given index in the lookup tables.
+    auto add(const Species& species, Index i) -> void
+    {
+        names.emplace(species.name(), i);
+        substances.emplace(species.substance(), i);
+    }
+};
+
+/// The hash table used to find species by formula.
+struct SpeciesList::FormulaLookup
+{
+    /// The index of the first species with each formula (keyed by a string common to equivalent formulas).
+    Map<String, Index> formulas;
+
+    /// Register the species with given index in the lookup table.
+    auto add(const Species& species, Index i) -> void
+    {
+        formulas.emplace(formulaKey(species.formula()), i);
+    }
+};
+
+/// The hash table used to find species by tag.
+struct SpeciesList::TagLookup
+{
+    /// The indices of the species with each tag.
+    Map<String, Indices> tags;
+
+    /// Register the species with given index in the lookup table.
+    auto add(const Species& species, Index i) -> void
+    {
+        for(const auto& tag : species.tags())
+            if(auto& indices = tags[tag]; indices.empty() || indices.back() != i)
+                indices.push_back(i);
+    }
+};
+
+namespace {
+
+/// Return the lookup table of type `Lookup` with all given species registered in it.
+template<typename Lookup>
+auto buildLookup(const Vec<Species>& species) -> Lookup
+{
+    Lookup lookup;
+    for(auto i = 0; i < species.size(); ++i)
+        lookup.add(species[i], i);
+    return lookup;
+}
+
+} // namespace
 
 SpeciesList::SpeciesList()
 {}
@@ -43,9 +128,18 @@ SpeciesList::SpeciesList(const StringList& formulas)
 
 auto SpeciesList::append(const Species& species) -> void
 {
+    const auto i = m_species.size();
+    m_namelookup.update([&](NameLookup& lookup) { lookup.add(species, i); });
+    m_formulalookup.update([&](FormulaLookup& lookup) { lookup.add(species, i); });
+    m_taglookup.update([&](TagLookup& lookup) { lookup.add(species, i); });
     m_species.push_back(species);
 }
 
+auto SpeciesList::reserve(Index size) -> void
+{
+    m_species.reserve(size);
+}
+
 auto SpeciesList::data() const -> const Vec<Species>&
 {
     return m_species;
@@ -80,6 +174,7 @@ auto SpeciesList::operator[](Index i) const -> const Species&
 
 auto SpeciesList::operator[](Index i) -> Species&
 {
+    resetLookup(); // the returned species may be modified
     return m_species[i];
 }
 
@@ -90,17 +185,23 @@ auto SpeciesList::find(const String& name) const -> Index
 
 auto SpeciesList::findWithName(const String& name) const -> Index
 {
-    return indexfn(m_species, RKT_LAMBDA(s, s.name() == name));
+    const auto lookup = nameLookup();
+    const auto it = lookup->names.find(name);
+    return it != lookup->names.end() ? it->second : size();
 }
 
 auto SpeciesList::findWithFormula(const ChemicalFormula& formula) const -> Index
 {
-    return indexfn(m_species, RKT_LAMBDA(s, formula.equivalent(s.formula())));
+    const auto lookup = formulaLookup();
+    const auto it = lookup->formulas.find(formulaKey(formula));
+    return it != lookup->formulas.end() ? it->second : size();
 }
 
 auto SpeciesList::findWithSubstance(const String& substance) const -> Index
 {
-    return indexfn(m_species, RKT_LAMBDA(s, s.substance() == substance));
+    const auto lookup = nameLookup();
+    const auto it = lookup->substances.find(substance);
+    return it != lookup->substances.end() ? it->second : size();
 }
 
 auto SpeciesList::index(const String& name) const -> Index
@@ -178,7 +279,11 @@ auto SpeciesList::withTag(String tag) const -> SpeciesList
 {
     if(tag.empty())
         return {};
-    return filter(m_species, RKT_LAMBDA(s, contains(s.tags(), tag)));
+    const auto lookup = tagLookup();
+    const auto it = lookup->tags.find(tag);
+    if(it == lookup->tags.end())
+        return {};
+    return vectorize(it->second, RKT_LAMBDA(i, m_species[i]));
 }
 
 auto SpeciesList::withoutTag(String tag) const -> SpeciesList
@@ -192,7 +297,15 @@ auto SpeciesList::withTags(const StringList& tags) const -> SpeciesList
 {
     if(tags.empty())
         return {};
-    return filter(m_species, RKT_LAMBDA(s, contained(tags, s.tags())));
+    const auto lookup = tagLookup();
+    const auto it = lookup->tags.find(tags[0]); // only the species with the first tag need to be checked
+    if(it == lookup->tags.end())
+        return {};
+    Vec<Species> species;
+    for(auto i : it->second)
+        if(contained(tags, m_species[i].tags()))
+            species.push_back(m_species[i]);
+    return species;
 }
 
 auto SpeciesList::withoutTags(const StringList& tags) const -> SpeciesList
@@ -217,6 +330,7 @@ auto SpeciesList::withElementsOf(const StringList& formulas) const -> SpeciesLis
 
 SpeciesList::operator Vec<Species>&()
 {
+    resetLookup(); // the returned species may be modified
     return m_species;
 }
 
@@ -225,6 +339,28 @@ SpeciesList::operator const Vec<Species>&() const
     return m_species;
 }
 
+auto SpeciesList::nameLookup() const -> SharedPtr<NameLookup const>
+{
+    return m_namelookup.get([&] { return buildLookup<NameLookup>(m_species); });
+}
+
+auto SpeciesList::formulaLookup() const -> SharedPtr<FormulaLookup const>
+{
+    return m_formulalookup.get([&] { return buildLookup<FormulaLookup>(m_species); });
+}
+
+auto SpeciesList::tagLookup() const -> SharedPtr<TagLookup const>
+{
+    return m_taglookup.get([&] { return buildLookup<TagLookup>(m_species); });
+}
+
+auto SpeciesList::resetLookup() -> void
+{
+    m_namelookup.reset();
+    m_formulalookup.reset();
+    m_taglookup.reset();
+}
+
 auto operator+(const SpeciesList& a, const SpeciesList& b) -> SpeciesList
 {
     return concatenate(a, b);
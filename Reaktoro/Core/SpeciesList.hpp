@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/LookupIndex.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/ElementList.hpp>
 #include <Reaktoro/Core/Species.hpp>
@@ -25,6 +26,12 @@
 namespace Reaktoro {
 
 /// A type used as a collection of species.
+/// The species are found by name, substance, formula and tag with hash tables
+/// built on first use. Non-const accessors (e.g., non-const `operator[]`,
+/// `begin`, `end` and the conversion to `Vec<Species>&`) discard these tables,
+/// since the species may be modified through them. Prefer const access for
+/// pure reads. Modifications made through a reference or iterator obtained
+/// before a later lookup are not detected and leave the tables outdated.
 class SpeciesList
 {
 public:
@@ -43,6 +50,9 @@ public:
     /// Append a new species to the list of species.
     auto append(const Species& species) -> void;
 
+    /// Reserve space for a given number of species, so that references to existing ones remain valid when appending.
+    auto reserve(Index size) -> void;
+
     /// Return the internal collection of Species objects.
     auto data() const -> const Vec<Species>&;
 
@@ -169,6 +179,36 @@ private:
     /// The species stored in the list.
     Vec<Species> m_species;
 
+    /// The hash tables used to find species by name and substance.
+    struct NameLookup;
+
+    /// The hash table used to find species by formula.
+    struct FormulaLookup;
+
+    /// The hash table used to find species by tag.
+    struct TagLookup;
+
+    /// The lookup tables of the species by name and substance, built on demand and discarded when the list may have changed.
+    LookupIndex<NameLookup> m_namelookup;
+
+    /// The lookup table of the species by formula, built on demand and discarded when the list may have changed.
+    LookupIndex<FormulaLookup> m_formulalookup;
+
+    /// The lookup table of the species by tag, built on demand and discarded when the list may have changed.
+    LookupIndex<TagLookup> m_taglookup;
+
+    /// Return the lookup tables of the species by name and substance, building them if needed.
+    auto nameLookup() const -> SharedPtr<NameLookup const>;
+
+    /// Return the lookup table of the species by formula, building it if needed.
+    auto formulaLookup() const -> SharedPtr<FormulaLookup const>;
+
+    /// Return the lookup table of the species by tag, building it if needed.
+    auto tagLookup() const -> SharedPtr<TagLookup const>;
+
+    /// Discard all lookup tables of the species in the list.
+    auto resetLookup() -> void;
+
 public:
     /// Construct an SpeciesList object with given begin and end iterators.
     template<typename InputIterator>
@@ -178,20 +218,20 @@ public:
     auto begin() const { return m_species.begin(); }
 
     /// Return begin iterator of this SpeciesList instance (for STL compatibility reasons).
-    auto begin() { return m_species.begin(); }
+    auto begin() { resetLookup(); return m_species.begin(); }
 
     /// Return end const iterator of this SpeciesList instance (for STL compatibility reasons).
     auto end() const { return m_species.end(); }
 
     /// Return end iterator of this SpeciesList instance (for STL compatibility reasons).
-    auto end() { return m_species.end(); }
+    auto end() { resetLookup(); return m_species.end(); }
 
     /// Append a new Species at the back of the container (for STL compatibility reasons).
     auto push_back(const Species& species) -> void { append(species); }
 
     /// Insert a container of Species objects into this SpeciesList instance (for STL compatibility reasons).
     template<typename Iterator, typename InputIterator>
-    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_species.insert(pos, begin, end); }
+    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { resetLookup(); m_species.insert(pos, begin, end); }
 
     /// The type of the value stored in a SpeciesList (for STL compatibility reasons).
     using value_type = Species;
@@ -15,6 +15,9 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <utility>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -511,4 +514,40 @@ TEST_CASE("Testing SpeciesList", "[SpeciesList]")
     //-------------------------------------------------------------------------
     for(auto [i, species] : enumerate(specieslist))
         REQUIRE( species.name() == specieslist[i].name() );
+
+    //-------------------------------------------------------------------------
+    // TESTING LOOKUP TABLES AFTER MODIFICATIONS OF THE LIST
+    //-------------------------------------------------------------------------
+    const auto copy = specieslist; // the copy shares the lookup tables with specieslist
+
+    specieslist.append(Species("MgCO3(magnesite)").withTags({ "carbonate" }));
+
+    CHECK( specieslist.findWithName("MgCO3(magnesite)") == specieslist.size() - 1 );
+    CHECK( specieslist.findWithFormula("CO3Mg") == specieslist.size() - 1 );
+    CHECK( specieslist.withTag("carbonate").size() == 1 );
+    CHECK( copy.findWithName("MgCO3(magnesite)") == copy.size() );
+    CHECK( copy.withTag("carbonate").size() == 0 );
+
+    specieslist[0] = Species("H2O(l)");
+
+    CHECK( specieslist.findWithName("H2O(l)") == 0 );
+    CHECK( specieslist.findWithName("H2O(aq)") == specieslist.size() );
+    CHECK( specieslist.findWithFormula("H2O") == 0 );
+    CHECK( copy.findWithName("H2O(aq)") == 0 );
+
+    //-------------------------------------------------------------------------
+    // TESTING LOOKUP TABLES BUILT SEPARATELY AND RESERVED SPACE
+    //-------------------------------------------------------------------------
+    specieslist.reserve(specieslist.size() + 1);
+
+    const auto& first = std::as_const(specieslist)[0];
+
+    CHECK( specieslist.findWithName("H2O(l)") == 0 ); // only the lookup tables by name and substance are built here
+
+    specieslist.append(Species("SrCO3(strontianite)").withTags({ "carbonate" }));
+
+    CHECK( &first == &std::as_const(specieslist)[0] );
+    CHECK( specieslist.findWithName("SrCO3(strontianite)") == specieslist.size() - 1 );
+    CHECK( specieslist.findWithFormula("SrCO3") == specieslist.size() - 1 );
+    CHECK( specieslist.withTag("carbonate").size() == 2 );
 }
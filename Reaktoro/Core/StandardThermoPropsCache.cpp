@@ -0,0 +1,151 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "StandardThermoPropsCache.hpp"
+
+// C++ includes
+#include <atomic>
+#include <mutex>
+
+// Reaktoro includes
+#include <Reaktoro/Common/HashUtils.hpp>
+
+namespace Reaktoro {
+
+struct StandardThermoPropsCache::Impl
+{
+    /// The maximum number of temperature and pressure pairs stored in the cache (read without locking, so that a disabled cache costs no lock).
+    mutable std::atomic<Index> capacity = 0;
+
+    /// The cached standard thermodynamic properties of the species for each pair of temperature and pressure values.
+    mutable Map<Pair<double, double>, SharedPtr<Entry const>> entries;
+
+    /// The pairs of temperature and pressure values in the cache in the order they were inserted.
+    mutable Deque<Pair<double, double>> keys;
+
+    /// The number of successful lookups in the cache.
+    mutable std::atomic<Index> hits = 0;
+
+    /// The number of unsuccessful lookups in the cache.
+    mutable std::atomic<Index> misses = 0;
+
+    /// The mutex used to protect the cache from concurrent modifications.
+    mutable std::mutex mutex;
+
+    /// Remove the oldest entries in the cache until its size does not exceed given size.
+    auto shrink(Index size) const -> void
+    {
+        while(keys.size() > size)
+        {
+            entries.erase(keys.front());
+            keys.pop_front();
+        }
+    }
+};
+
+StandardThermoPropsCache::StandardThermoPropsCache()
+: pimpl(new Impl())
+{}
+
+StandardThermoPropsCache::StandardThermoPropsCache(Index capacity)
+: StandardThermoPropsCache()
+{
+    setCapacity(capacity);
+}
+
+StandardThermoPropsCache::~StandardThermoPropsCache()
+{}
+
+auto StandardThermoPropsCache::setCapacity(Index capacity) const -> void
+{
+    std::lock_guard<std::mutex> lock(pimpl->mutex);
+    pimpl->capacity = capacity;
+    pimpl->shrink(capacity);
+}
+
+auto StandardThermoPropsCache::capacity() const -> Index
+{
+    return pimpl->capacity.load(std::memory_order_relaxed);
+}
+
+auto StandardThermoPropsCache::size() const -> Index
+{
+    std::lock_guard<std::mutex> lock(pimpl->mutex);
+    return pimpl->keys.size();
+}
+
+auto StandardThermoPropsCache::enabled() const -> bool
+{
+    return capacity() > 0;
+}
+
+auto StandardThermoPropsCache::hits() const -> Index
+{
+    return pimpl->hits;
+}
+
+auto StandardThermoPropsCache::misses() const -> Index
+{
+    return pimpl->misses;
+}
+
+auto StandardThermoPropsCache::clear() const -> void
+{
+    std::lock_guard<std::mutex> lock(pimpl->mutex);
+    pimpl->entries.clear();
+    pimpl->keys.clear();
+    pimpl->hits = 0;
+    pimpl->misses = 0;
+}
+
+auto StandardThermoPropsCache::find(double T, double P) const -> SharedPtr<Entry const>
+{
+    if(capacity() == 0)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(pimpl->mutex);
+    const auto it = pimpl->entries.find({ T, P });
+    if(it == pimpl->entries.end())
+    {
+        ++pimpl->misses;
+        return nullptr;
+    }
+    ++pimpl->hits;
+    return it->second;
+}
+
+auto StandardThermoPropsCache::insert(double T, double P, Entry entry) const -> void
+{
+    if(capacity() == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(pimpl->mutex);
+
+    if(pimpl->capacity == 0)
+        return; // the cache may have been disabled by another thread meanwhile
+
+    const auto key = Pair<double, double>{ T, P };
+
+    if(pimpl->entries.count(key))
+        return; // another thread may have inserted an entry for the same temperature and pressure meanwhile
+
+    pimpl->shrink(pimpl->capacity - 1);
+    pimpl->entries[key] = std::make_shared<Entry const>(std::move(entry));
+    pimpl->keys.push_back(key);
+}
+
+} // namespace Reaktoro
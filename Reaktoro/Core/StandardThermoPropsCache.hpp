@@ -0,0 +1,115 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// The class used to cache the standard thermodynamic properties of all species in a chemical system.
+/// The properties are stored for each pair of temperature and pressure values
+/// for which they have been computed, so that chemical states with the same
+/// temperature and pressure (e.g., many cells in a reactive transport
+/// simulation) do not need to evaluate the standard thermodynamic models of
+/// the species again. The cache is disabled by default (zero capacity). Once
+/// it reaches its capacity, the oldest entry is removed to give room to a new
+/// one. The cache can be used concurrently from multiple threads. Its methods
+/// are all `const`, because the cache does not change the standard thermodynamic
+/// properties it is used for (like a memoized function), and so it can be used
+/// through ChemicalSystem::standardThermoPropsCache, which returns a constant reference.
+/// @note The cached properties do not carry derivative information, and
+/// thus the cache is not used when temperature or pressure are seeded for
+/// automatic differentiation. The cache should also be cleared whenever the
+/// parameters of the standard thermodynamic models of the species change.
+/// @see ChemicalSystem::standardThermoPropsCache
+/// @ingroup Core
+class StandardThermoPropsCache
+{
+public:
+    /// The standard thermodynamic properties of all species in a chemical system at some temperature and pressure.
+    struct Entry
+    {
+        /// The standard molar Gibbs energies of formation of the species (in J/mol).
+        ArrayXd G0;
+
+        /// The standard molar enthalpies of formation of the species (in J/mol).
+        ArrayXd H0;
+
+        /// The standard molar volumes of the species (in m³/mol).
+        ArrayXd V0;
+
+        /// The temperature derivative of the standard molar volumes of the species (in m³/(mol·K)).
+        ArrayXd VT0;
+
+        /// The pressure derivative of the standard molar volumes of the species (in m³/(mol·Pa)).
+        ArrayXd VP0;
+
+        /// The standard molar isobaric heat capacities of the species (in J/(mol·K)).
+        ArrayXd Cp0;
+    };
+
+    /// Construct a default StandardThermoPropsCache object (with zero capacity, i.e., disabled).
+    StandardThermoPropsCache();
+
+    /// Construct a StandardThermoPropsCache object with given capacity.
+    explicit StandardThermoPropsCache(Index capacity);
+
+    /// Destroy this StandardThermoPropsCache object.
+    ~StandardThermoPropsCache();
+
+    /// Set the maximum number of temperature and pressure pairs stored in the cache (zero disables the cache).
+    auto setCapacity(Index capacity) const -> void;
+
+    /// Return the maximum number of temperature and pressure pairs stored in the cache.
+    auto capacity() const -> Index;
+
+    /// Return the number of temperature and pressure pairs currently stored in the cache.
+    auto size() const -> Index;
+
+    /// Return true if the cache is enabled (i.e., it has non-zero capacity).
+    auto enabled() const -> bool;
+
+    /// Return the number of successful lookups in the cache so far.
+    auto hits() const -> Index;
+
+    /// Return the number of unsuccessful lookups in the cache so far.
+    auto misses() const -> Index;
+
+    /// Remove all entries in the cache and reset its lookup counters.
+    auto clear() const -> void;
+
+    /// Return the cached standard thermodynamic properties of the species at given temperature and pressure if available, otherwise `nullptr`.
+    /// @param T The temperature (in K)
+    /// @param P The pressure (in Pa)
+    auto find(double T, double P) const -> SharedPtr<Entry const>;
+
+    /// Store the standard thermodynamic properties of the species at given temperature and pressure in the cache.
+    /// @param T The temperature (in K)
+    /// @param P The pressure (in Pa)
+    /// @param entry The standard thermodynamic properties of the species at *T* and *P*
+    auto insert(double T, double P, Entry entry) const -> void;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
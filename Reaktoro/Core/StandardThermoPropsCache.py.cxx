@@ -0,0 +1,50 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/StandardThermoPropsCache.hpp>
+using namespace Reaktoro;
+
+void exportStandardThermoPropsCache(py::module& m)
+{
+    py::class_<StandardThermoPropsCache::Entry>(m, "StandardThermoPropsCacheEntry")
+        .def(py::init<>())
+        .def_readwrite("G0", &StandardThermoPropsCache::Entry::G0, "The standard molar Gibbs energies of formation of the species (in J/mol).")
+        .def_readwrite("H0", &StandardThermoPropsCache::Entry::H0, "The standard molar enthalpies of formation of the species (in J/mol).")
+        .def_readwrite("V0", &StandardThermoPropsCache::Entry::V0, "The standard molar volumes of the species (in m3/mol).")
+        .def_readwrite("VT0", &StandardThermoPropsCache::Entry::VT0, "The temperature derivative of the standard molar volumes of the species (in m3/(mol*K)).")
+        .def_readwrite("VP0", &StandardThermoPropsCache::Entry::VP0, "The pressure derivative of the standard molar volumes of the species (in m3/(mol*Pa)).")
+        .def_readwrite("Cp0", &StandardThermoPropsCache::Entry::Cp0, "The standard molar isobaric heat capacities of the species (in J/(mol*K)).")
+        ;
+
+    py::class_<StandardThermoPropsCache>(m, "StandardThermoPropsCache")
+        .def(py::init<>())
+        .def(py::init<Index>())
+        .def("setCapacity", &StandardThermoPropsCache::setCapacity, "Set the maximum number of temperature and pressure pairs stored in the cache (zero disables the cache).")
+        .def("capacity", &StandardThermoPropsCache::capacity, "Return the maximum number of temperature and pressure pairs stored in the cache.")
+        .def("size", &StandardThermoPropsCache::size, "Return the number of temperature and pressure pairs currently stored in the cache.")
+        .def("enabled", &StandardThermoPropsCache::enabled, "Return true if the cache is enabled (i.e., it has non-zero capacity).")
+        .def("hits", &StandardThermoPropsCache::hits, "Return the number of successful lookups in the cache so far.")
+        .def("misses", &StandardThermoPropsCache::misses, "Return the number of unsuccessful lookups in the cache so far.")
+        .def("clear", &StandardThermoPropsCache::clear, "Remove all entries in the cache and reset its lookup counters.")
+        .def("find", [](StandardThermoPropsCache const& self, double T, double P) -> py::object { auto entry = self.find(T, P); return entry ? py::cast(*entry) : py::none(); }, "Return the cached standard thermodynamic properties of the species at given temperature and pressure if available, otherwise None.")
+        .def("insert", &StandardThermoPropsCache::insert, "Store the standard thermodynamic properties of the species at given temperature and pressure in the cache.")
+        ;
+}
@@ -0,0 +1,94 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/StandardThermoPropsCache.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing StandardThermoPropsCache class", "[StandardThermoPropsCache]")
+{
+    auto entry = [](double value) -> StandardThermoPropsCache::Entry
+    {
+        const auto arr = ArrayXd::Constant(3, value);
+        return { arr, arr, arr, arr, arr, arr };
+    };
+
+    SECTION("Testing a disabled cache")
+    {
+        StandardThermoPropsCache cache;
+
+        CHECK( cache.enabled() == false );
+        CHECK( cache.capacity() == 0 );
+
+        cache.insert(300.0, 1e5, entry(1.0));
+
+        CHECK( cache.size() == 0 );
+        CHECK( cache.find(300.0, 1e5) == nullptr );
+    }
+
+    SECTION("Testing insertion, lookup and removal of oldest entries")
+    {
+        StandardThermoPropsCache cache(2);
+
+        CHECK( cache.enabled() );
+        CHECK( cache.capacity() == 2 );
+
+        cache.insert(300.0, 1e5, entry(1.0));
+        cache.insert(310.0, 1e5, entry(2.0));
+
+        CHECK( cache.size() == 2 );
+
+        auto found = cache.find(310.0, 1e5);
+
+        REQUIRE( found );
+        CHECK( (found->G0 == 2.0).all() );
+        CHECK( (found->Cp0 == 2.0).all() );
+
+        CHECK( cache.find(310.0, 2e5) == nullptr );
+
+        CHECK( cache.hits() == 1 );
+        CHECK( cache.misses() == 1 );
+
+        cache.insert(320.0, 1e5, entry(3.0)); // the entry at 300 K is removed
+
+        CHECK( cache.size() == 2 );
+        CHECK( cache.find(300.0, 1e5) == nullptr );
+        CHECK( cache.find(320.0, 1e5) != nullptr );
+
+        CHECK( found->G0[0] == 2.0 ); // entries found before remain valid even if removed from the cache
+
+        cache.setCapacity(1); // the entry at 310 K is removed
+
+        CHECK( cache.size() == 1 );
+        CHECK( cache.find(310.0, 1e5) == nullptr );
+        CHECK( cache.find(320.0, 1e5) != nullptr );
+
+        cache.insert(320.0, 1e5, entry(4.0)); // an existing entry is not replaced
+
+        CHECK( cache.find(320.0, 1e5)->G0[0] == 3.0 );
+
+        cache.clear();
+
+        CHECK( cache.size() == 0 );
+        CHECK( cache.hits() == 0 );
+        CHECK( cache.misses() == 0 );
+        CHECK( cache.capacity() == 1 );
+    }
+}
@@ -17,6 +17,9 @@
 
 #include "DatabaseParser.hpp"
 
+// C++ includes
+#include <utility>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/ParseUtils.hpp>
@@ -35,31 +38,44 @@ struct DatabaseParser::Impl
     ///< The Element objects in the database.
     ElementList element_list;
 
-    ///< The database contents parsed from YAML or JSON into a Data object.
-    Data doc;
+    ///< The database contents parsed from YAML or JSON into a Data object (shared among copies since it is never modified).
+    SharedPtr<Data const> doc;
+
+    ///< The records of the species in the database.
+    Vec<SpeciesRecord> records;
+
+    ///< The Data objects with the attributes of the species in each record (pointing into `doc`).
+    Vec<Data const*> records_attributes;
+
+    ///< The index of the Species object in `species_list` created for each record (or -1 if not created yet).
+    Indices records_species;
+
+    ///< The indices of the records of each species name.
+    Map<String, Index> records_with_name;
+
+    ///< The indices of the records grouped in terms of their aggregate state.
+    Map<AggregateState, Indices> records_with_aggregate_state;
+
+    ///< Whether the Species objects are created on demand only.
+    bool lazy = false;
 
     /// Construct a default DatabaseParser::Impl object.
     Impl()
+    : doc(new Data())
     {}
 
     /// Construct a DatabaseParser::Impl object with given Data object.
-    Impl(const Data& doc)
-    : doc(doc)
+    Impl(const Data& data, bool lazy)
+    : doc(new Data(data)), lazy(lazy)
     {
+        const auto& doc = *this->doc;
+
         errorif(!doc.isDict(), "Could not understand your YAML or JSON database file with content:\n", doc.repr(), "\n",
             "Repeating the error message here in case the above printed content is too long.\n",
             "Could not understand your YAML or JSON database file with the above content.\n",
             "Are you forgetting to add the list of chemical species inside a Species YAML or JSON map?\n",
             "Please check other Reaktoro's YAML or JSON databases to identify what is not conforming.");
 
-        // if(doc.exists("Elements"))
-        //     for(auto const& child : doc["Elements"].asDict())
-        //         addElement(child.first, child.second);
-
-        // if(doc.exists("Species"))
-        //     for(auto const& child : doc["Species"].asDict())
-        //         addSpecies(child.first, child.second);
-
         if(doc.exists("Elements"))
         {
             if(doc["Elements"].isDict())
@@ -75,30 +91,32 @@ struct DatabaseParser::Impl
         {
             if(doc["Species"].isDict())
                 for(auto const& child : doc["Species"].asDict())
-                    addSpecies(child.first, child.second);
+                    addSpeciesRecord(child.first, child.second);
             else if(doc["Species"].isList())
                 for(auto const& child : doc["Species"].asList())
-                    addSpecies(child["Name"].asString(), child);
+                    addSpeciesRecord(child["Name"].asString(), child);
             else errorif(true, "Expecting the `Species` section in your YAML or JSON database to be either a list or dictionary. Please check other Reaktoro databases in either YAML or JSON format and replicate the structure.");
-
         }
+
+        // Ensure all elements in the species are known even if their Species objects are never created.
+        for(auto const& record : records)
+            for(auto const& symbol : record.elements)
+                if(element_list.find(symbol) == element_list.size())
+                    addElement(symbol);
+
+        records_species.resize(records.size(), -1);
+
+        if(!lazy)
+            for(Index i = 0; i < records.size(); ++i)
+                createSpecies(i);
     }
 
     /// Return the Data object with the details of an element with given unique @p symbol.
     auto getElementDetails(String const& symbol) -> Data
     {
-        if(doc.exists("Elements"))
-            if(doc["Elements"].exists(symbol))
-                return doc["Elements"][symbol];
-        return {};
-    }
-
-    /// Return the Data object with the details of a species with given unique @p name.
-    auto getSpeciesDetails(const String& name) -> Data
-    {
-        if(doc.exists("Species"))
-            if(doc["Species"].exists(name))
-                return doc["Species"][name];
+        if(doc->exists("Elements"))
+            if((*doc)["Elements"].exists(symbol))
+                return (*doc)["Elements"][symbol];
         return {};
     }
 
@@ -127,18 +145,8 @@ struct DatabaseParser::Impl
         return element;
     }
 
-    /// Add a new species with given unique @p name. A Data object for this species must exist.
-    auto addSpecies(String const& name) -> Species
-    {
-        const auto attributes = getSpeciesDetails(name);
-        errorif(attributes.isNull(), "Could not create a Species object with "
-            "name `", name, "`, which does not seem to exist in the database. "
-            "Are you sure this name is correct and there is a species with this name in the database?");
-        return addSpecies(name, attributes);
-    }
-
-    /// Add a new species with given `name` and `attributes`.
-    auto addSpecies(String const& name, Data const& attributes) -> Species
+    /// Add a new species record with given `name` and `attributes` without creating its Species object.
+    auto addSpeciesRecord(String const& name, Data const& attributes) -> void
     {
         errorif(!attributes.isDict(), "Expecting the attributes of a species as an object, but got instead:\n\n", attributes.repr());
         errorif(!attributes.exists("Formula"), "Missing `Formula` specification in:\n\n", attributes.repr());
@@ -146,23 +154,61 @@ struct DatabaseParser::Impl
         errorif(!attributes.exists("Elements"), "Missing `Elements` specification in:\n\n", attributes.repr(), "\n",
             "Please assign `Elements: null` if this species does not have chemical elements (e.g., e-, which may be represented with only `Charge: -1`).");
         errorif(!attributes.exists("FormationReaction") && !attributes.exists("StandardThermoModel"), "Missing `FormationReaction` or `StandardThermoModel` specification in:\n\n", attributes.repr());
-        const auto idx = species_list.find(name);
-        if(idx < species_list.size())
-            return species_list[idx]; // Do not add a species that has already been added! Return existing one.
+        if(records_with_name.count(name))
+            return; // Do not add a species that has already been added!
+        SpeciesRecord record;
+        record.name = name;
+        attributes.at("Formula").to(record.formula);
+        attributes.at("AggregateState").to(record.aggregate_state);
+        errorif(record.aggregate_state == AggregateState::Undefined,
+            "Unsupported AggregateState value `", attributes["AggregateState"].asString(), "` in:\n\n", attributes.repr(), "\n\n"
+            "The supported values are given below:\n\n", supportedAggregateStateValues());
+        if(!attributes.at("Elements").isNull())
+            for(auto const& [symbol, coeff] : parseNumberStringPairs(attributes["Elements"].asString()))
+                record.elements.push_back(symbol);
+        records_with_name[name] = records.size();
+        records_with_aggregate_state[record.aggregate_state].push_back(records.size());
+        records.push_back(record);
+        records_attributes.push_back(&attributes);
+    }
+
+    /// Return the index of the species record with given name or the number of records if not found.
+    auto findSpeciesRecord(String const& name) const -> Index
+    {
+        const auto it = records_with_name.find(name);
+        return it != records_with_name.end() ? it->second : records.size();
+    }
+
+    /// Add a new species with given unique @p name. A species record for this species must exist.
+    auto addSpecies(String const& name) -> Species
+    {
+        const auto irecord = findSpeciesRecord(name);
+        errorif(irecord >= records.size(), "Could not create a Species object with "
+            "name `", name, "`, which does not seem to exist in the database. "
+            "Are you sure this name is correct and there is a species with this name in the database?");
+        return createSpecies(irecord);
+    }
+
+    /// Create the Species object of the species record with given index or return it if already created.
+    auto createSpecies(Index irecord) -> Species
+    {
+        assert(irecord < records.size());
+        if(records_species[irecord] < species_list.size())
+            return std::as_const(species_list)[records_species[irecord]]; // Do not create a species that has already been created! Return existing one.
+        auto const& record = records[irecord];
+        auto const& attributes = *records_attributes[irecord];
         Species::Attribs attribs;
-        attribs.name = name;
-        attributes.at("Formula").to(attribs.formula);
+        attribs.name = record.name;
+        attribs.formula = record.formula;
         if(attributes.exists("Substance")) attributes.at("Substance").to(attribs.substance);
         if(attributes.exists("Charge")) attributes.at("Charge").to(attribs.charge);
-        attributes.at("AggregateState").to(attribs.aggregate_state);
-        errorif(attribs.aggregate_state == AggregateState::Undefined,
-            "Unsupported AggregateState value `", attributes["AggregateState"].asString(), "` in:\n\n", attributes.repr(), "\n\n"
-            "The supported values are given below:\n\n", supportedAggregateStateValues());
+        attribs.aggregate_state = record.aggregate_state;
         attribs.elements = createElementalComposition(attributes);
         attribs.formation_reaction = createFormationReaction(attributes);
         attribs.std_thermo_model = createStandardThermoModel(attributes);
         attribs.tags = createTags(attributes);
         Species species(attribs);
+        records_species[irecord] = species_list.size();
         species_list.append(species);
         return species;
     }
@@ -231,14 +277,8 @@ struct DatabaseParser::Impl
         Pairs<Species, double> reactants;
         for(const auto& [name, coeff] : names_and_coeffs)
         {
-            const auto idx = species_list.find(name);
-            if(idx < species_list.size()) // check if there is a Species object with current name
-                reactants.emplace_back(species_list[idx], coeff); // if so, add it to the list of reactants
-            else // otherwise, add a new Species object
-            {
-                const auto new_species = addSpecies(name); // Note potential recursivity: addSpecies may also need to call createReactants! This is needed in case reactions are defined recursively.
-                reactants.emplace_back(new_species, coeff);
-            }
+            const auto reactant = addSpecies(name); // Note potential recursivity: addSpecies may also need to call createReactants! This is needed in case reactions are defined recursively. If the Species object already exists, it is returned instead.
+            reactants.emplace_back(reactant, coeff);
         }
         return reactants;
     }
@@ -265,7 +305,11 @@ DatabaseParser::DatabaseParser(const DatabaseParser& other)
 {}
 
 DatabaseParser::DatabaseParser(Data const& doc)
-: pimpl(new Impl(doc))
+: pimpl(new Impl(doc, false))
+{}
+
+DatabaseParser::DatabaseParser(Data const& doc, bool lazy)
+: pimpl(new Impl(doc, lazy))
 {}
 
 DatabaseParser::~DatabaseParser()
@@ -287,9 +331,36 @@ auto DatabaseParser::species() const -> const SpeciesList&
     return pimpl->species_list;
 }
 
+auto DatabaseParser::isLazy() const -> bool
+{
+    return pimpl->lazy;
+}
+
+auto DatabaseParser::speciesRecords() const -> Vec<SpeciesRecord> const&
+{
+    return pimpl->records;
+}
+
+auto DatabaseParser::speciesRecordsWithAggregateState(AggregateState option) const -> Indices const&
+{
+    static const Indices empty;
+    const auto it = pimpl->records_with_aggregate_state.find(option);
+    return it != pimpl->records_with_aggregate_state.end() ? it->second : empty;
+}
+
+auto DatabaseParser::findSpeciesRecord(String const& name) const -> Index
+{
+    return pimpl->findSpeciesRecord(name);
+}
+
+auto DatabaseParser::createSpecies(Index irecord) -> Species
+{
+    return pimpl->createSpecies(irecord);
+}
+
 DatabaseParser::operator Database() const
 {
-    return Database(elements(), species());
+    return Database(*this);
 }
 
 } // namespace Reaktoro
@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Core/AggregateState.hpp>
 #include <Reaktoro/Core/ElementList.hpp>
 #include <Reaktoro/Core/SpeciesList.hpp>
 
@@ -31,6 +32,22 @@ class Data;
 class DatabaseParser
 {
 public:
+    /// The attributes of a species in the database file that are known without creating its Species object.
+    struct SpeciesRecord
+    {
+        /// The name of the species.
+        String name;
+
+        /// The chemical formula of the species.
+        String formula;
+
+        /// The aggregate state of the species.
+        AggregateState aggregate_state = AggregateState::Undefined;
+
+        /// The symbols of the elements in the species.
+        Strings elements;
+    };
+
     /// Construct a default DatabaseParser object.
     DatabaseParser();
 
@@ -40,6 +57,13 @@ public:
     /// Construct a DatabaseParser object with given Data object.
     explicit DatabaseParser(const Data& node);
 
+    /// Construct a DatabaseParser object with given Data object in eager or lazy mode.
+    /// In lazy mode, the species in the database file are only indexed and
+    /// their Species objects are created on demand with @ref createSpecies.
+    /// @param node The Data object with the contents of the database file.
+    /// @param lazy Whether the species should be created on demand only.
+    DatabaseParser(const Data& node, bool lazy);
+
     /// Destroy this DatabaseParser object.
     ~DatabaseParser();
 
@@ -50,9 +74,27 @@ public:
     auto elements() const -> const ElementList&;
 
     /// Return the parsed Species objects in the database file.
+    /// In lazy mode, only the Species objects created so far are returned.
     auto species() const -> const SpeciesList&;
 
-    /// Return the parsed Element objects in the database file.
+    /// Return true if the Species objects are created on demand only.
+    auto isLazy() const -> bool;
+
+    /// Return the records of all species in the database file.
+    auto speciesRecords() const -> Vec<SpeciesRecord> const&;
+
+    /// Return the indices of the species records with given aggregate state.
+    auto speciesRecordsWithAggregateState(AggregateState option) const -> Indices const&;
+
+    /// Return the index of the species record with given name or the number of records if not found.
+    auto findSpeciesRecord(String const& name) const -> Index;
+
+    /// Create the Species object of the species record with given index or return it if already created.
+    /// The reactant species in the formation reaction of the species, if any, are also created.
+    auto createSpecies(Index irecord) -> Species;
+
+    /// Convert this DatabaseParser object into a Database object.
+    /// In lazy mode, the Database object creates its Species objects on demand using this parser.
     operator Database() const;
 
 private:
@@ -20,6 +20,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Core/Data.hpp>
+#include <Reaktoro/Core/Database.hpp>
 #include <Reaktoro/Core/Support/DatabaseParser.hpp>
 using namespace Reaktoro;
 
@@ -231,6 +232,55 @@ TEST_CASE("Testing DatabaseParser class", "[DatabaseParser]")
         CHECK( species[3].reaction().stoichiometry("A2B3(aq)") == 2 );
     }
 
+    SECTION("Testing lazy creation of species")
+    {
+        String doc = GENERATE(doc_dict_based, doc_list_based);
+
+        Data data = Data::parse(doc);
+
+        DatabaseParser parser(data, true);
+
+        CHECK( parser.isLazy() );
+        CHECK( parser.elements().size() == 2 );
+        CHECK( parser.species().size() == 0 );
+        CHECK( parser.speciesRecords().size() == 4 );
+        CHECK( parser.speciesRecordsWithAggregateState(AggregateState::Aqueous).size() == 2 );
+        CHECK( parser.speciesRecordsWithAggregateState(AggregateState::Solid).size() == 0 );
+
+        const auto irecord = parser.findSpeciesRecord("A6B7(aq)");
+
+        REQUIRE( irecord == 3 );
+        CHECK( parser.speciesRecords()[irecord].formula == "A6B7" );
+        CHECK( parser.speciesRecords()[irecord].elements == Strings{"A", "B"} );
+
+        CHECK( parser.findSpeciesRecord("AB(s)") == 4 );
+
+        const auto species = parser.createSpecies(irecord);
+
+        CHECK( species.name() == "A6B7(aq)" );
+        CHECK( species.reaction().stoichiometry("A2B3(aq)") == 2 );
+        CHECK( parser.species().size() == 3 ); // A6B7(aq) and its reactants A2B(l) and A2B3(aq)
+
+        Database db(parser);
+
+        CHECK( db.isLazy() );
+        CHECK( db.elements().size() == 2 );
+
+        auto gases = db.speciesWithAggregateStateAndNames(AggregateState::Gas, {"A2B(g)"});
+
+        REQUIRE( gases.size() == 1 );
+        CHECK( gases[0].name() == "A2B(g)" );
+        CHECK( gases[0].reaction().stoichiometry("A2B(l)") == 1 );
+
+        auto aqueous = db.speciesWithAggregateStateAndElements(AggregateState::Aqueous, {"A", "B"});
+
+        CHECK( aqueous.size() == 2 );
+        CHECK( db.species("A2B(l)").aggregateState() == AggregateState::Liquid );
+        CHECK_THROWS( db.species("AB(s)") );
+
+        CHECK( db.species().size() == 4 ); // all Species objects are created here
+    }
+
     SECTION("Testing non-conforming databases")
     {
         CHECK_THROWS(DatabaseParser(Data::parse(doc_elements_wrong)));
@@ -401,8 +401,17 @@ auto EquilibriumConditions::inputValues() const -> ArrayXrConstRef
 
 auto EquilibriumConditions::inputValuesGetOrCompute(ChemicalState const& state0) const -> ArrayXr
 {
+    ArrayXr wvals(w.size());
+    inputValuesGetOrCompute(state0, wvals);
+    return wvals;
+}
+
+auto EquilibriumConditions::inputValuesGetOrCompute(ChemicalState const& state0, ArrayXrRef wvals) const -> void
+{
+    errorif(wvals.size() != w.size(), "Expecting an array of input values with size ", w.size(), " but given one has size ", wvals.size(), " instead.");
+
     // The input values with nan replaced by appropriate values whenever possible
-    ArrayXr wvals(w);
+    wvals = w;
 
     // If temperature is input, but current value is nan, fetch it from state0
     if(itemperature_w < w.size() && std::isnan(w[itemperature_w].val()))
@@ -415,8 +424,6 @@ auto EquilibriumConditions::inputValuesGetOrCompute(ChemicalState const& state0)
     // Ensure no other input values are left unspecified! Only temperature and pressure can be inferred at the moment.
     for(auto const& [i, wval] : enumerate(wvals))
         errorif(std::isnan(wval.val()), "You have not specified a value for input `", wvars[i], "` in the EquilibriumConditions object.");
-
-    return wvals;
 }
 
 auto EquilibriumConditions::inputValue(String const& name) const -> real const&
@@ -467,6 +474,23 @@ auto EquilibriumConditions::initialComponentAmountsGetOrCompute(ChemicalState co
     return c0.rows() != 0 ? c0 : ArrayXd(C * n0);
 }
 
+auto EquilibriumConditions::initialComponentAmountsGetOrCompute(ChemicalState const& state0, ArrayXdRef c0vals) const -> void
+{
+    errorif(c0vals.size() != C.rows(), "Expecting an array of initial amounts of conservative components with size ", C.rows(), " but given one has size ", c0vals.size(), " instead.");
+
+    if(c0.rows() != 0)
+    {
+        c0vals = c0;
+        return;
+    }
+
+    // Compute c0 = C*n0 column by column to avoid a temporary vector with the amounts of the species converted to double
+    const auto n0 = state0.speciesAmounts();
+    c0vals.fill(0.0);
+    for(auto j = 0; j < C.cols(); ++j)
+        c0vals.matrix() += C.col(j) * n0[j].val();
+}
+
 //=================================================================================================
 //
 // MISCELLANEOUS METHODS
@@ -272,6 +272,11 @@ public:
     /// Get the values of the input variables associated with the equilibrium conditions if specified, otherwise fetch them from given initial state.
     auto inputValuesGetOrCompute(ChemicalState const& state0) const -> ArrayXr;
 
+    /// Get the values of the input variables associated with the equilibrium conditions if specified, otherwise fetch them from given initial state.
+    /// @param state0 The initial state from which temperature and pressure are fetched if not specified.
+    /// @param[out] wvals The values of the input variables (with size equal to the number of input variables).
+    auto inputValuesGetOrCompute(ChemicalState const& state0, ArrayXrRef wvals) const -> void;
+
     /// Get the value of an input variable with given name.
     /// @param name The unique name of the input variable
     auto inputValue(String const& name) const -> real const&;
@@ -319,6 +324,11 @@ public:
     /// @param state0 The initial state of the system from which the initial amounts of the species \eq{n^\circ} are collected if needed.
     auto initialComponentAmountsGetOrCompute(ChemicalState const& state0) const -> ArrayXd;
 
+    /// Get the initial amounts of the conservative components \eq{c^\circ} before the chemical system reacts if available, otherwise compute it.
+    /// @param state0 The initial state of the system from which the initial amounts of the species \eq{n^\circ} are collected if needed.
+    /// @param[out] c0vals The initial amounts of the conservative components (with size equal to the number of conservative components).
+    auto initialComponentAmountsGetOrCompute(ChemicalState const& state0, ArrayXdRef c0vals) const -> void;
+
     //=================================================================================================
     //
     // MISCELLANEOUS METHODS
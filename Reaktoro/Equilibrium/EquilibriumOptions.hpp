@@ -20,6 +20,9 @@
 // Optima includes
 #include <Optima/Options.hpp>
 
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
 namespace Reaktoro {
 
 /// The options for the description of the Hessian of the Gibbs energy function
@@ -66,6 +69,31 @@ struct EquilibriumOptions
 
     /// The calculation mode of the Hessian of the Gibbs energy function
     GibbsHessian hessian = GibbsHessian::PartiallyExact;
+
+    /// The maximum number of species amounts seeded together in a single evaluation of the chemical properties when computing exact columns of the Hessian of the Gibbs energy function.
+    /// Species amounts are only seeded together if they belong to phases whose chemical properties do not depend
+    /// on each other (e.g., an aqueous phase, a gaseous phase and several mineral phases), so that the Hessian
+    /// columns can be separated after the evaluation. If there are *p* control variables in the equilibrium problem,
+    /// this is only possible if all equation constraints declare the species on whose amounts they depend (see
+    /// EquationConstraints::dependencies), in which case species amounts are only seeded together if no equation
+    /// constraint depends on more than one of them (e.g., kinetic rate constraints of reactions with declared rate
+    /// dependencies). A value of one seeds one species amount at a time.
+    /// @note The amounts of species in the same phase are never seeded together, since the chemical potentials of
+    /// all species in a phase depend on the amount of each of them. Thus, this option cannot reduce the number of
+    /// evaluations needed for a single large phase (e.g., an aqueous phase with many species): at least as many
+    /// evaluations as the number of species in the largest phase (and in the phases coupled to it) are needed.
+    Index hessian_seed_group_size = 1;
+
+    /// The number of threads used in batch equilibrium calculations (zero means all available hardware threads).
+    /// @see EquilibriumSolver::solveBatch
+    Index num_threads = 0;
+
+    /// The number of consecutive states claimed at once by a thread in batch equilibrium calculations.
+    /// Small values improve load balancing when some states need many more
+    /// iterations to converge than others, while large values reduce
+    /// scheduling overhead and improve memory locality.
+    /// @see EquilibriumSolver::solveBatch
+    Index batch_chunk_size = 16;
 };
 
 } // namespace Reaktoro
@@ -30,5 +30,8 @@ void exportEquilibriumOptions(py::module& m)
         .def_readwrite("epsilon", &EquilibriumOptions::epsilon)
         .def_readwrite("logarithm_barrier_factor", &EquilibriumOptions::logarithm_barrier_factor)
         .def_readwrite("use_ideal_activity_models", &EquilibriumOptions::use_ideal_activity_models)
+        .def_readwrite("hessian_seed_group_size", &EquilibriumOptions::hessian_seed_group_size)
+        .def_readwrite("num_threads", &EquilibriumOptions::num_threads)
+        .def_readwrite("batch_chunk_size", &EquilibriumOptions::batch_chunk_size)
         ;
 }
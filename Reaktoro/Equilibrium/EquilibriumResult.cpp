@@ -25,4 +25,30 @@ auto EquilibriumResult::operator+=(const EquilibriumResult& other) -> Equilibriu
     return *this;
 }
 
+auto EquilibriumBatchResult::succeeded() const -> bool
+{
+    return numFailed() == 0;
+}
+
+auto EquilibriumBatchResult::failed() const -> bool
+{
+    return !succeeded();
+}
+
+auto EquilibriumBatchResult::numFailed() const -> Index
+{
+    Index count = 0;
+    for(auto const& cell : cells)
+        count += cell.failed();
+    return count;
+}
+
+auto EquilibriumBatchResult::iterations() const -> Index
+{
+    Index count = 0;
+    for(auto const& cell : cells)
+        count += cell.iterations();
+    return count;
+}
+
 } // namespace Reaktoro
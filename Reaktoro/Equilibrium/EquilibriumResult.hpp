@@ -20,6 +20,9 @@
 // Optima includes
 #include <Optima/Result.hpp>
 
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
 namespace Reaktoro {
 
 /// A type used to describe the result of an equilibrium calculation
@@ -42,4 +45,47 @@ struct EquilibriumResult
     auto operator+=(const EquilibriumResult& other) -> EquilibriumResult&;
 };
 
+/// Used to provide timing information of a batch of chemical equilibrium calculations.
+/// @see EquilibriumBatchResult
+struct EquilibriumBatchTiming
+{
+    /// The wall-clock time spent for solving all chemical equilibrium problems in the batch (in seconds).
+    double solve = 0.0;
+
+    /// The sum of the times spent by each chemical equilibrium calculation in the batch (in seconds).
+    double cells = 0.0;
+
+    /// The longest time spent by a single chemical equilibrium calculation in the batch (in seconds).
+    double cells_max = 0.0;
+
+    /// The time spent by each worker thread on its chemical equilibrium calculations (in seconds).
+    Vec<double> threads;
+};
+
+/// Used to describe the result of a batch of chemical equilibrium calculations.
+/// @see EquilibriumSolver::solveBatch
+struct EquilibriumBatchResult
+{
+    /// Return true if all calculations in the batch succeeded.
+    auto succeeded() const -> bool;
+
+    /// Return true if at least one calculation in the batch failed.
+    auto failed() const -> bool;
+
+    /// Return the number of calculations in the batch that failed.
+    auto numFailed() const -> Index;
+
+    /// Return the total number of iterations of all calculations in the batch.
+    auto iterations() const -> Index;
+
+    /// The results of each chemical equilibrium calculation in the batch (in the same order of the given states).
+    Vec<EquilibriumResult> cells;
+
+    /// The number of cells assigned to each worker thread.
+    Vec<Index> cells_per_thread;
+
+    /// The timing information of the batch of chemical equilibrium calculations.
+    EquilibriumBatchTiming timing;
+};
+
 } // namespace Reaktoro
@@ -31,4 +31,23 @@ void exportEquilibriumResult(py::module& m)
         .def("iterations", &EquilibriumResult::iterations, "Return the number of iterations in the calculation.")
         .def_readwrite("optima", &EquilibriumResult::optima)
         ;
+
+    py::class_<EquilibriumBatchTiming>(m, "EquilibriumBatchTiming")
+        .def(py::init<>())
+        .def_readwrite("solve", &EquilibriumBatchTiming::solve, "The wall-clock time spent for solving all chemical equilibrium problems in the batch (in seconds).")
+        .def_readwrite("cells", &EquilibriumBatchTiming::cells, "The sum of the times spent by each chemical equilibrium calculation in the batch (in seconds).")
+        .def_readwrite("cells_max", &EquilibriumBatchTiming::cells_max, "The longest time spent by a single chemical equilibrium calculation in the batch (in seconds).")
+        .def_readwrite("threads", &EquilibriumBatchTiming::threads, "The time spent by each worker thread on its chemical equilibrium calculations (in seconds).")
+        ;
+
+    py::class_<EquilibriumBatchResult>(m, "EquilibriumBatchResult")
+        .def(py::init<>())
+        .def("succeeded", &EquilibriumBatchResult::succeeded, "Return true if all calculations in the batch succeeded.")
+        .def("failed", &EquilibriumBatchResult::failed, "Return true if at least one calculation in the batch failed.")
+        .def("numFailed", &EquilibriumBatchResult::numFailed, "Return the number of calculations in the batch that failed.")
+        .def("iterations", &EquilibriumBatchResult::iterations, "Return the total number of iterations of all calculations in the batch.")
+        .def_readwrite("cells", &EquilibriumBatchResult::cells, "The results of each chemical equilibrium calculation in the batch.")
+        .def_readwrite("cells_per_thread", &EquilibriumBatchResult::cells_per_thread, "The number of cells assigned to each worker thread.")
+        .def_readwrite("timing", &EquilibriumBatchResult::timing, "The timing information of the batch of chemical equilibrium calculations.")
+        ;
 }
@@ -37,3 +37,25 @@ TEST_CASE("Testing EquilibriumResult", "[EquilibriumResult]")
     CHECK( result.failed() == false );
     CHECK( result.iterations() == 23 );
 }
+
+TEST_CASE("Testing EquilibriumBatchResult", "[EquilibriumResult]")
+{
+    EquilibriumBatchResult result;
+
+    CHECK( result.succeeded() == true );
+    CHECK( result.numFailed() == 0 );
+    CHECK( result.iterations() == 0 );
+
+    result.cells.resize(3);
+    result.cells[0].optima.succeeded = true;
+    result.cells[0].optima.iterations = 10;
+    result.cells[1].optima.succeeded = false;
+    result.cells[1].optima.iterations = 50;
+    result.cells[2].optima.succeeded = true;
+    result.cells[2].optima.iterations = 12;
+
+    CHECK( result.succeeded() == false );
+    CHECK( result.failed() == true );
+    CHECK( result.numFailed() == 1 );
+    CHECK( result.iterations() == 72 );
+}
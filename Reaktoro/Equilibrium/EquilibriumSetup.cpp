@@ -17,7 +17,11 @@
 
 #include "EquilibriumSetup.hpp"
 
+// C++ includes
+#include <algorithm>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
@@ -83,6 +87,17 @@ struct EquilibriumSetup::Impl
     ArrayXr mu;                               ///< The auxiliary vector of chemical potentials of the species.
     VectorXl isbasicvar;                      ///< The bitmap that indicates which variables in x = (n, q) are currently basic variables.
     Indices ipps;                             ///< The indices of the pure phase species (i.e., species composing single-phase species, whose chemical potentials do not depend on composition)
+    Indices iphase;                           ///< The index of the phase containing each species.
+    Indices phaseoffsets;                     ///< The index of the first species of each phase.
+    Indices phasesizes;                       ///< The number of species in each phase.
+    Vec<Vec<bool>> phasecoupling;             ///< The indication whether the chemical properties of a phase depend on the species amounts in another phase, or vice versa (true for a phase and itself).
+    bool phasecouplingideal = false;          ///< The indication whether `phasecoupling` was determined with ideal activity models.
+    Index phasecouplingdeps = 0;              ///< The number of recorded dependencies among the activity models of the phases with which `phasecoupling` was determined.
+    Indices seedcolors;                       ///< The group of species (or color) in which the amount of each species is seeded, determined once per phase coupling.
+    Index seedgroupsize = 0;                  ///< The maximum number of species per group with which `seedcolors` was determined.
+    Vec<Indices> seedgroups;                  ///< The groups of species whose amounts are seeded together in a single evaluation of the chemical properties.
+    Vec<Indices> speciesconstraints;          ///< The indices of the equation constraints whose residuals depend on the amount of each species (empty if not declared in the equation constraints).
+    bool assembling = false;                  ///< The indication whether the Jacobian matrix of the chemical properties is being assembled (which requires seeding one variable at a time).
 
     // -------------------------------------------- //
     // ------ CONVENIENT AUXILIARY VARIABLES ------ //
@@ -137,37 +152,38 @@ struct EquilibriumSetup::Impl
 
         isbasicvar.resize(Nx);
 
-        // Initialize the indices of the pure phase species
+        // Initialize the indices of the pure phase species and the phase of each species
         auto offset = 0;
         for(auto const& phase : system.phases())
         {
             const auto size = phase.species().size();
             if(size == 1)
                 ipps.push_back(offset);
+            iphase.insert(iphase.end(), size, phaseoffsets.size());
+            phaseoffsets.push_back(offset);
+            phasesizes.push_back(size);
             offset += size;
         }
     }
 
-    auto assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd
+    auto assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xlower) const -> void
     {
-        VectorXd xlower = constants(Nx, -inf);
+        xlower.fill(-inf);
         auto nlower = xlower.head(Nn);
         const auto n0 = state0.speciesAmounts();
         for(auto [i, val] : restrictions.speciesCannotDecreaseBelow()) nlower[i] = val;
         for(auto i : restrictions.speciesCannotDecrease()) nlower[i] = n0[i]; // this comes after, in case a species cannot strictly decrease
         for(auto& val : nlower) val = std::max(val, options.epsilon); // ensure the upper bounds of the species amounts are not below the minimum amount value given in EquilibriumOptions::epsilon. TODO: Issue a warning when lower/upper bound of a species amount is changed to EquilibriumOptions::epsilon.
-        return xlower;
     }
 
-    auto assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd
+    auto assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xupper) const -> void
     {
-        VectorXd xupper = constants(Nx, inf);
+        xupper.fill(inf);
         auto nupper = xupper.head(Nn);
         const auto n0 = state0.speciesAmounts();
         for(auto [i, val] : restrictions.speciesCannotIncreaseAbove()) nupper[i] = val;
         for(auto i : restrictions.speciesCannotIncrease()) nupper[i] = n0[i]; // this comes after, in case a species cannot strictly increase
         for(auto& val : nupper) val = std::max(val, options.epsilon); // ensure the upper bounds of the species amounts are not below the minimum amount value given in EquilibriumOptions::epsilon.
-        return xupper;
     }
 
     auto update(VectorXrConstRef xx, VectorXrConstRef pp, VectorXrConstRef ww) -> void
@@ -219,7 +235,15 @@ struct EquilibriumSetup::Impl
                 add_log_barrier_contrib(Hnn);
 
                 // Update columns of Hxx and Vpx corresponding to primary species
-                for(auto i : ibasicvars)
+                if(seedingInGroups())
+                {
+                    Indices ispecies;
+                    for(auto i : ibasicvars)
+                        if(i < Nn) // skip the `q` variables whose implicit titrants are currently primary species
+                            ispecies.push_back(i);
+                    updateGradXSeedingInGroups(ispecies, options.use_ideal_activity_models);
+                }
+                else for(auto i : ibasicvars)
                 {
                     if(i >= Nn) continue; // i corresponds to a `q` variable, and the implicit titrant is currently a primary species
                     updateFx(i);
@@ -229,7 +253,9 @@ struct EquilibriumSetup::Impl
             else // case GibbsHessian::Exact
             {
                 // Update Hxx and Vpx columns for all species
-                for(auto i = 0; i < Nn; ++i)
+                if(seedingInGroups())
+                    updateGradXSeedingInGroups(range(Nn), options.use_ideal_activity_models);
+                else for(auto i = 0; i < Nn; ++i)
                 {
                     updateFx(i);
                     Hxx.col(i) = grad(F.head(Nx));
@@ -243,7 +269,17 @@ struct EquilibriumSetup::Impl
             // wrt temperature, pressure, mole fractions. By default, these methods should be
             // computed using autodiff. They can be override, however, for more efficient
             // computations (manually).
-            for(auto i = 0; i < Nn; ++i)
+            if(seedingInGroups())
+            {
+                // Seed separately the species whose derivatives are computed with ideal activity models and those that are not
+                Indices iexact, iideal;
+                for(auto i = 0; i < Nn; ++i)
+                    if(useIdealModelForGradWrtVariableN(i)) iideal.push_back(i);
+                    else iexact.push_back(i);
+                updateGradXSeedingInGroups(iexact, options.use_ideal_activity_models);
+                updateGradXSeedingInGroups(iideal, true);
+            }
+            else for(auto i = 0; i < Nn; ++i)
             {
                 updateFx(i);
                 Hxx.col(i) = grad(F.head(Nx));
@@ -256,6 +292,216 @@ struct EquilibriumSetup::Impl
         Vpx.rightCols(Nq).fill(0.0);  // these are derivatives w.r.t. amounts of implicit titrants q
     }
 
+    /// Return true if the amounts of species in independent phases can be seeded together when computing columns of Hxx and Vpx.
+    auto seedingInGroups() const -> bool
+    {
+        // Not possible with p control variables whose equation constraints have undeclared species dependencies or when the derivatives of the chemical properties wrt each variable are collected
+        return options.hessian_seed_group_size > 1 && (Np == 0 || econstraints.dependencies.size() == Np) && !assembling;
+    }
+
+    /// Determine which phases have chemical properties depending on the species amounts in other phases.
+    /// The activity model of a phase can only depend on the species amounts in other phases through the extra
+    /// data produced by their activity models (e.g., the chemical potentials in an ion exchange phase depend on
+    /// the state of the aqueous phase). Thus, two phases are coupled if the activity model of one reads, directly
+    /// or via other activity models, the extra data produced by the other, as recorded in ChemicalProps::extraAccesses.
+    /// In addition, the amounts of all species in each phase are seeded at once and the chemical potentials of the
+    /// species in other phases are checked for non-zero derivatives, in case an activity model depends on other
+    /// phases in another way.
+    auto updatePhaseCoupling(bool useIdealModel) -> void
+    {
+        const auto Nphases = phasesizes.size();
+
+        phasecoupling.assign(Nphases, Vec<bool>(Nphases, false));
+
+        for(auto k = 0; k < Nphases; ++k)
+        {
+            phasecoupling[k][k] = true;
+
+            const auto begin = phaseoffsets[k];
+            const auto end = begin + phasesizes[k];
+
+            for(auto i = begin; i < end; ++i)
+                autodiff::seed(n[i]);
+            props.update(n, p, w, useIdealModel);
+            updateF();
+            for(auto i = begin; i < end; ++i)
+                autodiff::unseed(n[i]);
+
+            for(auto j = 0; j < Nn; ++j)
+                if(grad(F[j]) != 0.0) // note NaN derivatives are also considered a dependency
+                    phasecoupling[iphase[j]][k] = phasecoupling[k][iphase[j]] = true;
+        }
+
+        // Determine the phases whose activity models read the extra data produced by the activity models of other phases (directly or indirectly)
+        auto const& accesses = props.chemicalProps().extraAccesses();
+
+        Vec<Vec<bool>> reads(Nphases, Vec<bool>(Nphases, false));
+        for(auto k = 0; k < Nphases; ++k)
+            for(auto l = 0; l < Nphases; ++l)
+                reads[k][l] = accesses.dependsOn(k, l);
+
+        for(auto m = 0; m < Nphases; ++m)
+            for(auto k = 0; k < Nphases; ++k)
+                if(reads[k][m])
+                    for(auto l = 0; l < Nphases; ++l)
+                        reads[k][l] = reads[k][l] || reads[m][l];
+
+        for(auto k = 0; k < Nphases; ++k)
+            for(auto l = 0; l < Nphases; ++l)
+                if(reads[k][l])
+                    phasecoupling[k][l] = phasecoupling[l][k] = true;
+
+        phasecouplingideal = useIdealModel;
+        phasecouplingdeps = accesses.numDependencies();
+
+        updateSpeciesConstraints();
+        updateSeedColors();
+    }
+
+    /// Determine the equation constraints whose residuals depend on the amount of each species.
+    /// The residual of an equation constraint depends on the amount of a species if this species is
+    /// among its declared dependencies or if its phase is coupled with the phase of one of them.
+    auto updateSpeciesConstraints() -> void
+    {
+        speciesconstraints.assign(Nn, Indices{});
+
+        if(econstraints.dependencies.size() != Np)
+            return;
+
+        const auto Nphases = phasesizes.size();
+
+        for(auto r = 0; r < Np; ++r)
+        {
+            Vec<bool> dependent(Nphases, false); // the phases on whose species amounts the r-th equation constraint depends
+            for(auto j : econstraints.dependencies[r])
+                for(auto l = 0; l < Nphases; ++l)
+                    dependent[l] = dependent[l] || phasecoupling[iphase[j]][l];
+
+            for(auto i = 0; i < Nn; ++i)
+                if(dependent[iphase[i]])
+                    speciesconstraints[i].push_back(r);
+        }
+    }
+
+    /// Distribute all species among groups of species whose amounts can be seeded together (first-fit coloring).
+    /// Each group contains at most EquilibriumOptions::hessian_seed_group_size species whose phases are coupled to no
+    /// common phase and on whose amounts no common equation constraint depends. Any subset of a group satisfies
+    /// these conditions as well, so the groups are determined once per phase coupling and reused for every subset
+    /// of species whose columns in Hxx and Vpx are updated.
+    auto updateSeedColors() -> void
+    {
+        const auto Nphases = phasesizes.size();
+
+        Vec<Vec<bool>> coupledphases;    // the phases coupled to the phase of some species in each group
+        Vec<Vec<bool>> usedconstraints;  // the equation constraints depending on the amount of some species in each group
+        Indices colorsizes;              // the number of species in each group
+
+        seedcolors.resize(Nn);
+
+        for(auto i = 0; i < Nn; ++i)
+        {
+            const auto k = iphase[i];
+
+            auto compatible = [&](Index c)
+            {
+                if(colorsizes[c] >= options.hessian_seed_group_size)
+                    return false;
+                for(auto l = 0; l < Nphases; ++l)
+                    if(phasecoupling[k][l] && coupledphases[c][l])
+                        return false;
+                for(auto r : speciesconstraints[i])
+                    if(usedconstraints[c][r])
+                        return false;
+                return true;
+            };
+
+            auto c = 0;
+            while(c < colorsizes.size() && !compatible(c))
+                ++c;
+
+            if(c == colorsizes.size())
+            {
+                coupledphases.emplace_back(Nphases, false);
+                usedconstraints.emplace_back(Np, false);
+                colorsizes.push_back(0);
+            }
+
+            for(auto l = 0; l < Nphases; ++l)
+                coupledphases[c][l] = coupledphases[c][l] || phasecoupling[k][l];
+            for(auto r : speciesconstraints[i])
+                usedconstraints[c][r] = true;
+
+            ++colorsizes[c];
+            seedcolors[i] = c;
+        }
+
+        seedgroups.resize(colorsizes.size());
+        seedgroupsize = options.hessian_seed_group_size;
+    }
+
+    /// Update the columns of Hxx and Vpx corresponding to given species by seeding together the amounts of species in independent phases.
+    /// The given species are grouped according to the groups determined in @ref updateSeedColors. Thus, the chemical potentials of the species
+    /// in a phase coupled to the phase of a seeded species, and the residuals of the equation constraints depending on this seeded
+    /// species, depend on the amount of this seeded species alone within the group, and they do not depend on the amounts of the others.
+    /// @param ispecies The indices of the species whose columns in Hxx and Vpx are updated.
+    /// @param useIdealModel Whether ideal activity models are used when evaluating the chemical properties.
+    auto updateGradXSeedingInGroups(Indices const& ispecies, bool useIdealModel) -> void
+    {
+        auto const& accesses = props.chemicalProps().extraAccesses();
+
+        // The phase coupling is determined with ideal activity models if and only if these are used for all species in updateFn,
+        // and it is determined again whenever new dependencies among the activity models of the phases have been recorded
+        if(phasecoupling.empty() || phasecouplingideal != options.use_ideal_activity_models || phasecouplingdeps != accesses.numDependencies())
+            updatePhaseCoupling(options.use_ideal_activity_models);
+        else if(seedgroupsize != options.hessian_seed_group_size)
+            updateSeedColors();
+
+        // Distribute the given species among their groups (the capacity of these groups is kept between calls)
+        for(auto& group : seedgroups)
+            group.clear();
+        for(auto i : ispecies)
+            seedgroups[seedcolors[i]].push_back(i);
+
+        // Evaluate the chemical properties once per group and separate the Hxx columns of its species
+        for(auto const& group : seedgroups)
+        {
+            if(group.empty())
+                continue;
+            for(auto i : group)
+                autodiff::seed(n[i]);
+            props.update(n, p, w, useIdealModel);
+            updateF();
+            for(auto i : group)
+                autodiff::unseed(n[i]);
+
+            for(auto i : group)
+            {
+                Hxx.col(i).fill(0.0);
+                for(auto l = 0; l < phasesizes.size(); ++l)
+                {
+                    if(!phasecoupling[iphase[i]][l])
+                        continue;
+                    const auto begin = phaseoffsets[l];
+                    const auto end = begin + phasesizes[l];
+                    for(auto j = begin; j < end; ++j)
+                        Hxx(j, i) = grad(F[j]);
+                }
+
+                if(Np == 0)
+                    continue;
+
+                Vpx.col(i).fill(0.0);
+                for(auto r : speciesconstraints[i])
+                    Vpx(r, i) = grad(F[Nx + r]);
+            }
+        }
+
+        // An activity model may have read the extra data of another phase for the first time in the evaluations above (e.g., in a
+        // branch taken only for some species amounts), in which case the columns are computed again with the updated phase coupling
+        if(phasecouplingdeps != accesses.numDependencies())
+            updateGradXSeedingInGroups(ispecies, useIdealModel);
+    }
+
     auto updateGradP() -> void
     {
         // Update Hxp and Vpp
@@ -520,12 +766,28 @@ auto EquilibriumSetup::Aep() const -> MatrixXdConstRef
 
 auto EquilibriumSetup::assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd
 {
-    return pimpl->assembleLowerBoundsVector(restrictions, state0);
+    VectorXd xlower(pimpl->Nx);
+    pimpl->assembleLowerBoundsVector(restrictions, state0, xlower);
+    return xlower;
+}
+
+auto EquilibriumSetup::assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xlower) const -> void
+{
+    errorif(xlower.size() != pimpl->Nx, "Expecting a lower bound vector with size ", pimpl->Nx, " but given one has size ", xlower.size(), " instead.");
+    pimpl->assembleLowerBoundsVector(restrictions, state0, xlower);
 }
 
 auto EquilibriumSetup::assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd
 {
-    return pimpl->assembleUpperBoundsVector(restrictions, state0);
+    VectorXd xupper(pimpl->Nx);
+    pimpl->assembleUpperBoundsVector(restrictions, state0, xupper);
+    return xupper;
+}
+
+auto EquilibriumSetup::assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xupper) const -> void
+{
+    errorif(xupper.size() != pimpl->Nx, "Expecting an upper bound vector with size ", pimpl->Nx, " but given one has size ", xupper.size(), " instead.");
+    pimpl->assembleUpperBoundsVector(restrictions, state0, xupper);
 }
 
 auto EquilibriumSetup::update(VectorXrConstRef x, VectorXrConstRef p, VectorXrConstRef w) -> void
@@ -606,11 +868,13 @@ auto EquilibriumSetup::usingDiagonalApproxDerivatives() -> bool
 auto EquilibriumSetup::assembleChemicalPropsJacobianBegin() -> void
 {
     pimpl->props.assembleFullJacobianBegin();
+    pimpl->assembling = true;
 }
 
 auto EquilibriumSetup::assembleChemicalPropsJacobianEnd() -> void
 {
     pimpl->props.assembleFullJacobianEnd();
+    pimpl->assembling = false;
 }
 
 auto EquilibriumSetup::equilibriumProps() const -> EquilibriumProps const&
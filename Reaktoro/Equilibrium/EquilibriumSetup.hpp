@@ -76,11 +76,23 @@ public:
     /// @param state0 The initial chemical state of the system.
     auto assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd;
 
+    /// Assemble the lower bound vector `xlower` in the optimization problem where *x = (n, q)*.
+    /// @param restrictions The lower and upper bounds information of the species.
+    /// @param state0 The initial chemical state of the system.
+    /// @param[out] xlower The lower bound vector (with size equal to the number of variables in *x*).
+    auto assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xlower) const -> void;
+
     /// Assemble the upper bound vector `xupper` in the optimization problem where *x = (n, q)*.
     /// @param restrictions The lower and upper bounds information of the species.
     /// @param state0 The initial chemical state of the system.
     auto assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd;
 
+    /// Assemble the upper bound vector `xupper` in the optimization problem where *x = (n, q)*.
+    /// @param restrictions The lower and upper bounds information of the species.
+    /// @param state0 The initial chemical state of the system.
+    /// @param[out] xupper The upper bound vector (with size equal to the number of variables in *x*).
+    auto assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xupper) const -> void;
+
     /// Update the chemical potentials and residuals of the equilibrium constraints.
     /// @param x The amounts of the species and implicit titrants, @eq{x = (n, q)}.
     /// @param p The values of the *p* control variables (e.g., temperature, pressure, and/or amounts of explicit titrants).
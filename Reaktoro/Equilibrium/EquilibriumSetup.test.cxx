@@ -19,9 +19,11 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Core/ActivityExtra.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Phases.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
@@ -563,4 +565,203 @@ TEST_CASE("Testing EquilibriumSetup", "[EquilibriumSetup]")
             }
         }
     }
+
+    SECTION("Checking the Hessian of the Gibbs energy when species amounts in independent phases are seeded together")
+    {
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+
+        const auto n = ArrayXr::LinSpaced(Nn, 1.0, Nn);
+        const auto p = ArrayXr{};
+
+        VectorXr x = n.matrix();
+        VectorXr w{{320.0, 1.0e+5}};
+
+        const VectorXl allvars = VectorXl::LinSpaced(Nn, 0, Nn - 1);
+
+        GibbsHessian modes[] = {
+            GibbsHessian::Exact,
+            GibbsHessian::PartiallyExact
+        };
+
+        for(auto mode : modes)
+        {
+            EquilibriumOptions options;
+            options.hessian = mode;
+
+            EquilibriumSetup setup(specs);
+            setup.setOptions(options);
+            setup.update(x, p, w);
+            setup.updateGradX(allvars);
+
+            const MatrixXd Hxx = setup.getGibbsHessianX();
+
+            for(auto groupsize : { 2, 4, 16 })
+            {
+                options.hessian_seed_group_size = groupsize;
+
+                EquilibriumSetup grouped(specs);
+                grouped.setOptions(options);
+                grouped.update(x, p, w);
+                grouped.updateGradX(allvars);
+
+                INFO("mode: " << int(mode) << ", seed group size: " << groupsize);
+                CHECK( Hxx.isApprox(grouped.getGibbsHessianX()) );
+            }
+        }
+    }
+
+    SECTION("Checking the Jacobian of equation constraints with declared species dependencies when species amounts are seeded together")
+    {
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+
+        ControlVariableP pvar1;
+        pvar1.name = "p1";
+        specs.addControlVariableP(pvar1);
+
+        ControlVariableP pvar2;
+        pvar2.name = "p2";
+        specs.addControlVariableP(pvar2);
+
+        EquationConstraints econstraints;
+        econstraints.ids = { "c1", "c2" };
+        econstraints.fn = [](ChemicalProps const& props, VectorXrConstRef const& p, VectorXrConstRef const& w) -> VectorXr
+        {
+            const auto n = props.speciesAmount("CaCO3(s)");
+            const auto u = props.speciesChemicalPotential("CO2(g)"); // depends on the amounts of all gaseous species
+            return VectorXr{{ p[0] - n*n, p[1] - u }};
+        };
+        econstraints.dependencies = { { idx("CaCO3(s)") }, { idx("CO2(g)") } }; // the dependency on the other gaseous species is determined in EquilibriumSetup
+
+        specs.addConstraints(econstraints);
+
+        const auto n = ArrayXr::LinSpaced(Nn, 1.0, Nn);
+        const auto p = ArrayXr{{ 1.0, 2.0 }};
+
+        VectorXr x = n.matrix();
+        VectorXr w{{320.0, 1.0e+5}};
+
+        const VectorXl allvars = VectorXl::LinSpaced(Nn, 0, Nn - 1);
+
+        EquilibriumOptions options;
+        options.hessian = GibbsHessian::Exact;
+
+        EquilibriumSetup setup(specs);
+        setup.setOptions(options);
+        setup.update(x, p, w);
+        setup.updateGradX(allvars);
+
+        const MatrixXd Hxx = setup.getGibbsHessianX();
+        const MatrixXd Vpx = setup.getConstraintResidualsGradX();
+
+        for(auto groupsize : { 2, 4, 16 })
+        {
+            options.hessian_seed_group_size = groupsize;
+
+            EquilibriumSetup grouped(specs);
+            grouped.setOptions(options);
+            grouped.update(x, p, w);
+            grouped.updateGradX(allvars);
+
+            INFO("seed group size: " << groupsize);
+            CHECK( Hxx.isApprox(grouped.getGibbsHessianX()) );
+            CHECK( Vpx.isApprox(grouped.getConstraintResidualsGradX()) );
+        }
+    }
+}
+
+TEST_CASE("Testing EquilibriumSetup with phases coupled via extra data of activity models", "[EquilibriumSetup]")
+{
+    const auto db = Database({
+        Species("H2O" ).withStandardGibbsEnergy(-237181.72),
+        Species("H2O2").withStandardGibbsEnergy(-134100.00),
+        Species("CO2" ).withStandardGibbsEnergy(-385974.00),
+        Species("CO"  ).withStandardGibbsEnergy(-137168.26),
+    });
+
+    const ActivityExtraSlot<real> slot("EquilibriumSetupTestSlot");
+
+    // The activity model of the first phase exports the mole fraction of its first species
+    ActivityModelGenerator producer = [=](SpeciesList const& species)
+    {
+        auto xfirst = std::make_shared<real>(0.0);
+
+        ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
+        {
+            props = 0.0;
+            props.ln_a = args.x.log();
+            *xfirst = args.x[0];
+            props.extra.set(slot, xfirst);
+        };
+
+        return fn;
+    };
+
+    // The activity model of the second phase depends on the exported mole fraction with a zero derivative when it is 0.5
+    // (if conditional, the exported mole fraction is only read when the mole fraction of its own first species is below 0.4)
+    auto consumer = [=](bool conditional) -> ActivityModelGenerator
+    {
+        return [=](SpeciesList const& species)
+        {
+            ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
+            {
+                props = 0.0;
+                if(!conditional || args.x[0] < 0.4)
+                    if(auto xfirst = props.extra.get(slot))
+                        props.ln_g.setConstant((*xfirst - 0.5) * (*xfirst - 0.5));
+                props.ln_a = props.ln_g + args.x.log();
+            };
+
+            return fn;
+        };
+    };
+
+    for(auto conditional : { false, true })
+    {
+        Phases phases(db);
+        phases.add( GeneralPhase("H2O H2O2").setName("Producer").setActivityModel(producer) );
+        phases.add( GeneralPhase("CO2 CO").setName("Consumer").setActivityModel(consumer(conditional)) );
+
+        ChemicalSystem system(phases);
+
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+
+        const auto p = ArrayXr{};
+
+        VectorXr x1{{ 1.0, 1.0, 1.0, 1.0 }}; // the derivative of the Consumer properties wrt Producer species amounts is zero
+        VectorXr x2{{ 1.0, 3.0, 1.0, 3.0 }}; // the derivative of the Consumer properties wrt Producer species amounts is non-zero
+        VectorXr w{{ 320.0, 1.0e+5 }};
+
+        const VectorXl allvars = VectorXl::LinSpaced(4, 0, 3);
+
+        EquilibriumOptions options;
+        options.hessian = GibbsHessian::Exact;
+
+        EquilibriumSetup setup(specs);
+        setup.setOptions(options);
+        setup.update(x2, p, w);
+        setup.updateGradX(allvars);
+
+        const MatrixXd Hxx = setup.getGibbsHessianX();
+
+        CHECK( Hxx.bottomLeftCorner(2, 2).norm() > 0.0 ); // ensure the Consumer properties depend on the Producer species amounts
+
+        options.hessian_seed_group_size = 2;
+
+        // The phase coupling is first determined at x1, where the dependency of the Consumer phase on the Producer phase has no effect on the derivatives
+        EquilibriumSetup grouped(specs);
+        grouped.setOptions(options);
+        grouped.update(x1, p, w);
+        grouped.updateGradX(allvars);
+        grouped.update(x2, p, w);
+        grouped.updateGradX(allvars);
+
+        INFO("conditional: " << conditional);
+        CHECK( Hxx.isApprox(grouped.getGibbsHessianX()) );
+    }
 }
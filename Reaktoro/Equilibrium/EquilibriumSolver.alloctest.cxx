@@ -0,0 +1,176 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// This file is compiled into the executable reaktoro-cppalloctests, separately from reaktoro-cpptests,
+// because it replaces the global operator new to count the heap memory allocations of the program.
+#define CATCH_CONFIG_MAIN
+
+// C++ includes
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Optima includes
+#include <Optima/State.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Phases.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSetup.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+using namespace Reaktoro;
+
+/// The number of heap memory allocations performed by the program so far.
+std::atomic<std::size_t> numallocations = 0;
+
+auto operator new(std::size_t size) -> void*
+{
+    ++numallocations;
+    if(void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+auto operator delete(void* ptr) noexcept -> void
+{
+    std::free(ptr);
+}
+
+auto operator delete(void* ptr, std::size_t) noexcept -> void
+{
+    std::free(ptr);
+}
+
+/// Return the number of heap memory allocations performed when executing a given function.
+template<typename Function>
+auto countAllocations(Function const& fn) -> std::size_t
+{
+    const auto before = numallocations.load();
+    fn();
+    return numallocations.load() - before;
+}
+
+TEST_CASE("Testing heap memory allocations in EquilibriumSolver", "[EquilibriumSolver]")
+{
+    const auto db = Database({
+        Species("H2O"   ).withStandardGibbsEnergy(-237181.72),
+        Species("H+"    ).withStandardGibbsEnergy(      0.00),
+        Species("OH-"   ).withStandardGibbsEnergy(-157297.48),
+        Species("H2"    ).withStandardGibbsEnergy(  17723.42),
+        Species("O2"    ).withStandardGibbsEnergy(  16543.54),
+        Species("Na+"   ).withStandardGibbsEnergy(-261880.74),
+        Species("Cl-"   ).withStandardGibbsEnergy(-131289.74),
+        Species("NaCl"  ).withStandardGibbsEnergy(-388735.44),
+        Species("CO2"   ).withStandardGibbsEnergy(-385974.00),
+        Species("HCO3-" ).withStandardGibbsEnergy(-586939.89),
+        Species("CO3--" ).withStandardGibbsEnergy(-527983.14),
+        Species("CO2(g)").withStandardGibbsEnergy(-394358.74),
+        Species("H2O(g)").withStandardGibbsEnergy(-228131.76),
+    });
+
+    Phases phases(db);
+    phases.add( AqueousPhase(speciate("H O C Na Cl")) );
+    phases.add( GaseousPhase("CO2(g) H2O(g)") );
+
+    ChemicalSystem system(phases);
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+
+    ChemicalState state(system);
+    state.temperature(60.0, "celsius");
+    state.pressure(100.0, "bar");
+    state.set("H2O", 55.0, "mol");
+    state.set("Na+", 0.01, "mol");
+    state.set("Cl-", 0.01, "mol");
+    state.set("CO2", 10.0, "mol");
+
+    EquilibriumConditions conditions(specs);
+    conditions.temperature(60.0, "celsius");
+    conditions.pressure(100.0, "bar");
+
+    EquilibriumSolver solver(specs);
+
+    // Warm up the solver so that the optimization problem is prepared and all buffers, including those in state, are sized
+    for(auto i = 0; i < 2; ++i)
+        REQUIRE( solver.solve(state, conditions).succeeded() );
+
+    SECTION("Checking the operations performed by Reaktoro in each equilibrium calculation do not allocate")
+    {
+        const auto dims = EquilibriumDims(specs);
+
+        EquilibriumSetup setup(specs);
+
+        VectorXr x = state.speciesAmounts();
+        VectorXr p(dims.Np);
+        VectorXr w(dims.Nw);
+        ArrayXr wr(dims.Nw);
+        ArrayXd c0(dims.Nc);
+        VectorXd xlower(dims.Nx);
+        VectorXd xupper(dims.Nx);
+        VectorXl ibasicvars = VectorXl::LinSpaced(dims.Nc, 0, dims.Nc - 1);
+
+        EquilibriumRestrictions restrictions(system);
+
+        conditions.inputValuesGetOrCompute(state, w.array());
+        p.setZero();
+
+        // Size the buffers used in the equilibrium setup and chemical properties
+        setup.update(x, p, w);
+        setup.updateGradX(ibasicvars);
+        setup.updateGradP();
+        setup.updateGradW();
+
+        ChemicalProps props(system);
+        props = setup.chemicalProps();
+
+        CHECK( countAllocations([&] { conditions.inputValuesGetOrCompute(state, wr); }) == 0 );
+        CHECK( countAllocations([&] { conditions.initialComponentAmountsGetOrCompute(state, c0); }) == 0 );
+        CHECK( countAllocations([&] { setup.assembleLowerBoundsVector(restrictions, state, xlower); }) == 0 );
+        CHECK( countAllocations([&] { setup.assembleUpperBoundsVector(restrictions, state, xupper); }) == 0 );
+        CHECK( countAllocations([&] { setup.update(x, p, w); }) == 0 );
+        CHECK( countAllocations([&] { setup.updateGradX(ibasicvars); }) == 0 );
+        CHECK( countAllocations([&] { setup.updateGradP(); }) == 0 );
+        CHECK( countAllocations([&] { setup.updateGradW(); }) == 0 );
+        CHECK( countAllocations([&] { props = setup.chemicalProps(); }) == 0 );
+        CHECK( countAllocations([&] { props.stripDerivatives(); }) == 0 );
+        CHECK( countAllocations([&] { state.setSpeciesAmounts(state.equilibrium().optimaState().x.head(dims.Nn).array()); }) == 0 );
+        CHECK( countAllocations([&] { state.equilibrium().setInputVariables(state.equilibrium().inputVariables()); }) == 0 );
+        CHECK( countAllocations([&] { state.equilibrium().setInitialComponentAmounts(c0); }) == 0 );
+    }
+
+    SECTION("Checking each equilibrium calculation allocates the same number of times (in the Optima solver only)")
+    {
+        // The remaining allocations happen inside Optima::Solver::solve, whose iterations create
+        // temporary vectors and index sets. This count is the current bound of the calculation.
+        const auto expected = countAllocations([&] { REQUIRE( solver.solve(state, conditions).succeeded() ); });
+
+        for(auto i = 0; i < 10; ++i)
+            CHECK( countAllocations([&] { REQUIRE( solver.solve(state, conditions).succeeded() ); }) == expected );
+    }
+}
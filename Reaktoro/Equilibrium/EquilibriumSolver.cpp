@@ -17,6 +17,9 @@
 
 #include "EquilibriumSolver.hpp"
 
+// C++ includes
+#include <algorithm>
+
 // Optima includes
 #include <Optima/Options.hpp>
 #include <Optima/Problem.hpp>
@@ -26,9 +29,10 @@
 #include <Optima/State.hpp>
 
 // Reaktoro includes
-#include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Common/Warnings.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -51,6 +55,31 @@ This can occur due to various factors, such as:
   3. Numerical Instabilities: Convergence issues may arise from numerical problems during the execution of the chemical/kinetic equilibrium algorithm. Consider reporting the issue with a minimal reproducible example if you believe the algorithm is responsible for this issue.
 Disable this warning message with Warnings.disable(906) in Python and Warnings::disable(906) in C++.)";
 
+/// The worker threads and solvers used in batch equilibrium calculations.
+/// These are never copied along with an EquilibriumSolver object, so that
+/// copies of a solver do not share threads or workspace with the original.
+struct EquilibriumSolverBatchWorkers
+{
+    /// The pool of threads executing the equilibrium calculations in a batch.
+    Ptr<ThreadPool> pool;
+
+    /// The equilibrium solvers used by each worker thread in the pool.
+    Vec<EquilibriumSolver> solvers;
+
+    /// Construct a default EquilibriumSolverBatchWorkers object.
+    EquilibriumSolverBatchWorkers()
+    {}
+
+    /// Construct an empty EquilibriumSolverBatchWorkers object when copying an EquilibriumSolver::Impl object.
+    /// The copy is empty on purpose: threads cannot be copied, and the copied solver
+    /// creates its own threads and solvers in its first batch calculation.
+    EquilibriumSolverBatchWorkers(EquilibriumSolverBatchWorkers const&)
+    {}
+
+    /// Deleted copy assignment operator (EquilibriumSolver::Impl objects are never assigned).
+    auto operator=(EquilibriumSolverBatchWorkers const&) -> EquilibriumSolverBatchWorkers& = delete;
+};
+
 struct EquilibriumSolver::Impl
 {
     /// The chemical system associated with this equilibrium solver.
@@ -62,6 +91,15 @@ struct EquilibriumSolver::Impl
     /// The dimensions of the variables and constraints in the equilibrium specifications.
     const EquilibriumDims dims;
 
+    /// The names of the input variables *w* in the equilibrium specifications.
+    const Strings wnames;
+
+    /// The names of the control variables *p* in the equilibrium specifications.
+    const Strings pnames;
+
+    /// The names of the control variables *q* in the equilibrium specifications.
+    const Strings qnames;
+
     /// The auxiliary equilibrium conditions used whenever none are given in the solve methods.
     const EquilibriumConditions xconditions;
 
@@ -83,8 +121,17 @@ struct EquilibriumSolver::Impl
     /// The optimization problem to be configured for a chemical equilibrium calculation.
     Optima::Problem optproblem;
 
-    /// The optimization state of the calculation.
-    Optima::State optstate;
+    /// The object for which the functions in `optproblem` were created (a copy of this object must recreate them).
+    Impl const* prepared = nullptr;
+
+    /// The values of the input variables *w* in the current equilibrium calculation.
+    VectorXr w;
+
+    /// The auxiliary vectors *x = (n, q)* and *p* passed to the equilibrium setup during the optimization calculation.
+    VectorXr xr, pr;
+
+    /// The values of the input variables *w* stored in the chemical state after the calculation (without autodiff seeds).
+    ArrayXd wvals;
 
     /// The optimization sensitivity of the calculation.
     Optima::Sensitivity optsensitivity;
@@ -95,12 +142,13 @@ struct EquilibriumSolver::Impl
     /// The result of the equilibrium calculation
     EquilibriumResult result;
 
-    /// The array stream used to clean up autodiff seed values from the last ChemicalProps update step.
-    ArrayStream<double> stream;
+    /// The worker threads and solvers used in batch equilibrium calculations (created on demand).
+    EquilibriumSolverBatchWorkers workers;
 
     /// Construct a Impl instance with given EquilibriumConditions object.
     Impl(EquilibriumSpecs const& specs)
-    : system(specs.system()), specs(specs), dims(specs), xconditions(specs), xrestrictions(system), setup(specs)
+    : system(specs.system()), specs(specs), dims(specs), wnames(specs.namesInputs()), pnames(specs.namesControlVariablesP()), qnames(specs.namesControlVariablesQ()),
+      xconditions(specs), xrestrictions(system), setup(specs)
     {
         // Initialize the equilibrium solver with the default options
         setOptions(options);
@@ -150,14 +198,17 @@ struct EquilibriumSolver::Impl
 
         // Pass along the options used for the calculation to Optima::Solver object
         optsolver.setOptions(options.optima);
+
+        // Pass along the options to the solvers used in batch equilibrium calculations
+        for(auto& solver : workers.solvers)
+            solver.setOptions(options);
     }
 
-    /// Update the optimization problem before a new equilibrium calculation.
-    auto updateOptProblem(ChemicalState const& state0, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions)
+    /// Prepare the optimization problem with the data that does not change among equilibrium calculations.
+    /// This creates the functions of the problem and sets its coefficient matrices once, so that only the
+    /// vector `be`, the bounds of the variables and the input variables `w` are updated in each calculation.
+    auto prepareOptProblem()
     {
-        // The input variables for the equilibrium calculation
-        const VectorXr w = conditions.inputValuesGetOrCompute(state0);
-
         // Create the Optima::Dims object with dimension info of the optimization problem
         optdims = Optima::Dims();
         optdims.x  = dims.Nx;
@@ -165,13 +216,22 @@ struct EquilibriumSolver::Impl
         optdims.be = dims.Nc;
         optdims.c  = dims.Nw + dims.Nc; // c' = (w, c) where w are the input variables and c are the amounts of components
 
-        // Recreate a new Optima::Problem problem (TODO: Avoid recreation of Optima::Problem object for each equilibrium calculation)
+        // Create the Optima::Problem object once for all equilibrium calculations
         optproblem = Optima::Problem(optdims);
 
+        // Initialize the auxiliary vectors used in the functions of the optimization problem
+        xr.resize(dims.Nx);
+        pr.resize(dims.Np);
+        w.resize(dims.Nw);
+        wvals.resize(dims.Nw);
+
         // Set the resources function in the Optima::Problem object
-        optproblem.r = [=](VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions fopts, Optima::ConstraintOptions hopts, Optima::ConstraintOptions vopts) mutable
+        optproblem.r = [this](VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions fopts, Optima::ConstraintOptions hopts, Optima::ConstraintOptions vopts)
         {
-            setup.update(x, p, w);
+            xr = x.cast<real>();
+            pr = p.cast<real>();
+
+            setup.update(xr, pr, w);
 
             if(fopts.eval.fxc || vopts.eval.ddc)
                 setup.assembleChemicalPropsJacobianBegin();
@@ -188,7 +248,7 @@ struct EquilibriumSolver::Impl
         };
 
         // Set the objective function in the Optima::Problem object
-        optproblem.f = [=](Optima::ObjectiveResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions opts) mutable
+        optproblem.f = [this](Optima::ObjectiveResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions opts)
         {
             res.f = setup.getGibbsEnergy();
             res.fx = setup.getGibbsGradX();
@@ -209,7 +269,7 @@ struct EquilibriumSolver::Impl
         };
 
         // Set the external constraint function in the Optima::Problem object
-        optproblem.v = [=](Optima::ConstraintResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ConstraintOptions opts) mutable
+        optproblem.v = [this](Optima::ConstraintResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ConstraintOptions opts)
         {
             res.val = setup.getConstraintResiduals();
 
@@ -229,17 +289,6 @@ struct EquilibriumSolver::Impl
         optproblem.Aex = setup.Aex();
         optproblem.Aep = setup.Aep();
 
-        /// Set the right-hand side vector be of the linear equality constraints.
-        optproblem.be = conditions.initialComponentAmountsGetOrCompute(state0);
-
-        // Set the lower and upper bounds of the species amounts
-        optproblem.xlower = setup.assembleLowerBoundsVector(restrictions, state0);
-        optproblem.xupper = setup.assembleUpperBoundsVector(restrictions, state0);
-
-        // Set the lower and upper bounds of the *p* control variables
-        optproblem.plower = conditions.lowerBoundsControlVariablesP();
-        optproblem.pupper = conditions.upperBoundsControlVariablesP();
-
         // Set the values of the input variables for sensitivity derivatives
         optproblem.c = zeros(optdims.c);
 
@@ -247,13 +296,39 @@ struct EquilibriumSolver::Impl
         // The left Nw x Nb block is zero. The right Nb x Nb block is identity!
         optproblem.bec.setZero();
         optproblem.bec.rightCols(dims.Nc).diagonal().setOnes();
+
+        // The functions above refer to this object, so a copy of it needs to prepare its own problem
+        prepared = this;
+    }
+
+    /// Update the optimization problem before a new equilibrium calculation.
+    auto updateOptProblem(ChemicalState const& state0, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions)
+    {
+        if(prepared != this)
+            prepareOptProblem();
+
+        // The input variables for the equilibrium calculation
+        conditions.inputValuesGetOrCompute(state0, w.array());
+
+        /// Set the right-hand side vector be of the linear equality constraints.
+        conditions.initialComponentAmountsGetOrCompute(state0, optproblem.be.array());
+
+        // Set the lower and upper bounds of the species amounts
+        setup.assembleLowerBoundsVector(restrictions, state0, optproblem.xlower);
+        setup.assembleUpperBoundsVector(restrictions, state0, optproblem.xupper);
+
+        // Set the lower and upper bounds of the *p* control variables (assigned to blocks so that the vectors are never resized)
+        optproblem.plower.head(dims.Np) = conditions.lowerBoundsControlVariablesP();
+        optproblem.pupper.head(dims.Np) = conditions.upperBoundsControlVariablesP();
     }
 
     /// Update the initial state variables before the new equilibrium calculation.
-    auto updateOptState(ChemicalState const& state0)
+    /// The Optima::State object stored in the chemical state is updated and solved in place,
+    /// so that it is not copied into the solver at the start and back at the end of a calculation.
+    auto updateOptState(ChemicalState& state0) -> Optima::State&
     {
-        // Initialize optstate with that stored in state0 (note state0 may have empty Optima::State object!)
-        optstate = state0.equilibrium().optimaState();
+        // The Optima::State object stored in state0 (note state0 may have empty Optima::State object!)
+        auto& optstate = state0.equilibrium().optimaState();
 
         // In case optstate corresponds to an equilibrium problem of different structure, initialize it with a clean slate
         if(optstate.dims.x != dims.Nx || optstate.dims.p != dims.Np || optstate.dims.be != dims.Nc || optstate.dims.c != dims.Nw + dims.Nc)  // TODO: Replace this by a code that represents the EquilibriumSpecs object used for the previous calculation. Consider a dictionary of saved optstates and corresponding EquilibriumSpecs objects in case the same ChemicalState object is used within different solvers.
@@ -277,12 +352,14 @@ struct EquilibriumSolver::Impl
         }
         else if(specs.isPressureUnknown())
             optstate.p[0] = state0.pressure();
+
+        return optstate;
     }
 
     /// Update the chemical state object with computed optimization state.
     auto updateChemicalState(ChemicalState& state, EquilibriumConditions const& conditions)
     {
-        // Update the ChemicalProps object in state
+        // Update the ChemicalProps object in state (a copy assignment between objects of the same system, which reuses the storage in state)
         auto& props = state.props();
         props = setup.chemicalProps();
 
@@ -296,20 +373,29 @@ struct EquilibriumSolver::Impl
 
         // Make sure the derivative information in the underlying chemical
         // properties of the system are zeroed out!
-        ArrayStream<double> stream;
-        props.serialize(stream);
-        props.deserialize(stream);
+        props.stripDerivatives();
+
+        // The Optima::State object in state, updated in place during the calculation
+        auto const& optstate = state.equilibrium().optimaState();
 
         // Update other state variables in the ChemicalState object
         state.setTemperature(props.temperature());
         state.setPressure(props.pressure());
-        state.setSpeciesAmounts(optstate.x.head(dims.Nn));
-        state.equilibrium().setNamesInputVariables(specs.namesInputs());
-        state.equilibrium().setNamesControlVariablesP(specs.namesControlVariablesP());
-        state.equilibrium().setNamesControlVariablesQ(specs.namesControlVariablesQ());
-        state.equilibrium().setInputVariables(conditions.inputValues());
-        state.equilibrium().setInitialComponentAmounts(optproblem.be);
-        state.equilibrium().setOptimaState(optstate);
+        state.setSpeciesAmounts(optstate.x.head(dims.Nn).array());
+
+        // Set the names of the variables only if not set yet (e.g., in a previous calculation with the same state) to avoid copying strings
+        if(state.equilibrium().namesInputVariables() != wnames)
+            state.equilibrium().setNamesInputVariables(wnames);
+        if(state.equilibrium().namesControlVariablesP() != pnames)
+            state.equilibrium().setNamesControlVariablesP(pnames);
+        if(state.equilibrium().namesControlVariablesQ() != qnames)
+            state.equilibrium().setNamesControlVariablesQ(qnames);
+
+        // Convert the input values into wvals first, since passing them directly would create a temporary array of doubles
+        wvals = conditions.inputValues().cast<double>();
+
+        state.equilibrium().setInputVariables(wvals);
+        state.equilibrium().setInitialComponentAmounts(optproblem.be.array());
     }
 
     /// Update the equilibrium sensitivity object with computed optimization sensitivity.
@@ -363,18 +449,20 @@ struct EquilibriumSolver::Impl
     auto solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult
     {
         updateOptProblem(state, conditions, restrictions);
-        updateOptState(state);
 
-        const auto optstatebkp = optstate;
+        auto& optstate = updateOptState(state);
 
         result.optima = optsolver.solve(optproblem, optstate);
 
+        // Restart a failed calculation from a clean slate, with the initial species amounts that are still in state.
+        // The Lagrange multipliers of the previous calculation are not reused in this case, since optstate is solved in place.
         if(!result.optima.succeeded)
         {
             auto optionsbkp = options;
             options.optima.backtracksearch.apply_min_max_fix_and_accept = !options.optima.backtracksearch.apply_min_max_fix_and_accept;
             setOptions(options);
-            optstate = optstatebkp;
+            optstate = Optima::State(optdims);
+            updateOptState(state);
             result.optima = optsolver.solve(optproblem, optstate);
             options = optionsbkp;
             setOptions(options);
@@ -407,7 +495,8 @@ struct EquilibriumSolver::Impl
         EquilibriumResult result;
 
         updateOptProblem(state, conditions, restrictions);
-        updateOptState(state);
+
+        auto& optstate = updateOptState(state);
 
         result.optima = optsolver.solve(optproblem, optstate, optsensitivity);
 
@@ -416,6 +505,70 @@ struct EquilibriumSolver::Impl
 
         return result;
     }
+
+    /// Ensure the worker threads and solvers for batch equilibrium calculations are available.
+    auto initializeBatchWorkers() -> void
+    {
+        const auto numthreads = options.num_threads == 0 ? ThreadPool::numHardwareThreads() : options.num_threads;
+
+        if(!workers.pool || workers.pool->numThreads() != numthreads)
+            workers.pool.reset(new ThreadPool(numthreads));
+
+        workers.solvers.reserve(numthreads);
+
+        while(workers.solvers.size() < numthreads)
+        {
+            workers.solvers.emplace_back(specs);
+            workers.solvers.back().setOptions(options);
+        }
+    }
+
+    auto solveBatch(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const* conditions) -> EquilibriumBatchResult
+    {
+        errorif(conditions && conditions->size() != states.size(), "Expecting the same number of ChemicalState and EquilibriumConditions objects "
+            "in EquilibriumSolver::solveBatch, but got ", states.size(), " and ", conditions->size(), " respectively.");
+
+        const auto begin = time();
+
+        initializeBatchWorkers();
+
+        const auto numstates = states.size();
+        const auto numthreads = workers.pool->numThreads();
+
+        EquilibriumBatchResult batch;
+        batch.cells.resize(numstates);
+        batch.cells_per_thread.assign(numthreads, 0);
+        batch.timing.threads.assign(numthreads, 0.0);
+
+        Vec<double> elapsed_cells(numstates, 0.0);
+
+        // Note that each worker thread only modifies the entries in cells_per_thread and timing.threads at its own index
+        workers.pool->parallelFor(numstates, options.batch_chunk_size, [&](Index ithread, Index i)
+        {
+            const auto start = time();
+
+            auto& solver = workers.solvers[ithread];
+
+            batch.cells[i] = conditions ?
+                solver.solve(states[i], (*conditions)[i]) :
+                solver.solve(states[i]);
+
+            elapsed_cells[i] = elapsed(start);
+
+            batch.cells_per_thread[ithread] += 1;
+            batch.timing.threads[ithread] += elapsed_cells[i];
+        });
+
+        for(auto const& dt : elapsed_cells)
+        {
+            batch.timing.cells += dt;
+            batch.timing.cells_max = std::max(batch.timing.cells_max, dt);
+        }
+
+        batch.timing.solve = elapsed(begin);
+
+        return batch;
+    }
 };
 
 EquilibriumSolver::EquilibriumSolver(ChemicalSystem const& system)
@@ -479,6 +632,16 @@ auto EquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sens
     return pimpl->solve(state, sensitivity, conditions, restrictions);
 }
 
+auto EquilibriumSolver::solveBatch(Vec<ChemicalState>& states) -> EquilibriumBatchResult
+{
+    return pimpl->solveBatch(states, nullptr);
+}
+
+auto EquilibriumSolver::solveBatch(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> EquilibriumBatchResult
+{
+    return pimpl->solveBatch(states, &conditions);
+}
+
 auto EquilibriumSolver::setOptions(EquilibriumOptions const& options) -> void
 {
     pimpl->setOptions(options);
@@ -31,10 +31,16 @@ class EquilibriumConditions;
 class EquilibriumRestrictions;
 class EquilibriumSensitivity;
 class EquilibriumSpecs;
+struct EquilibriumBatchResult;
 struct EquilibriumOptions;
 struct EquilibriumResult;
 
 /// Used for calculating chemical equilibrium states.
+/// An EquilibriumSolver object keeps internal workspace that is modified in
+/// every call to its solve methods, so the same object must not be used
+/// concurrently from multiple threads. Use one copy of the solver per thread
+/// or the method @ref solveBatch, which equilibrates many chemical states in
+/// parallel using internal copies of this solver.
 class EquilibriumSolver
 {
 public:
@@ -109,6 +115,25 @@ public:
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult;
 
+    //=================================================================================================================
+    //
+    // CHEMICAL EQUILIBRIUM METHODS FOR BATCHES OF CHEMICAL STATES
+    //
+    //=================================================================================================================
+
+    /// Equilibrate a batch of chemical states in parallel.
+    /// The chemical states are distributed among a pool of worker threads,
+    /// each owning its own copy of this solver. The number of threads and
+    /// the granularity of the work distribution are controlled with
+    /// EquilibriumOptions::num_threads and EquilibriumOptions::batch_chunk_size.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    auto solveBatch(Vec<ChemicalState>& states) -> EquilibriumBatchResult;
+
+    /// Equilibrate a batch of chemical states in parallel respecting given constraint conditions.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium for each chemical state
+    auto solveBatch(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> EquilibriumBatchResult;
+
     //=================================================================================================================
     //
     // MISCELLANEOUS METHODS
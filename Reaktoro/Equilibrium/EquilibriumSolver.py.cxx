@@ -31,6 +31,30 @@
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
 using namespace Reaktoro;
 
+/// Equilibrate in parallel the ChemicalState objects in a Python list, updating them in place.
+auto solveBatch(EquilibriumSolver& solver, py::list states, Vec<EquilibriumConditions> const* conditions) -> EquilibriumBatchResult
+{
+    Vec<ChemicalState> cstates;
+    cstates.reserve(states.size());
+    for(auto state : states)
+        cstates.push_back(state.cast<ChemicalState const&>());
+
+    EquilibriumBatchResult result;
+
+    {
+        // Release the GIL so that worker threads can call activity/thermodynamic models implemented in Python
+        py::gil_scoped_release release;
+        result = conditions ?
+            solver.solveBatch(cstates, *conditions) :
+            solver.solveBatch(cstates);
+    }
+
+    for(auto i = 0; i < cstates.size(); ++i)
+        states[i].cast<ChemicalState&>() = cstates[i];
+
+    return result;
+}
+
 void exportEquilibriumSolver(py::module& m)
 {
     py::class_<EquilibriumSolver>(m, "EquilibriumSolver")
@@ -47,6 +71,14 @@ void exportEquilibriumSolver(py::module& m)
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"))
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"), py::arg("restrictions"))
 
+        .def("solveBatch", [](EquilibriumSolver& self, py::list states)
+        {
+            return solveBatch(self, states, nullptr);
+        }, "Equilibrate a batch of chemical states in parallel.", py::arg("states"))
+        .def("solveBatch", [](EquilibriumSolver& self, py::list states, Vec<EquilibriumConditions> const& conditions)
+        {
+            return solveBatch(self, states, &conditions);
+        }, "Equilibrate a batch of chemical states in parallel respecting given constraint conditions.", py::arg("states"), py::arg("conditions"))
         .def("setOptions", &EquilibriumSolver::setOptions)
         ;
 }
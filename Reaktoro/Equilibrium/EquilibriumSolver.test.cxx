@@ -17,6 +17,7 @@
 
 // C++ includes
 #include <iomanip>
+#include <thread>
 
 // Catch includes
 #include <catch2/catch.hpp>
@@ -35,6 +36,8 @@
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcDatabase.hpp>
+#include <Reaktoro/Math/MathUtils.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelDavies.hpp>
 #include <Reaktoro/Models/ActivityModels/ActivityModelPhreeqc.hpp>
 using namespace Reaktoro;
 
@@ -297,6 +300,184 @@ TEST_CASE("Testing EquilibriumSolver", "[EquilibriumSolver]")
         }
     }
 
+    SECTION("There are many chemical states equilibrated in a batch")
+    {
+        Phases phases(db);
+        phases.add( AqueousPhase(speciate("H O Na Cl C Ca Mg Si")) );
+
+        ChemicalSystem system(phases);
+
+        const auto numstates = 40;
+
+        Vec<ChemicalState> states(numstates, ChemicalState(system));
+        Vec<EquilibriumConditions> conditions(numstates, EquilibriumConditions(system));
+
+        for(auto i = 0; i < numstates; ++i)
+        {
+            states[i].setTemperature(T, "celsius");
+            states[i].setPressure(P, "bar");
+            states[i].setSpeciesAmount("H2O"   , 55.0 , "mol");
+            states[i].setSpeciesAmount("NaCl"  , 0.01 * (i + 1), "mol");
+            states[i].setSpeciesAmount("CO2"   , 10.0 , "mol");
+            states[i].setSpeciesAmount("CaCO3" , 0.01 , "mol");
+            states[i].setSpeciesAmount("MgCO3" , 0.02 , "mol");
+            states[i].setSpeciesAmount("SiO2"  , 0.01 , "mol");
+
+            conditions[i].temperature(T + i, "celsius");
+            conditions[i].pressure(P, "bar");
+        }
+
+        // The chemical states equilibrated one by one with a single solver (used for comparison)
+        auto expected = states;
+
+        EquilibriumSolver solver(system);
+
+        options.num_threads = 4;
+        options.batch_chunk_size = 3;
+        solver.setOptions(options);
+
+        for(auto i = 0; i < numstates; ++i)
+            CHECK( solver.solve(expected[i], conditions[i]).succeeded() );
+
+        const auto batch = solver.solveBatch(states, conditions);
+
+        CHECK( batch.succeeded() );
+        CHECK( batch.cells.size() == numstates );
+        CHECK( batch.cells_per_thread.size() == 4 );
+        CHECK( batch.timing.threads.size() == 4 );
+        CHECK( batch.timing.cells_max <= batch.timing.cells );
+
+        Index total = 0;
+        for(auto count : batch.cells_per_thread)
+            total += count;
+        CHECK( total == numstates );
+
+        for(auto i = 0; i < numstates; ++i)
+        {
+            INFO("state index = " << i);
+            CHECK( states[i].temperature() == Approx(T + i + 273.15) );
+            CHECK( largestRelativeDifference(states[i].speciesAmounts(), expected[i].speciesAmounts()) == Approx(0.0).margin(1e-8) );
+            checkChemicalEquilibriumStateHasZeroDerivativeValues(states[i]);
+        }
+
+        // Equilibrate the already equilibrated states again (now using the temperature and pressure in the states)
+        const auto rebatch = solver.solveBatch(states);
+
+        CHECK( rebatch.succeeded() );
+        CHECK( rebatch.iterations() <= 3 * numstates );
+    }
+
+    SECTION("There are many equilibrium calculations with the same specifications")
+    {
+        Phases phases(db);
+        phases.add( AqueousPhase(speciate("H O Na Cl C")) );
+        phases.add( GaseousPhase("CO2(g) H2O(g)") );
+
+        ChemicalSystem system(phases);
+
+        ChemicalState state(system);
+        state.setTemperature(T, "celsius");
+        state.setPressure(P, "bar");
+        state.setSpeciesAmount("H2O"   , 55.0 , "mol");
+        state.setSpeciesAmount("NaCl"  , 0.01 , "mol");
+        state.setSpeciesAmount("CO2"   , 10.0 , "mol");
+
+        EquilibriumConditions conditions(system);
+        conditions.temperature(T, "celsius");
+        conditions.pressure(P, "bar");
+
+        EquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        // The optimization problem is prepared in the first calculation and reused in the next ones
+        // (see examples/benchmarks/bench-equilibrium-solver-allocations.cpp for the heap allocations in each calculation)
+        CHECK( solver.solve(state, conditions).succeeded() );
+        CHECK( solver.solve(state, conditions).succeeded() );
+
+        // A copy of the solver must prepare its own optimization problem and produce the same results
+        EquilibriumSolver solvercopy(solver);
+
+        auto statecopy = state;
+
+        CHECK( solver.solve(state, conditions).succeeded() );
+        CHECK( solvercopy.solve(statecopy, conditions).succeeded() );
+        CHECK( largestRelativeDifference(state.speciesAmounts(), statecopy.speciesAmounts()) == Approx(0.0).margin(1e-12) );
+
+        // The names of the equilibrium variables must still be available in the state after the calculations
+        CHECK( state.equilibrium().namesInputVariables() == Strings{"T", "P"} );
+        CHECK( statecopy.equilibrium().namesInputVariables() == Strings{"T", "P"} );
+    }
+
+    SECTION("There is a chemical system shared among several threads")
+    {
+        Phases phases(db);
+        AqueousPhase aqueousphase(speciate("H O Na Cl C Ca Mg Si"));
+        aqueousphase.setActivityModel(ActivityModelDavies());
+
+        phases.add(aqueousphase);
+
+        ChemicalSystem system(phases);
+
+        const auto numthreads = 8;
+        const auto numstates = 10; // the number of chemical states equilibrated by each thread
+
+        auto initialize = [&](ChemicalState& state, Index i)
+        {
+            state.setTemperature(T + i, "celsius");
+            state.setPressure(P, "bar");
+            state.setSpeciesAmount("H2O"   , 55.0 , "mol");
+            state.setSpeciesAmount("NaCl"  , 0.01 * (i + 1), "mol");
+            state.setSpeciesAmount("CO2"   , 10.0 , "mol");
+            state.setSpeciesAmount("CaCO3" , 0.01 , "mol");
+            state.setSpeciesAmount("MgCO3" , 0.02 , "mol");
+            state.setSpeciesAmount("SiO2"  , 0.01 , "mol");
+        };
+
+        // The chemical states equilibrated one by one in the main thread (used for comparison)
+        Vec<ChemicalState> expected(numstates, ChemicalState(system));
+
+        EquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        for(auto i = 0; i < numstates; ++i)
+        {
+            initialize(expected[i], i);
+            CHECK( solver.solve(expected[i]).succeeded() );
+        }
+
+        // The chemical states equilibrated concurrently by each thread using its own solver but the same chemical system
+        Vec<Vec<ChemicalState>> states(numthreads, Vec<ChemicalState>(numstates, ChemicalState(system)));
+        Vec<Vec<bool>> succeeded(numthreads, Vec<bool>(numstates, false));
+
+        Vec<std::thread> threads;
+        for(auto k = 0; k < numthreads; ++k)
+            threads.emplace_back([&, k]
+            {
+                EquilibriumSolver tsolver(system);
+                tsolver.setOptions(options);
+                for(auto i = 0; i < numstates; ++i)
+                {
+                    initialize(states[k][i], i);
+                    succeeded[k][i] = tsolver.solve(states[k][i]).succeeded();
+                    states[k][i].props().update(states[k][i]); // also evaluate the properties of the system concurrently
+                }
+            });
+
+        for(auto& thread : threads)
+            thread.join();
+
+        for(auto k = 0; k < numthreads; ++k)
+        {
+            for(auto i = 0; i < numstates; ++i)
+            {
+                INFO("thread index = " << k << ", state index = " << i);
+                CHECK( succeeded[k][i] );
+                CHECK( largestRelativeDifference(states[k][i].speciesAmounts(), expected[i].speciesAmounts()) == Approx(0.0).margin(1e-8) );
+                CHECK( largestRelativeDifference(states[k][i].props().speciesActivityCoefficientsLn(), expected[i].props().speciesActivityCoefficientsLn()) == Approx(0.0).margin(1e-8) );
+            }
+        }
+    }
+
     SECTION("There is an aqueous solution and a gaseous solution")
     {
         Phases phases(db);
@@ -751,6 +751,11 @@ auto EquilibriumSpecs::addConstraints(EquationConstraints const& constraints) ->
         econstraints_ids.push_back(constraintid);
     }
     errorif(!constraints.fn, "The system of equation constraints with ids `", constraints.ids, "` should not have an empty function.");
+    errorif(constraints.dependencies.size() && constraints.dependencies.size() != constraints.ids.size(), "The system of equation constraints with ids `", constraints.ids, "` should have either no species dependencies or one entry of species dependencies per equation constraint.");
+    const auto Nn = m_system.species().size();
+    for(auto const& dependencies : constraints.dependencies)
+        for(auto j : dependencies)
+            errorif(j >= Nn, "The system of equation constraints with ids `", constraints.ids, "` has a species dependency with index ", j, ", but the chemical system has only ", Nn, " species.");
     econstraints_system.push_back(constraints);
 }
 
@@ -923,6 +928,12 @@ auto EquilibriumSpecs::assembleEquationConstraints() const -> EquationConstraint
     for(auto const& x : econstraints_system)
         econstraints.ids.insert(econstraints.ids.end(), x.ids.begin(), x.ids.end());
 
+    // Collect the species dependencies of the equation constraints only if known for all of them
+    const auto sparse = econstraints_single.empty() && std::all_of(econstraints_system.begin(), econstraints_system.end(), RKT_LAMBDA(x, !x.dependencies.empty()));
+    if(sparse)
+        for(auto const& x : econstraints_system)
+            econstraints.dependencies.insert(econstraints.dependencies.end(), x.dependencies.begin(), x.dependencies.end());
+
     // The total number of equation constraints
     const auto num_econstraints = econstraints.ids.size();
 
@@ -158,6 +158,14 @@ struct EquationConstraints
 
     /// The function defining the system of equations to be satisfied at chemical equilibrium.
     Func fn;
+
+    /// The indices of the species on whose amounts each equation constraint depends (optional).
+    /// If given, this must contain one entry per equation constraint. The residual of each equation
+    /// constraint is then assumed to depend only on the amounts of the given species and on those of
+    /// the species in phases coupled with their phases (e.g., an ion exchange phase coupled with an
+    /// aqueous phase). This permits the Jacobian of the residuals with respect to species amounts to
+    /// be assembled sparsely. If empty, each equation constraint is assumed to depend on all species.
+    Vec<Indices> dependencies;
 };
 
 /// Used to define reactivity restrictions among species in the chemical
@@ -78,6 +78,7 @@ void exportEquilibriumSpecs(py::module& m)
         .def(py::init<>())
         .def_readwrite("ids", &EquationConstraints::ids)
         .def_readwrite("fn", &EquationConstraints::fn)
+        .def_readwrite("dependencies", &EquationConstraints::dependencies)
         ;
 
     py::class_<ReactivityConstraint>(m, "ReactivityConstraint")
@@ -334,6 +334,24 @@ TEST_CASE("Testing EquilibriumSpecs", "[EquilibriumSpecs]")
         CHECK( v[5] == props.entropy() - w[5] );
     }
 
+    SECTION("Checking species dependencies in systems of equation constraints")
+    {
+        const auto Nn = system.species().size();
+
+        EquationConstraints constraints;
+        constraints.ids = { "c1", "c2" };
+        constraints.fn = [](ChemicalProps const& props, VectorXrConstRef const& w, VectorXrConstRef const& p) -> VectorXr { return VectorXr::Zero(2); };
+
+        constraints.dependencies = { { 0 }, { Nn } };
+        CHECK_THROWS( EquilibriumSpecs(system).addConstraints(constraints) );
+
+        constraints.dependencies = { { 0 } };
+        CHECK_THROWS( EquilibriumSpecs(system).addConstraints(constraints) );
+
+        constraints.dependencies = { { 0 }, { Nn - 1 } };
+        CHECK_NOTHROW( EquilibriumSpecs(system).addConstraints(constraints) );
+    }
+
     SECTION("Checking lambda functions in chemical potential constraints")
     {
         const auto constraintEh = GENERATE(true, false); // constrain Eh if true, pE if false (cannot be both constrained because of same titrant e-)
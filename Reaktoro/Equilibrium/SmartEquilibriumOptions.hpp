@@ -22,6 +22,16 @@
 
 namespace Reaktoro {
 
+/// The policies for selecting the learned records evicted when the memory budget of a smart equilibrium solver is exceeded.
+enum class SmartEquilibriumEvictionPolicy
+{
+    /// The records with the lowest usage counts are evicted first (the oldest first in case of ties).
+    LeastFrequentlyUsed,
+
+    /// The records used or learned the longest time ago are evicted first.
+    LeastRecentlyUsed,
+};
+
 /// The options for the smart equilibrium calculations.
 /// @see SmartEquilibriumSolver
 struct SmartEquilibriumOptions
@@ -50,6 +60,75 @@ struct SmartEquilibriumOptions
 
     /// The step length used to discretize pressure in the temperature-pressure space when storing learned calculations (in Pa).
     double pressure_step = 25.0e+5;
+
+    /// The indication whether the temperature-pressure grid cells are adaptively split and merged.
+    /// When enabled, the learned records are stored in cells that start with temperature and
+    /// pressure lengths equal to the steps above doubled @ref adaptive_max_coarsening times. A cell
+    /// whose acceptance rate of predictions drops below @ref adaptive_split_acceptance is split into
+    /// four cells with half its lengths (at most @ref adaptive_max_refinement times below the steps
+    /// above), and four sibling cells that become sparse are merged back. These options should be
+    /// set before any learning operation, and learned data can only be loaded with the same ones.
+    bool adaptive_cells = false;
+
+    /// The number of times the temperature and pressure steps are doubled for the coarsest cells when cells are adaptive.
+    Index adaptive_max_coarsening = 2;
+
+    /// The number of times the temperature and pressure steps are halved for the finest cells when cells are adaptive.
+    Index adaptive_max_refinement = 2;
+
+    /// The number of predictions attempted in a cell after which its acceptance rate is assessed when cells are adaptive.
+    Index adaptive_min_predictions = 20;
+
+    /// The acceptance rate of predictions in a cell below which it is split when cells are adaptive.
+    double adaptive_split_acceptance = 0.5;
+
+    /// The minimum number of learned records in a cell for it to be split when cells are adaptive.
+    Index adaptive_split_min_records = 16;
+
+    /// The number of learned records in four sibling cells below which they are merged when cells are adaptive.
+    Index adaptive_merge_max_records = 4;
+
+    /// The indication whether the neighbouring temperature-pressure grid cells are searched when no prediction is accepted in the cell containing the state.
+    bool search_neighbour_cells = false;
+
+    /// The indication whether the sensitivity derivatives of the learned records are stored in single precision.
+    /// Storing these derivatives, the largest part of each learned record, as 32-bit floating-point
+    /// numbers halves the memory used by the learned data. The derivatives of the chemical potentials
+    /// of the primary species used in the acceptance test are always stored in double precision.
+    bool single_precision_derivatives = false;
+
+    /// The number of nearest learned records tested first when searching a cluster during a smart prediction.
+    /// The learned records of each cluster are indexed with a k-d tree over their input conditions and
+    /// initial component amounts, each scaled by the magnitude of its value at the first record of the
+    /// cluster plus one. When this number is positive, the nearest records to the current input
+    /// conditions and component amounts are tested first, before the remaining ones are tested in the
+    /// order of their usage counts. Set to zero to disable the nearest-neighbour search.
+    Index search_num_nearest = 0;
+
+    /// The minimum number of records in a cluster for the nearest-neighbour search to be used in it.
+    Index search_min_records = 32;
+
+    /// The indication whether the remaining records of a cluster are tested when none of its nearest records pass the error test.
+    bool search_fallback = true;
+
+    /// The maximum number of learned records in a temperature-pressure grid cell (zero means no limit).
+    Index max_records_per_cell = 0;
+
+    /// The maximum number of learned records in all temperature-pressure grid cells (zero means no limit).
+    Index max_records = 0;
+
+    /// The maximum estimated memory used by the learned records in a temperature-pressure grid cell (in bytes, zero means no limit).
+    Index max_bytes_per_cell = 0;
+
+    /// The maximum estimated memory used by the learned records in all temperature-pressure grid cells (in bytes, zero means no limit).
+    Index max_bytes = 0;
+
+    /// The policy for selecting the learned records evicted when any of the limits above is exceeded.
+    SmartEquilibriumEvictionPolicy eviction_policy = SmartEquilibriumEvictionPolicy::LeastFrequentlyUsed;
+
+    /// The fraction of an exceeded limit freed at once when evicting learned records.
+    /// Evicting records in batches amortizes the cost of updating the search data structures of the affected clusters.
+    double eviction_fraction = 0.1;
 };
 
 } // namespace Reaktoro
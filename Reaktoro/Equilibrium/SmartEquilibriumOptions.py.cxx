@@ -24,12 +24,37 @@ using namespace Reaktoro;
 
 void exportSmartEquilibriumOptions(py::module& m)
 {
+    py::enum_<SmartEquilibriumEvictionPolicy>(m, "SmartEquilibriumEvictionPolicy")
+        .value("LeastFrequentlyUsed", SmartEquilibriumEvictionPolicy::LeastFrequentlyUsed, "The records with the lowest usage counts are evicted first (the oldest first in case of ties).")
+        .value("LeastRecentlyUsed", SmartEquilibriumEvictionPolicy::LeastRecentlyUsed, "The records used or learned the longest time ago are evicted first.")
+        ;
+
     py::class_<SmartEquilibriumOptions>(m, "SmartEquilibriumOptions")
         .def(py::init<>())
         .def_readwrite("learning", &SmartEquilibriumOptions::learning, "The options for the chemical equilibrium calculations during learning operations.")
         .def_readwrite("reltol_negative_amounts", &SmartEquilibriumOptions::reltol_negative_amounts, "The relative tolerance for negative species amounts when predicting with first-order Taylor approximation.")
         .def_readwrite("reltol", &SmartEquilibriumOptions::reltol, "The relative tolerance used in the acceptance test for the predicted chemical equilibrium state.")
         .def_readwrite("abstol", &SmartEquilibriumOptions::abstol, "The absolute tolerance used in the acceptance test for the predicted chemical equilibrium state.")
+        .def_readwrite("temperature_step", &SmartEquilibriumOptions::temperature_step, "The step length used to discretize temperature in the temperature-pressure space when storing learned calculations (in K).")
+        .def_readwrite("pressure_step", &SmartEquilibriumOptions::pressure_step, "The step length used to discretize pressure in the temperature-pressure space when storing learned calculations (in Pa).")
+        .def_readwrite("adaptive_cells", &SmartEquilibriumOptions::adaptive_cells, "The indication whether the temperature-pressure grid cells are adaptively split and merged.")
+        .def_readwrite("adaptive_max_coarsening", &SmartEquilibriumOptions::adaptive_max_coarsening, "The number of times the temperature and pressure steps are doubled for the coarsest cells when cells are adaptive.")
+        .def_readwrite("adaptive_max_refinement", &SmartEquilibriumOptions::adaptive_max_refinement, "The number of times the temperature and pressure steps are halved for the finest cells when cells are adaptive.")
+        .def_readwrite("adaptive_min_predictions", &SmartEquilibriumOptions::adaptive_min_predictions, "The number of predictions attempted in a cell after which its acceptance rate is assessed when cells are adaptive.")
+        .def_readwrite("adaptive_split_acceptance", &SmartEquilibriumOptions::adaptive_split_acceptance, "The acceptance rate of predictions in a cell below which it is split when cells are adaptive.")
+        .def_readwrite("adaptive_split_min_records", &SmartEquilibriumOptions::adaptive_split_min_records, "The minimum number of learned records in a cell for it to be split when cells are adaptive.")
+        .def_readwrite("adaptive_merge_max_records", &SmartEquilibriumOptions::adaptive_merge_max_records, "The number of learned records in four sibling cells below which they are merged when cells are adaptive.")
+        .def_readwrite("search_neighbour_cells", &SmartEquilibriumOptions::search_neighbour_cells, "The indication whether the neighbouring temperature-pressure grid cells are searched when no prediction is accepted in the cell containing the state.")
+        .def_readwrite("single_precision_derivatives", &SmartEquilibriumOptions::single_precision_derivatives, "The indication whether the sensitivity derivatives of the learned records are stored in single precision.")
+        .def_readwrite("search_num_nearest", &SmartEquilibriumOptions::search_num_nearest, "The number of nearest learned records tested first when searching a cluster during a smart prediction.")
+        .def_readwrite("search_min_records", &SmartEquilibriumOptions::search_min_records, "The minimum number of records in a cluster for the nearest-neighbour search to be used in it.")
+        .def_readwrite("search_fallback", &SmartEquilibriumOptions::search_fallback, "The indication whether the remaining records of a cluster are tested when none of its nearest records pass the error test.")
+        .def_readwrite("max_records_per_cell", &SmartEquilibriumOptions::max_records_per_cell, "The maximum number of learned records in a temperature-pressure grid cell (zero means no limit).")
+        .def_readwrite("max_records", &SmartEquilibriumOptions::max_records, "The maximum number of learned records in all temperature-pressure grid cells (zero means no limit).")
+        .def_readwrite("max_bytes_per_cell", &SmartEquilibriumOptions::max_bytes_per_cell, "The maximum estimated memory used by the learned records in a temperature-pressure grid cell (in bytes, zero means no limit).")
+        .def_readwrite("max_bytes", &SmartEquilibriumOptions::max_bytes, "The maximum estimated memory used by the learned records in all temperature-pressure grid cells (in bytes, zero means no limit).")
+        .def_readwrite("eviction_policy", &SmartEquilibriumOptions::eviction_policy, "The policy for selecting the learned records evicted when any of the memory limits is exceeded.")
+        .def_readwrite("eviction_fraction", &SmartEquilibriumOptions::eviction_fraction, "The fraction of an exceeded limit freed at once when evicting learned records.")
         ;
 }
 
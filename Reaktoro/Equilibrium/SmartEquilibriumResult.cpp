@@ -28,6 +28,7 @@ auto SmartEquilibriumTiming::operator+=(const SmartEquilibriumTiming& other) ->
     learning_sensitivity_matrix += other.learning_sensitivity_matrix;
     learning_error_control_matrices += other.learning_error_control_matrices;
     learning_storage += other.learning_storage;
+    learning_eviction += other.learning_eviction;
     prediction += other.prediction;
     prediction_search += other.prediction_search;
     prediction_error_control += other.prediction_error_control;
@@ -43,6 +44,12 @@ auto SmartEquilibriumResultDuringPrediction::operator+=(const SmartEquilibriumRe
     failed_with_species = other.failed_with_species;
     failed_with_amount = other.failed_with_amount;
     failed_with_chemical_potential = other.failed_with_chemical_potential;
+    num_clusters_visited += other.num_clusters_visited;
+    num_records_tested += other.num_records_tested;
+    num_nearest_records_tested += other.num_nearest_records_tested;
+    accepted_nearest = other.accepted_nearest;
+    num_cells_visited += other.num_cells_visited;
+    accepted_neighbour = other.accepted_neighbour;
 
     return *this;
 }
@@ -50,6 +57,17 @@ auto SmartEquilibriumResultDuringPrediction::operator+=(const SmartEquilibriumRe
 auto SmartEquilibriumResultDuringLearning::operator+=(const SmartEquilibriumResultDuringLearning& other) -> SmartEquilibriumResultDuringLearning&
 {
     solve +=other.solve;
+    num_evicted_records += other.num_evicted_records;
+
+    return *this;
+}
+
+auto SmartEquilibriumResultDatabase::operator+=(const SmartEquilibriumResultDatabase& other) -> SmartEquilibriumResultDatabase&
+{
+    num_records = other.num_records;
+    num_bytes = other.num_bytes;
+    num_evicted_records = other.num_evicted_records;
+    num_cells = other.num_cells;
 
     return *this;
 }
@@ -58,6 +76,7 @@ auto SmartEquilibriumResult::operator+=(const SmartEquilibriumResult& other) ->
 {
     prediction += other.prediction;
     learning += other.learning;
+    database += other.database;
     timing   += other.timing;
 
     return *this;
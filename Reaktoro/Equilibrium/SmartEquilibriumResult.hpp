@@ -47,6 +47,9 @@ struct SmartEquilibriumTiming
     /// The time spent for storing the computed chemical state into the tree of knowledge (in seconds).
     double learning_storage = 0.0;
 
+    /// The time spent for evicting learned records to respect the memory budget during the learning operation (in seconds).
+    double learning_eviction = 0.0;
+
     /// The time spent for the smart chemical equilibrium state prediction (in seconds).
     double prediction = 0.0;
 
@@ -82,6 +85,24 @@ struct SmartEquilibriumResultDuringPrediction
     /// The amount of the species that caused the smart approximation to fail.
     double failed_with_chemical_potential;
 
+    /// The number of clusters visited while searching for a learned record that passes the error test.
+    Index num_clusters_visited = 0;
+
+    /// The number of learned records on which the error test was applied while searching.
+    Index num_records_tested = 0;
+
+    /// The number of learned records found with the nearest-neighbour search on which the error test was applied.
+    Index num_nearest_records_tested = 0;
+
+    /// The indication whether the accepted learned record was found with the nearest-neighbour search.
+    bool accepted_nearest = false;
+
+    /// The number of temperature-pressure grid cells visited while searching (including neighbouring cells, if searched).
+    Index num_cells_visited = 0;
+
+    /// The indication whether the accepted learned record was found in a neighbouring temperature-pressure grid cell.
+    bool accepted_neighbour = false;
+
     // Self addition assignment to accumulate results.
     auto operator+=(const SmartEquilibriumResultDuringPrediction& other) -> SmartEquilibriumResultDuringPrediction&;
 };
@@ -93,10 +114,33 @@ struct SmartEquilibriumResultDuringLearning
     /// The result of the conventional iterative chemical equilibrium calculation in the learning operation.
     EquilibriumResult solve;
 
+    /// The number of learned records evicted to respect the memory budget after the learning operation.
+    Index num_evicted_records = 0;
+
     /// Self addition assignment to accumulate results.
     auto operator+=(const SmartEquilibriumResultDuringLearning& other) -> SmartEquilibriumResultDuringLearning&;
 };
 
+/// Used to describe the size of the learned data of a smart equilibrium solver after a smart chemical equilibrium calculation.
+/// @see SmartEquilibriumResult
+struct SmartEquilibriumResultDatabase
+{
+    /// The number of learned records currently stored.
+    Index num_records = 0;
+
+    /// The estimated memory used by the learned records currently stored (in bytes).
+    Index num_bytes = 0;
+
+    /// The number of learned records evicted since the creation of the solver.
+    Index num_evicted_records = 0;
+
+    /// The number of temperature-pressure grid cells currently in the grid.
+    Index num_cells = 0;
+
+    /// Self addition assignment to accumulate results.
+    auto operator+=(const SmartEquilibriumResultDatabase& other) -> SmartEquilibriumResultDatabase&;
+};
+
 /// Used to describe the result of a smart chemical equilibrium calculation.
 struct SmartEquilibriumResult
 {
@@ -121,6 +165,9 @@ struct SmartEquilibriumResult
     /// The result of the learning operation (if there was learning).
     SmartEquilibriumResultDuringLearning learning;
 
+    /// The size of the learned data after the smart chemical equilibrium calculation.
+    SmartEquilibriumResultDatabase database;
+
     /// The timing information of the operations during a smart chemical equilibrium calculation.
     SmartEquilibriumTiming timing;
 
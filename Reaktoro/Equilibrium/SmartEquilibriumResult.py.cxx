@@ -33,6 +33,7 @@ void exportSmartEquilibriumResult(py::module& m)
         .def_readwrite("learning_sensitivity_matrix", &SmartEquilibriumTiming::learning_sensitivity_matrix, "The time spent for computing the sensitivity matrix during the learning operation (in seconds).")
         .def_readwrite("learning_error_control_matrices", &SmartEquilibriumTiming::learning_error_control_matrices, "The time spent for computing the error control matrices during the learning operation (in seconds).")
         .def_readwrite("learning_storage", &SmartEquilibriumTiming::learning_storage, "The time spent for storing the computed chemical state into the tree of knowledge (in seconds).")
+        .def_readwrite("learning_eviction", &SmartEquilibriumTiming::learning_eviction, "The time spent for evicting learned records to respect the memory budget during the learning operation (in seconds).")
         .def_readwrite("prediction", &SmartEquilibriumTiming::prediction, "The time spent for the smart chemical equilibrium state prediction (in seconds).")
         .def_readwrite("prediction_search", &SmartEquilibriumTiming::prediction_search, "The time spent for the search operation during a smart prediction (in seconds).")
         .def_readwrite("prediction_error_control", &SmartEquilibriumTiming::prediction_error_control, "The time spent during on error control while searching during a smart prediction (in seconds).")
@@ -47,12 +48,28 @@ void exportSmartEquilibriumResult(py::module& m)
         .def_readwrite("failed_with_species", &SmartEquilibriumResultDuringPrediction::failed_with_species)
         .def_readwrite("failed_with_amount", &SmartEquilibriumResultDuringPrediction::failed_with_amount)
         .def_readwrite("failed_with_chemical_potential", &SmartEquilibriumResultDuringPrediction::failed_with_chemical_potential)
+        .def_readwrite("num_clusters_visited", &SmartEquilibriumResultDuringPrediction::num_clusters_visited)
+        .def_readwrite("num_records_tested", &SmartEquilibriumResultDuringPrediction::num_records_tested)
+        .def_readwrite("num_nearest_records_tested", &SmartEquilibriumResultDuringPrediction::num_nearest_records_tested)
+        .def_readwrite("accepted_nearest", &SmartEquilibriumResultDuringPrediction::accepted_nearest)
+        .def_readwrite("num_cells_visited", &SmartEquilibriumResultDuringPrediction::num_cells_visited)
+        .def_readwrite("accepted_neighbour", &SmartEquilibriumResultDuringPrediction::accepted_neighbour)
         .def(py::self += py::self)
         ;
 
     py::class_<SmartEquilibriumResultDuringLearning>(m, "SmartEquilibriumResultDuringLearning")
         .def(py::init<>())
         .def_readwrite("solve", &SmartEquilibriumResultDuringLearning::solve)
+        .def_readwrite("num_evicted_records", &SmartEquilibriumResultDuringLearning::num_evicted_records)
+        .def(py::self += py::self)
+        ;
+
+    py::class_<SmartEquilibriumResultDatabase>(m, "SmartEquilibriumResultDatabase")
+        .def(py::init<>())
+        .def_readwrite("num_records", &SmartEquilibriumResultDatabase::num_records, "The number of learned records currently stored.")
+        .def_readwrite("num_bytes", &SmartEquilibriumResultDatabase::num_bytes, "The estimated memory used by the learned records currently stored (in bytes).")
+        .def_readwrite("num_evicted_records", &SmartEquilibriumResultDatabase::num_evicted_records, "The number of learned records evicted since the creation of the solver.")
+        .def_readwrite("num_cells", &SmartEquilibriumResultDatabase::num_cells, "The number of temperature-pressure grid cells currently containing learned records.")
         .def(py::self += py::self)
         ;
 
@@ -65,6 +82,7 @@ void exportSmartEquilibriumResult(py::module& m)
         .def("iterations", &SmartEquilibriumResult::iterations, "Return the number of iterations in the calculation.")
         .def_readwrite("prediction", &SmartEquilibriumResult::prediction)
         .def_readwrite("learning", &SmartEquilibriumResult::learning)
+        .def_readwrite("database", &SmartEquilibriumResult::database)
         .def_readwrite("timing", &SmartEquilibriumResult::timing)
         ;
 }
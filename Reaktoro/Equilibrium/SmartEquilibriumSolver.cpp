@@ -17,14 +17,24 @@
 
 #include "SmartEquilibriumSolver.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+
+// Optima includes
+#include <Optima/State.hpp>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/BinaryIO.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
-#include <Reaktoro/Equilibrium/EquilibriumPredictor.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
@@ -35,26 +45,153 @@
 namespace Reaktoro {
 namespace detail {
 
-/// Compute the step-round value of a given number.
-/// This method computes the step-round value of a given number for a given step length separating the set of step-rounded values.
-/// For example, if `step = 5` and `7.5 <= num <= 12.5`, `sround(num, step) => 10`.
-/// @param num The number for which its step-rounded value is sought
-/// @param step The length between step-rounded values
-auto sround(double num, double step) -> long
+/// The identifier written at the beginning of the binary files of learned data of SmartEquilibriumSolver.
+const auto smartEquilibriumFileMagic = "ReaktoroSmartEquilibrium";
+
+/// The version of the format of the binary files of learned data of SmartEquilibriumSolver.
+const auto smartEquilibriumFileVersion = 7;
+
+/// The type of the row-major matrix views of the packed derivatives of the chemical potentials of the primary species.
+using RowMajorMatrixXdConstMap = Eigen::Map<Eigen::Matrix<double, -1, -1, Eigen::RowMajor> const>;
+
+/// Return the estimated memory used by a learned record in a cluster of SmartEquilibriumSolver (in bytes).
+auto estimatedRecordBytes(SmartEquilibriumSolver::Cluster const& cluster) -> Index
+{
+    const Index nx = cluster.nx;
+    const Index ny = cluster.ny;
+    const Index np = cluster.iprimary.size();
+
+    // The memory used by the reference values of x and y, the chemical potentials of the primary species, the products in dmudx0 and the state of the optimization solver
+    const Index valuesbytes = sizeof(double) * (nx + ny + 2 * np + cluster.no);
+
+    // The memory used by the derivatives dy/dx and the derivatives of the chemical potentials of the primary species
+    const Index derivativesbytes = (cluster.singleprecision ? sizeof(float) : sizeof(double)) * ny * nx + sizeof(double) * np * nx;
+
+    // The memory used by the usage data of the record (last use and its entries in the priority queue of the cluster)
+    const Index usagebytes = 3 * sizeof(Index);
+
+    // The memory used by the point of the record in the k-d tree of its cluster
+    const Index treebytes = sizeof(double) * nx + 4 * sizeof(Index);
+
+    return valuesbytes + derivativesbytes + usagebytes + treebytes;
+}
+
+/// Return the number of values in a state of the optimization solver stored in a learned record.
+auto numOptimaStateValues(Optima::State const& optstate) -> Index
+{
+    return optstate.x.size() + optstate.p.size() + optstate.ye.size() + optstate.s.size();
+}
+
+/// Append the values in a state of the optimization solver to an array of numbers.
+auto appendOptimaState(Vec<double>& data, Optima::State const& optstate) -> void
+{
+    data.insert(data.end(), optstate.x.data(), optstate.x.data() + optstate.x.size());
+    data.insert(data.end(), optstate.p.data(), optstate.p.data() + optstate.p.size());
+    data.insert(data.end(), optstate.ye.data(), optstate.ye.data() + optstate.ye.size());
+    data.insert(data.end(), optstate.s.data(), optstate.s.data() + optstate.s.size());
+}
+
+/// Set the values in a state of the optimization solver from those stored in a learned record.
+auto setOptimaState(Optima::State& optstate, double const* values) -> void
+{
+    optstate.x  = VectorXdConstMap(values, optstate.x.size());  values += optstate.x.size();
+    optstate.p  = VectorXdConstMap(values, optstate.p.size());  values += optstate.p.size();
+    optstate.ye = VectorXdConstMap(values, optstate.ye.size()); values += optstate.ye.size();
+    optstate.s  = VectorXdConstMap(values, optstate.s.size());
+}
+
+/// Append the coefficients of a vector to an array of numbers.
+template<typename T, typename Derived>
+auto append(Vec<T>& data, Eigen::DenseBase<Derived> const& values) -> void
+{
+    for(auto i = 0; i < values.size(); ++i)
+        data.push_back(static_cast<T>(values.derived()[i]));
+}
+
+/// Remove the blocks of an array of numbers (each with given number of entries) that are not marked to be kept.
+template<typename T>
+auto compact(Vec<T>& data, Index stride, Vec<bool> const& keep) -> void
+{
+    Index j = 0;
+    for(auto k = 0; k < keep.size(); ++k)
+    {
+        if(!keep[k])
+            continue;
+        if(j != k)
+            std::copy_n(data.begin() + k * stride, stride, data.begin() + j * stride);
+        j += 1;
+    }
+    data.resize(j * stride);
+}
+
+/// Set the canonical form of the reactivity restrictions of a chemical equilibrium calculation (empty if there are none).
+auto canonicalRestrictions(EquilibriumRestrictions const& restrictions, SmartEquilibriumSolver::Restrictions& canonical) -> void
+{
+    canonical.clear();
+    for(auto ispecies : restrictions.speciesCannotIncrease())
+        canonical.emplace_back(0, ispecies, 0.0);
+    for(auto ispecies : restrictions.speciesCannotDecrease())
+        canonical.emplace_back(1, ispecies, 0.0);
+    for(auto [ispecies, value] : restrictions.speciesCannotIncreaseAbove())
+        canonical.emplace_back(2, ispecies, value);
+    for(auto [ispecies, value] : restrictions.speciesCannotDecreaseBelow())
+        canonical.emplace_back(3, ispecies, value);
+
+    // Sort the restrictions so that they do not depend on the iteration order of the sets and maps
+    std::sort(canonical.begin(), canonical.end());
+}
+
+/// Write the canonical form of reactivity restrictions using a BinaryWriter object.
+auto writeRestrictions(BinaryWriter& writer, SmartEquilibriumSolver::Restrictions const& restrictions) -> void
+{
+    writer.writeValues(vectorize(restrictions, RKT_LAMBDA(x, std::get<0>(x))));
+    writer.writeValues(vectorize(restrictions, RKT_LAMBDA(x, std::get<1>(x))));
+    writer.writeValues(vectorize(restrictions, RKT_LAMBDA(x, std::get<2>(x))));
+}
+
+/// Read the canonical form of reactivity restrictions using a BinaryReader object.
+auto readRestrictions(BinaryReader& reader) -> SmartEquilibriumSolver::Restrictions
 {
-    return round(num / step) * step;
+    const auto kinds = reader.readValues<Vec<Index>>();
+    const auto species = reader.readValues<Vec<Index>>();
+    const auto values = reader.readValues<Vec<double>>();
+    errorif(kinds.size() != species.size() || kinds.size() != values.size(), "Inconsistent reactivity restrictions in a SmartEquilibriumSolver file.");
+    SmartEquilibriumSolver::Restrictions restrictions;
+    for(auto i = 0; i < kinds.size(); ++i)
+        restrictions.emplace_back(kinds[i], species[i], values[i]);
+    return restrictions;
+}
+
+/// Write a PriorityQueue object using a BinaryWriter object.
+auto writePriorityQueue(BinaryWriter& writer, PriorityQueue const& queue) -> void
+{
+    writer.writeValues(queue.priorities());
+    writer.writeValues(queue.order());
+}
+
+/// Read a PriorityQueue object using a BinaryReader object.
+auto readPriorityQueue(BinaryReader& reader) -> PriorityQueue
+{
+    const auto priorities = reader.readValues<Deque<Index>>();
+    const auto order = reader.readValues<Deque<Index>>();
+    errorif(priorities.size() != order.size(), "Inconsistent priority queue data in a SmartEquilibriumSolver file.");
+    return PriorityQueue::withInitialPrioritiesAndOrder(priorities, order);
 }
 
 } // namespace detail
 
 struct SmartEquilibriumSolver::Impl
 {
+    EquilibriumSpecs specs;
+
     EquilibriumSolver solver;
 
     EquilibriumSensitivity sensitivity;
 
     EquilibriumConditions conditions;
 
+    EquilibriumRestrictions restrictions;
+
     SmartEquilibriumOptions options;
 
     SmartEquilibriumResult result;
@@ -62,10 +199,74 @@ struct SmartEquilibriumSolver::Impl
     /// The temperature-pressure grid containing learned calculations for speficic temperature-pressure intervals.
     SmartEquilibriumSolver::Grid grid;
 
+    /// The auxiliary vector of input conditions and initial component amounts used in the nearest-neighbour search.
+    ArrayXd treepoint;
+
+    /// The auxiliary vector of scaled input conditions and initial component amounts used in the nearest-neighbour search.
+    VectorXd treekey;
+
+    /// The auxiliary vector of indices of the nearest records found in a cluster.
+    Vec<Index> inearest;
+
+    /// The reactivity restrictions of the current calculation in canonical form (only clusters learned with the same restrictions are used).
+    Restrictions currentrestrictions;
+
+    /// The lower bounds of the species amounts imposed by the reactivity restrictions of the current calculation.
+    ArrayXd nlower;
+
+    /// The upper bounds of the species amounts imposed by the reactivity restrictions of the current calculation.
+    ArrayXd nupper;
+
+    /// The number of smart equilibrium calculations performed so far (used to identify when records were last used).
+    Index clock = 0;
+
+    /// The number of species in the chemical system.
+    Index Nn = 0;
+
+    /// The number of control variables *p* in the chemical equilibrium problem.
+    Index Np = 0;
+
+    /// The number of control variables *q* in the chemical equilibrium problem.
+    Index Nq = 0;
+
+    /// The number of input variables *w* in the chemical equilibrium problem.
+    Index Nw = 0;
+
+    /// The index of temperature in the input variables *w* (or `Nw` if temperature is unknown and thus in *p*).
+    Index iTw = 0;
+
+    /// The index of pressure in the input variables *w* (or `Nw` if pressure is unknown and thus in *p*).
+    Index iPw = 0;
+
+    /// The auxiliary vector of input variables and initial component amounts *x = (w, c)* used in the predictions.
+    VectorXd x;
+
+    /// The auxiliary vector of differences between *x* and its value at a learned record.
+    VectorXd dx;
+
+    /// The auxiliary vector of predicted species amounts, control variables and chemical properties *y = (n, p, q, u)*.
+    VectorXd y;
+
+    /// The auxiliary matrix of derivatives *dy/dx* of a learned record converted from single to double precision.
+    MatrixXd dydx;
+
+    /// The auxiliary vector of predicted changes in the chemical potentials of the primary species of all records in a cluster.
+    VectorXd dmu;
+
+    /// The indication whether each record of a cluster passes the error test (as evaluated by @ref passErrorTests).
+    Eigen::Array<bool, 1, -1> passed;
+
     /// Construct a SmartEquilibriumSolver::Impl object with given equilibrium problem specifications.
     Impl(EquilibriumSpecs const& specs)
-    : solver(specs), sensitivity(specs), conditions(specs)
+    : specs(specs), solver(specs), sensitivity(specs), conditions(specs), restrictions(specs.system())
     {
+        Nn = specs.system().species().size();
+        Np = specs.numControlVariablesP();
+        Nq = specs.numControlVariablesQ();
+        Nw = specs.numInputs();
+        iTw = index(specs.namesInputs(), "T");
+        iPw = index(specs.namesInputs(), "P");
+
         // Initialize the equilibrium solver with the default options
         setOptions(options);
     }
@@ -80,43 +281,24 @@ struct SmartEquilibriumSolver::Impl
     {
         conditions.temperature(state.temperature());
         conditions.pressure(state.pressure());
-        return solve(state, conditions);
+        return solve(state, nullptr, conditions, restrictions);
     }
 
     auto solve(ChemicalState& state, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-        return {};
+        conditions.temperature(state.temperature());
+        conditions.pressure(state.pressure());
+        return solve(state, nullptr, conditions, restrictions);
     }
 
     auto solve(ChemicalState& state, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
     {
-        tic(SOLVE_STEP)
-                 
-        // Save a backup state in case the smart prediction fails.
-        const auto statebkp = state;
-
-        // Reset the result of the last smart equilibrium calculation
-        result = {};
-
-        // Perform a smart prediction of the chemical state
-        timeit( predict(state, conditions), result.timing.prediction= )
-
-        // Perform a learning step if the smart prediction is not satisfactory
-        if (!result.prediction.accepted) {
-            state = statebkp;
-            timeit(learn(state, conditions), result.timing.learning = )
-        }
-
-        result.timing.solve = toc(SOLVE_STEP);
-
-        return result;
+        return solve(state, nullptr, conditions, restrictions);
     }
 
     auto solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-        return {};
+        return solve(state, nullptr, conditions, restrictions);
     }
 
     //=================================================================================================================
@@ -127,26 +309,78 @@ struct SmartEquilibriumSolver::Impl
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        conditions.temperature(state.temperature());
+        conditions.pressure(state.pressure());
+        return solve(state, &sensitivity, conditions, restrictions);
     }
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        conditions.temperature(state.temperature());
+        conditions.pressure(state.pressure());
+        return solve(state, &sensitivity, conditions, restrictions);
     }
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        return solve(state, &sensitivity, conditions, restrictions);
     }
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        return solve(state, &sensitivity, conditions, restrictions);
+    }
+
+    /// Equilibrate a chemical state using a smart prediction if acceptable or else a full calculation that is then learned.
+    /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
+    /// @param[out] sensitivityout The sensitivity derivatives of the equilibrium state (if not null)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium
+    /// @param restrictions The reactivity restrictions on the amounts of selected species
+    auto solve(ChemicalState& state, EquilibriumSensitivity* sensitivityout, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
+    {
+        tic(SOLVE_STEP)
+
+        // Save a backup state in case the smart prediction fails.
+        const auto statebkp = state;
+
+        // Reset the result of the last smart equilibrium calculation
+        result = {};
+
+        // Advance the count of smart equilibrium calculations
+        clock += 1;
+
+        // The reactivity restrictions, which must equal those of the clusters used in the prediction, and the bounds they impose on the species amounts
+        detail::canonicalRestrictions(restrictions, currentrestrictions);
+        updateRestrictionBounds(state, restrictions);
+
+        // The key of the temperature-pressure grid cell within which the state temperature and pressure are located
+        const auto homekey = locate(state.temperature().val(), state.pressure().val());
+
+        // Perform a smart prediction of the chemical state
+        timeit( predict(state, sensitivityout, conditions, homekey), result.timing.prediction= )
+
+        // Perform a learning step if the smart prediction is not satisfactory
+        if (!result.prediction.accepted) {
+            state = statebkp;
+            timeit(learn(state, conditions, restrictions), result.timing.learning = )
+
+            // Output the sensitivity derivatives computed in the learning step
+            if(sensitivityout)
+                *sensitivityout = sensitivity;
+        }
+
+        // Split or merge the cell in which the prediction was attempted depending on its acceptance rate of predictions
+        if(options.adaptive_cells)
+            adaptCell(homekey);
+
+        result.database.num_records = grid.numrecords;
+        result.database.num_bytes = grid.numbytes;
+        result.database.num_evicted_records = grid.numevicted;
+        result.database.num_cells = grid.cells.size();
+
+        result.timing.solve = toc(SOLVE_STEP);
+
+        return result;
     }
 
     //=================================================================================================================
@@ -155,8 +389,45 @@ struct SmartEquilibriumSolver::Impl
     //
     //=================================================================================================================
 
+    /// Update the bounds of the species amounts imposed by given reactivity restrictions on a chemical state before its calculation.
+    /// These bounds depend on the initial species amounts of the state (as in EquilibriumSetup::assembleLowerBoundsVector and
+    /// EquilibriumSetup::assembleUpperBoundsVector), which are not among the variables *x* of the predictions, so predicted
+    /// states are checked against them separately.
+    auto updateRestrictionBounds(ChemicalState const& state, EquilibriumRestrictions const& restrictions) -> void
+    {
+        if(currentrestrictions.empty())
+            return;
+
+        const auto n0 = state.speciesAmounts();
+
+        nlower.setConstant(Nn, -inf);
+        nupper.setConstant(Nn, inf);
+
+        for(auto [i, val] : restrictions.speciesCannotDecreaseBelow()) nlower[i] = val;
+        for(auto i : restrictions.speciesCannotDecrease()) nlower[i] = n0[i].val(); // this comes after, in case a species cannot strictly decrease
+        for(auto [i, val] : restrictions.speciesCannotIncreaseAbove()) nupper[i] = val;
+        for(auto i : restrictions.speciesCannotIncrease()) nupper[i] = n0[i].val(); // this comes after, in case a species cannot strictly increase
+
+        nlower = nlower.max(options.learning.epsilon);
+        nupper = nupper.max(options.learning.epsilon);
+    }
+
+    /// Return true if predicted species amounts respect the bounds imposed by the reactivity restrictions of the current calculation.
+    /// Violations are tolerated as much as negative amounts are (see SmartEquilibriumOptions::reltol_negative_amounts).
+    auto respectRestrictionBounds(ArrayXrConstRef n, double nsum) const -> bool
+    {
+        const auto tolerance = -options.reltol_negative_amounts * nsum;
+        for(auto const& [kind, i, value] : currentrestrictions)
+        {
+            const double ni = n[i];
+            if(!(ni >= nlower[i] - tolerance && ni <= nupper[i] + tolerance)) // note NaN amounts do not respect the bounds
+                return false;
+        }
+        return true;
+    }
+
     /// Perform a learning operation in which a full chemical equilibrium calculation is performed.
-    auto learn(ChemicalState& state, EquilibriumConditions const& conditions) -> void
+    auto learn(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> void
     {
         //---------------------------------------------------------------------
         // GIBBS ENERGY MINIMIZATION CALCULATION DURING THE LEARNING PROCESS
@@ -164,7 +435,7 @@ struct SmartEquilibriumSolver::Impl
         tic(EQUILIBRIUM_STEP)
 
         // Perform a full chemical equilibrium solve with sensitivity derivatives calculation
-        result.learning.solve = solver.solve(state, sensitivity, conditions);
+        result.learning.solve = solver.solve(state, sensitivity, conditions, restrictions);
 
         result.timing.learning_solve = toc(EQUILIBRIUM_STEP);
 
@@ -178,38 +449,40 @@ struct SmartEquilibriumSolver::Impl
         //---------------------------------------------------------------------
         tic(STORAGE_STEP)
 
-        // Create an equilibrium predictor object with computed equilibrium state and its sensitivities
-        EquilibriumPredictor predictor(state, sensitivity);
-
-        // Round temperature and pressure according to their respective step lengths for discretization
-        const auto iT = detail::sround(state.temperature().val(), options.temperature_step);
-        const auto iP = detail::sround(state.pressure().val(), options.pressure_step);
-
-        // Get a mutable reference to an existing temperature-pressure cell or create a new one
-        auto& cell = grid.cells[{iT, iP}];
+        // Get a mutable reference to the temperature-pressure cell within which the state temperature/pressure are located (or create a new one)
+        auto& cell = grid.cells[locate(state.temperature().val(), state.pressure().val())];
 
         // Generate the hash number for indices of primary species in the state
         const auto iprimary = state.equilibrium().indicesPrimarySpecies();
         const auto label = hashVector(iprimary);
 
-        // Find the index of the cluster within the temperature-pressure grid cell that has the same primary species
-        auto icluster = indexfn(cell.clusters, RKT_LAMBDA(cluster, cluster.label == label));
+        // Find the index of the cluster within the temperature-pressure grid cell that has the same primary species and reactivity restrictions
+        auto icluster = indexfn(cell.clusters, RKT_LAMBDA(cluster, cluster.label == label && cluster.restrictions == currentrestrictions));
 
-        // If cluster is found, store the new record in it, otherwise, create a new cluster
-        if (icluster < cell.clusters.size())
-        {
-            auto& cluster = cell.clusters[icluster];
-            cluster.records.push_back({ state, conditions, sensitivity, predictor });
-            cluster.priority.extend();
-        }
-        else
+        // The input variables, initial component amounts, control variables and chemical properties at the new record
+        const auto w = state.equilibrium().w();
+        const auto c = state.equilibrium().c();
+        const auto p = state.equilibrium().p();
+        const auto q = state.equilibrium().q();
+        const auto n = state.speciesAmounts().cast<double>();
+        const VectorXd u = state.props();
+
+        const auto Nc = c.size();
+        const auto Nu = u.size();
+
+        // If no cluster is found, create a new one with the same primary species
+        if (icluster == cell.clusters.size())
         {
             // Create a new cluster within the current temperature-pressure grid cell
             Cluster cluster;
             cluster.iprimary = iprimary;
             cluster.label = label;
-            cluster.records.push_back({ state, conditions, sensitivity, predictor });
-            cluster.priority.extend();
+            cluster.restrictions = currentrestrictions;
+            cluster.equilibrium = std::make_shared<ChemicalState::Equilibrium const>(state.equilibrium());
+            cluster.nx = Nw + Nc;
+            cluster.ny = Nn + Np + Nq + Nu;
+            cluster.no = detail::numOptimaStateValues(state.equilibrium().optimaState());
+            cluster.singleprecision = options.single_precision_derivatives;
 
             // Append the new cluster and initialize its connectivity and priority
             cell.clusters.push_back(cluster);
@@ -217,86 +490,666 @@ struct SmartEquilibriumSolver::Impl
             cell.priority.extend();
         }
 
+        auto& cluster = cell.clusters[icluster];
+
+        // Store the reference values of x = (w, c) and y = (n, p, q, u) of the new record
+        detail::append(cluster.x0, w);
+        detail::append(cluster.x0, c);
+        detail::append(cluster.y0, n);
+        detail::append(cluster.y0, p);
+        detail::append(cluster.y0, q);
+        detail::append(cluster.y0, u);
+
+        // Store the chemical potentials of the primary species and their derivatives with respect to x (the last Nn chemical properties in u are the chemical potentials of the species)
+        for(auto ispecies : iprimary)
+        {
+            const auto irow = Nu - Nn + ispecies;
+            cluster.mu0.push_back(u[irow]);
+            cluster.dmudx0.push_back(sensitivity.dudw().row(irow).dot(w.matrix()) + sensitivity.dudc().row(irow).dot(c.matrix()));
+            detail::append(cluster.dmudx, sensitivity.dudw().row(irow));
+            detail::append(cluster.dmudx, sensitivity.dudc().row(irow));
+        }
+
+        // Store the derivatives dy/dx of the new record in column-major order
+        auto append_derivatives = [&](auto& dydx)
+        {
+            for(auto j = 0; j < Nw; ++j)
+            {
+                detail::append(dydx, sensitivity.dndw().col(j));
+                detail::append(dydx, sensitivity.dpdw().col(j));
+                detail::append(dydx, sensitivity.dqdw().col(j));
+                detail::append(dydx, sensitivity.dudw().col(j));
+            }
+            for(auto j = 0; j < Nc; ++j)
+            {
+                detail::append(dydx, sensitivity.dndc().col(j));
+                detail::append(dydx, sensitivity.dpdc().col(j));
+                detail::append(dydx, sensitivity.dqdc().col(j));
+                detail::append(dydx, sensitivity.dudc().col(j));
+            }
+        };
+
+        if(cluster.singleprecision)
+            append_derivatives(cluster.dydxf);
+        else append_derivatives(cluster.dydx);
+
+        // Store the values in the state of the optimization solver of the new record
+        detail::appendOptimaState(cluster.optima, state.equilibrium().optimaState());
+
+        cluster.lastused.push_back(clock);
+        cluster.numrecords += 1;
+        cluster.priority.extend();
+        insertTreePoint(cluster, cluster.numrecords - 1);
+
+        // Update the number of records and their estimated memory in the cell and in the grid
+        const auto bytes = detail::estimatedRecordBytes(cluster);
+        cell.numrecords += 1;
+        cell.numbytes += bytes;
+        grid.numrecords += 1;
+        grid.numbytes += bytes;
+
         result.timing.learning_storage = toc(STORAGE_STEP);
+
+        //---------------------------------------------------------------------
+        // EVICTION STEP DURING THE LEARNING PROCESS
+        //---------------------------------------------------------------------
+        tic(EVICTION_STEP)
+
+        // Evict records if the memory budget has been exceeded (except the one just stored)
+        evict(cell, icluster, cluster.numrecords - 1);
+
+        result.timing.learning_eviction = toc(EVICTION_STEP);
         
     }
 
-    /// Perform a prediction operation in which a chemical equilibrium state is predicted using a first-order Taylor approximation.
-    auto predict(ChemicalState& state, EquilibriumConditions const& conditions) -> void
+    /// Evict records from the grid if the memory budget in the options has been exceeded.
+    /// @param cell The cell in which a new record has just been stored
+    /// @param icluster The index of the cluster in which the new record has just been stored
+    /// @param irecord The index of the new record in its cluster (this record is never evicted)
+    auto evict(Cell& cell, Index icluster, Index irecord) -> void
     {
-        // Set the prediction status to false at the beginning
-        result.prediction.accepted = false;
+        // The amount to be freed once a limit is exceeded (a fraction of the limit is freed so that eviction happens in batches)
+        auto excess = [&](Index current, Index limit) -> Index
+        {
+            if(limit == 0 || current <= limit)
+                return 0;
+            const auto fraction = std::clamp(options.eviction_fraction, 0.0, 1.0);
+            const auto target = static_cast<Index>((1.0 - fraction) * limit);
+            return current - target;
+        };
 
-        // Skip prediction operation if no learning data exists yet
-        if(grid.cells.empty())
-            return;
+        // Respect first the limits of the cell in which the new record was stored
+        evictFromCell(cell, icluster, irecord,
+            excess(cell.numrecords, options.max_records_per_cell),
+            excess(cell.numbytes, options.max_bytes_per_cell));
+
+        // Respect next the global limits by evicting records from the largest cells first
+        while(true)
+        {
+            const auto numrecords = excess(grid.numrecords, options.max_records);
+            const auto numbytes = excess(grid.numbytes, options.max_bytes);
+
+            if(numrecords == 0 && numbytes == 0)
+                break;
+
+            Cell* largest = nullptr;
+            for(auto& [key, other] : grid.cells)
+                if(!largest || (numbytes ? other.numbytes > largest->numbytes : other.numrecords > largest->numrecords))
+                    largest = &other;
+
+            const auto evicted = (largest == &cell) ?
+                evictFromCell(cell, icluster, irecord, numrecords, numbytes) :
+                evictFromCell(*largest, largest->clusters.size(), 0, numrecords, numbytes);
+
+            if(evicted == 0)
+                break; // the only remaining record is the new one
+        }
+    }
+
+    /// Evict the least valuable records of a cell (according to the eviction policy) and return how many were evicted.
+    /// @param cell The cell from which records are evicted
+    /// @param icluster The index of the cluster with a record that must not be evicted (or number of clusters if none)
+    /// @param irecord The index of the record in cluster `icluster` that must not be evicted
+    /// @param numrecords The minimum number of records to be evicted
+    /// @param numbytes The minimum estimated memory to be freed (in bytes)
+    auto evictFromCell(Cell& cell, Index icluster, Index irecord, Index numrecords, Index numbytes) -> Index
+    {
+        if(numrecords == 0 && numbytes == 0)
+            return 0;
 
-        // Round temperature and pressure according to their respective step lengths for discretization
-        const auto iT = detail::sround(state.temperature().val(), options.temperature_step);
-        const auto iP = detail::sround(state.pressure().val(), options.pressure_step);
+        const auto lfu = options.eviction_policy == SmartEquilibriumEvictionPolicy::LeastFrequentlyUsed;
 
-        // Find an existing temperature-pressure grid cell within which the state temperature/pressure are located
-        auto it = grid.cells.find({iT, iP});
+        // The candidates for eviction (usage key, recency key, cluster index, record index)
+        Vec<std::tuple<Index, Index, Index, Index>> candidates;
+        candidates.reserve(cell.numrecords);
+
+        for(auto i = 0; i < cell.clusters.size(); ++i)
+        {
+            auto const& cluster = cell.clusters[i];
+            auto const& priorities = cluster.priority.priorities();
+            for(auto j = 0; j < cluster.numrecords; ++j)
+            {
+                if(i == icluster && j == irecord)
+                    continue;
+                const auto count = priorities[j];
+                const auto lastused = cluster.lastused[j];
+                candidates.emplace_back(lfu ? count : lastused, lfu ? lastused : count, i, j);
+            }
+        }
+
+        std::sort(candidates.begin(), candidates.end());
+
+        // Select the records to be evicted in each cluster
+        Vec<Vec<Index>> evicted(cell.clusters.size());
+        Index numevicted = 0;
+        Index bytesevicted = 0;
+        for(auto const& [key1, key2, i, j] : candidates)
+        {
+            if(numevicted >= numrecords && bytesevicted >= numbytes)
+                break;
+            evicted[i].push_back(j);
+            numevicted += 1;
+            bytesevicted += detail::estimatedRecordBytes(cell.clusters[i]);
+        }
+
+        // Remove the selected records from their clusters
+        for(auto i = 0; i < cell.clusters.size(); ++i)
+        {
+            if(evicted[i].empty())
+                continue;
+
+            auto& cluster = cell.clusters[i];
+
+            // Remove the records from the priority queue from last to first so that their indices remain valid
+            std::sort(evicted[i].rbegin(), evicted[i].rend());
+            for(auto j : evicted[i])
+                cluster.priority.remove(j);
+
+            // Compact the arrays of the cluster so that they contain only the remaining records
+            Vec<bool> keep(cluster.numrecords, true);
+            for(auto j : evicted[i])
+                keep[j] = false;
+
+            const Index np = cluster.iprimary.size();
+
+            detail::compact(cluster.x0, cluster.nx, keep);
+            detail::compact(cluster.y0, cluster.ny, keep);
+            detail::compact(cluster.mu0, np, keep);
+            detail::compact(cluster.dmudx, np * cluster.nx, keep);
+            detail::compact(cluster.dmudx0, np, keep);
+            detail::compact(cluster.dydx, cluster.singleprecision ? 0 : cluster.ny * cluster.nx, keep);
+            detail::compact(cluster.dydxf, cluster.singleprecision ? cluster.ny * cluster.nx : 0, keep);
+            detail::compact(cluster.optima, cluster.no, keep);
+            detail::compact(cluster.lastused, 1, keep);
+
+            cluster.numrecords -= evicted[i].size();
+
+            // Rebuild the k-d tree of the cluster with its remaining records
+            cluster.tree.clear();
+            for(auto k = 0; k < cluster.numrecords; ++k)
+                insertTreePoint(cluster, k);
+        }
+
+        cell.numrecords -= numevicted;
+        cell.numbytes -= bytesevicted;
+        grid.numrecords -= numevicted;
+        grid.numbytes -= bytesevicted;
+        grid.numevicted += numevicted;
+
+        result.learning.num_evicted_records += numevicted;
+
+        return numevicted;
+    }
+
+    /// Insert the input conditions and initial component amounts of a learned record in the k-d tree of its cluster.
+    auto insertTreePoint(Cluster& cluster, Index irecord) -> void
+    {
+        treepoint = ArrayXdConstMap(cluster.x0.data() + irecord * cluster.nx, cluster.nx);
+
+        // Initialize the k-d tree and its scaling factors using the first record in the cluster
+        if(cluster.tree.size() == 0)
+        {
+            cluster.tree = KdTree(treepoint.size());
+            cluster.treescaling = 1.0 / (treepoint.abs() + 1.0);
+        }
+
+        treekey = (treepoint * cluster.treescaling).matrix();
+        cluster.tree.insert(treekey);
+    }
+
+    /// Return the key of the temperature-pressure grid cell at a given refinement level within which a temperature and pressure are located.
+    auto cellKey(long level, double T, double P) const -> CellKey
+    {
+        const auto iT = static_cast<long>(std::floor(std::ldexp(T / options.temperature_step + 0.5, level)));
+        const auto iP = static_cast<long>(std::floor(std::ldexp(P / options.pressure_step + 0.5, level)));
+        return { level, iT, iP };
+    }
+
+    /// Return the key of the temperature-pressure grid cell within which a temperature and pressure are located.
+    /// If cells are adaptive, this is the cell at the coarsest refinement level that has not been split.
+    auto locate(double T, double P) const -> CellKey
+    {
+        if(!options.adaptive_cells)
+            return cellKey(0, T, P);
+
+        const auto lmin = -static_cast<long>(options.adaptive_max_coarsening);
+        const auto lmax = static_cast<long>(options.adaptive_max_refinement);
+
+        for(auto level = lmin; level < lmax; ++level)
+        {
+            const auto key = cellKey(level, T, P);
+            if(!grid.splits.count(key))
+                return key;
+        }
+
+        return cellKey(lmax, T, P);
+    }
+
+    /// Return the temperature and pressure of a learned record of a cluster.
+    auto recordTemperaturePressure(Cluster const& cluster, Index irecord) const -> Pair<double, double>
+    {
+        // The temperature and pressure are among the input variables *w* if known or else among the control variables *p* (where T comes before P)
+        const auto x0 = cluster.x0.data() + irecord * cluster.nx;
+        const auto p0 = cluster.y0.data() + irecord * cluster.ny + Nn;
+
+        const auto T = iTw < Nw ? x0[iTw] : p0[0];
+        const auto P = iPw < Nw ? x0[iPw] : iTw < Nw ? p0[0] : p0[1];
+
+        return { T, P };
+    }
+
+    /// Split or merge a temperature-pressure grid cell depending on the acceptance rate of the predictions attempted in it.
+    /// The rate is assessed once @ref SmartEquilibriumOptions::adaptive_min_predictions predictions have been attempted in the cell.
+    auto adaptCell(CellKey const& key) -> void
+    {
+        auto it = grid.cells.find(key);
 
-        // Skip prediction operation if no temperature-pressure grid cell with learning data exists yet
         if(it == grid.cells.end())
             return;
 
-        // Get a mutable reference to the found temperature-pressure cell
         auto& cell = it->second;
 
-        const auto wvals = conditions.inputValuesGetOrCompute(state);
-        const auto cvals = conditions.initialComponentAmountsGetOrCompute(state);
+        if(cell.numattempts < options.adaptive_min_predictions)
+            return;
+
+        const auto acceptance = static_cast<double>(cell.numaccepted) / cell.numattempts;
+
+        cell.numattempts = 0;
+        cell.numaccepted = 0;
+
+        const auto [level, iT, iP] = key;
+
+        const auto lmin = -static_cast<long>(options.adaptive_max_coarsening);
+        const auto lmax = static_cast<long>(options.adaptive_max_refinement);
+
+        if(acceptance < options.adaptive_split_acceptance && cell.numrecords >= options.adaptive_split_min_records && level < lmax)
+            splitCell(key);
+        else if(level > lmin && cell.numrecords < options.adaptive_merge_max_records)
+            mergeCells({ level - 1, static_cast<long>(std::floor(iT / 2.0)), static_cast<long>(std::floor(iP / 2.0)) });
+    }
 
-        const auto w = wvals.cast<double>();
-        const auto c = cvals.cast<double>();
+    /// Split a temperature-pressure grid cell into four cells at the next refinement level.
+    auto splitCell(CellKey const& key) -> void
+    {
+        Vec<Cell> cells;
+        cells.push_back(std::move(grid.cells.at(key)));
+        grid.cells.erase(key);
+        grid.splits.insert(key);
+        relocate(cells);
+    }
 
-        // Auxiliary vectors used in the lambda function below to avoid repeated memory allocation
-        VectorXd dw;
-        VectorXd dc;
+    /// Merge the four temperature-pressure grid cells resulting from the split of a given cell if they are sparse enough.
+    auto mergeCells(CellKey const& parentkey) -> void
+    {
+        const auto [level, iT, iP] = parentkey;
 
-        // The function that checks if a record in the grid pass the error test.
-        auto pass_error_test = [&](Record const& record) mutable -> bool
+        Vec<CellKey> keys;
+        Index numrecords = 0;
+
+        for(auto a : { 0L, 1L })
         {
-            // The primary species at the reference chemical state
-            auto const& iprimary0 = record.state.equilibrium().indicesPrimarySpecies();
+            for(auto b : { 0L, 1L })
+            {
+                const auto key = CellKey{ level + 1, 2*iT + a, 2*iP + b };
+
+                // Skip merging if any of the four cells has been split itself
+                if(grid.splits.count(key))
+                    return;
+
+                auto it = grid.cells.find(key);
+
+                if(it == grid.cells.end())
+                    continue;
+
+                keys.push_back(key);
+                numrecords += it->second.numrecords;
+            }
+        }
+
+        if(numrecords >= options.adaptive_merge_max_records)
+            return;
+
+        Vec<Cell> cells;
+        for(auto const& key : keys)
+        {
+            cells.push_back(std::move(grid.cells.at(key)));
+            grid.cells.erase(key);
+        }
+
+        grid.splits.erase(parentkey);
+        relocate(cells);
+    }
 
-            // The equilibrium predictor calculator at the reference state
-            auto const& predictor0 = record.predictor;
+    /// Move the learned records of the given cells (no longer in the grid) to the grid cells within which their temperatures and pressures are located.
+    /// The records keep their usage counts, and the usage counts of the clusters in the destination cells are recomputed from those of their records.
+    auto relocate(Vec<Cell>& cells) -> void
+    {
+        // The usage counts of the records in the destination clusters (a deque so that references remain valid while it grows)
+        Map<Cluster*, Deque<Index>> counts;
+
+        // The destination cells of the records
+        Set<Cell*> destinations;
 
-            const auto w0 = record.state.equilibrium().w();
-            const auto c0 = record.state.equilibrium().c();
+        for(auto& cell : cells)
+        {
+            for(auto& cluster : cell.clusters)
+            {
+                auto const& priorities = cluster.priority.priorities();
 
-            dw = w - w0;
-            dc = c - c0;
+                const Index np = cluster.iprimary.size();
+                const auto nx = cluster.nx;
+                const auto ny = cluster.ny;
+                const auto nd = ny * nx;
+
+                for(auto k = 0; k < cluster.numrecords; ++k)
+                {
+                    const auto [T, P] = recordTemperaturePressure(cluster, k);
+
+                    auto& destination = grid.cells[locate(T, P)];
+                    destinations.insert(&destination);
+
+                    // Find the cluster in the destination cell with the same primary species and reactivity restrictions or create a new one
+                    auto icluster = indexfn(destination.clusters, RKT_LAMBDA(other, other.label == cluster.label && other.restrictions == cluster.restrictions));
+
+                    if(icluster == destination.clusters.size())
+                    {
+                        Cluster other;
+                        other.iprimary = cluster.iprimary;
+                        other.label = cluster.label;
+                        other.restrictions = cluster.restrictions;
+                        other.equilibrium = cluster.equilibrium;
+                        other.nx = nx;
+                        other.ny = ny;
+                        other.no = cluster.no;
+                        other.singleprecision = cluster.singleprecision;
+
+                        destination.clusters.push_back(other);
+                        destination.connectivity.extend();
+                        destination.priority.extend();
+                    }
+
+                    auto& other = destination.clusters[icluster];
+
+                    auto& othercounts = counts[&other];
+                    if(othercounts.empty())
+                        othercounts.assign(other.priority.priorities().begin(), other.priority.priorities().end());
+
+                    auto copy = [&](auto& dst, auto const& src, Index stride)
+                    {
+                        dst.insert(dst.end(), src.begin() + k * stride, src.begin() + (k + 1) * stride);
+                    };
+
+                    copy(other.x0, cluster.x0, nx);
+                    copy(other.y0, cluster.y0, ny);
+                    copy(other.mu0, cluster.mu0, np);
+                    copy(other.dmudx, cluster.dmudx, np * nx);
+                    copy(other.dmudx0, cluster.dmudx0, np);
+                    copy(other.dydx, cluster.dydx, cluster.singleprecision ? 0 : nd);
+                    copy(other.dydxf, cluster.dydxf, cluster.singleprecision ? nd : 0);
+                    copy(other.optima, cluster.optima, cluster.no);
+                    copy(other.lastused, cluster.lastused, 1);
+
+                    other.numrecords += 1;
+                    othercounts.push_back(priorities[k]);
+                    insertTreePoint(other, other.numrecords - 1);
+
+                    destination.numrecords += 1;
+                    destination.numbytes += detail::estimatedRecordBytes(other);
+                }
+            }
+        }
 
-            using std::abs;
+        // Set the usage counts of the records in the destination clusters
+        for(auto& [cluster, priorities] : counts)
+            cluster->priority = PriorityQueue::withInitialPriorities(priorities);
 
-            for(auto ispecies : iprimary0)
+        // Set the usage counts of the clusters in the destination cells as the total usage counts of their records
+        for(auto cell : destinations)
+        {
+            Deque<Index> priorities;
+            for(auto const& cluster : cell->clusters)
             {
-                const auto mu0 = predictor0.speciesChemicalPotentialReference(ispecies);
-                const auto mu1 = predictor0.speciesChemicalPotentialPredicted(ispecies, dw, dc);
-                if(abs(mu1 - mu0) >= options.reltol * abs(mu0) + options.abstol || isnan(mu0) || isnan(mu1))
-                    return false;
+                auto const& recordpriorities = cluster.priority.priorities();
+                priorities.push_back(std::accumulate(recordpriorities.begin(), recordpriorities.end(), Index(0)));
             }
+            cell->priority = PriorityQueue::withInitialPriorities(priorities);
+        }
+    }
 
-            return true;
-        };
+    /// Perform a first-order Taylor prediction of the chemical state using a learned record of a cluster.
+    /// This method expects the auxiliary vector `x` to contain the current input variables and initial component amounts.
+    auto predictWithRecord(ChemicalState& state, Cluster const& cluster, Index irecord) -> void
+    {
+        const auto nx = cluster.nx;
+        const auto ny = cluster.ny;
+        const auto Nu = ny - Nn - Np - Nq;
+
+        dx = x - VectorXdConstMap(cluster.x0.data() + irecord * nx, nx);
+        y = VectorXdConstMap(cluster.y0.data() + irecord * ny, ny);
+
+        if(cluster.singleprecision)
+        {
+            dydx = Eigen::Map<Eigen::MatrixXf const>(cluster.dydxf.data() + irecord * ny * nx, ny, nx).cast<double>();
+            y.noalias() += dydx * dx;
+        }
+        else y.noalias() += MatrixXdConstMap(cluster.dydx.data() + irecord * ny * nx, ny, nx) * dx;
+
+        state.setSpeciesAmounts(y.head(Nn).array());
+        state.props().update(y.tail(Nu).array());
+        state.equilibrium() = *cluster.equilibrium;
+        detail::setOptimaState(state.equilibrium().optimaState(), cluster.optima.data() + irecord * cluster.no);
+        state.equilibrium().setControlVariablesP(y.segment(Nn, Np).array());
+        state.equilibrium().setControlVariablesQ(y.segment(Nn + Np, Nq).array());
+        state.equilibrium().setInputVariables(x.head(Nw).array());
+        state.equilibrium().setInitialComponentAmounts(x.tail(nx - Nw).array());
+
+        // Get temperature and pressure from the given input variables *w* if known or else from the predicted control variables *p* (where T comes before P)
+        auto const& p = state.equilibrium().p();
+        auto const& w = state.equilibrium().w();
+
+        const auto T = iTw < Nw ? w[iTw] : p[0];
+        const auto P = iPw < Nw ? w[iPw] : iTw < Nw ? p[0] : p[1];
+
+        state.setTemperature(T);
+        state.setPressure(P);
+    }
+
+    /// Evaluate the error test of all records of a cluster at once (storing the outcome of each record in `passed`).
+    /// The predicted changes in the chemical potentials of the primary species of every record *k*, given by
+    /// *dmu/dx[k]·(x - x0[k]) = dmu/dx[k]·x - dmu/dx[k]·x0[k]*, are computed with a single product of the packed
+    /// matrix `dmudx` of the cluster with the vector *x*. This method expects the auxiliary vector `x` to contain
+    /// the current input variables and initial component amounts.
+    auto passErrorTests(Cluster const& cluster) -> void
+    {
+        const Index np = cluster.iprimary.size();
+        const Index numrows = cluster.numrecords * np;
+
+        const auto dmudx = detail::RowMajorMatrixXdConstMap(cluster.dmudx.data(), numrows, cluster.nx);
+        const auto dmudx0 = VectorXdConstMap(cluster.dmudx0.data(), numrows);
+        const auto mu0 = ArrayXdConstMap(cluster.mu0.data(), numrows);
+
+        dmu.noalias() = dmudx * x;
+        dmu -= dmudx0;
+
+        // Note a comparison with NaN is false, so records with NaN chemical potentials or changes do not pass the test
+        const auto rowpassed = (dmu.array().abs() < options.reltol * mu0.abs() + options.abstol).eval();
+
+        passed = Eigen::Map<Eigen::Array<bool, -1, -1> const>(rowpassed.data(), np, cluster.numrecords).colwise().all();
+    }
+
+    /// Set the sensitivity derivatives of a chemical equilibrium state predicted with a learned record of a cluster.
+    /// The derivatives of the first-order Taylor prediction are constant and thus equal to those of the record.
+    auto predictSensitivityWithRecord(EquilibriumSensitivity& sensitivityout, Cluster const& cluster, Index irecord) -> void
+    {
+        const auto nx = cluster.nx;
+        const auto ny = cluster.ny;
+        const auto Nc = nx - Nw;
+        const auto Nu = ny - Nn - Np - Nq;
+
+        if(cluster.singleprecision)
+            dydx = Eigen::Map<Eigen::MatrixXf const>(cluster.dydxf.data() + irecord * ny * nx, ny, nx).cast<double>();
+        else dydx = MatrixXdConstMap(cluster.dydx.data() + irecord * ny * nx, ny, nx);
+
+        // Ensure the given sensitivity object has the dimensions of the chemical equilibrium problem (e.g. if default constructed)
+        if(sensitivityout.dndw().rows() != Nn || sensitivityout.dndw().cols() != Nw || sensitivityout.dndc().cols() != Nc)
+            sensitivityout = sensitivity;
+
+        sensitivityout.dndw(dydx.block(0, 0, Nn, Nw));
+        sensitivityout.dpdw(dydx.block(Nn, 0, Np, Nw));
+        sensitivityout.dqdw(dydx.block(Nn + Np, 0, Nq, Nw));
+        sensitivityout.dudw(dydx.block(Nn + Np + Nq, 0, Nu, Nw));
+        sensitivityout.dndc(dydx.block(0, Nw, Nn, Nc));
+        sensitivityout.dpdc(dydx.block(Nn, Nw, Np, Nc));
+        sensitivityout.dqdc(dydx.block(Nn + Np, Nw, Nq, Nc));
+        sensitivityout.dudc(dydx.block(Nn + Np + Nq, Nw, Nu, Nc));
+    }
+
+    /// Return true if a learned record of a cluster passes the error test for the current input conditions and initial component amounts in `x`.
+    auto passErrorTest(Cluster const& cluster, Index irecord) -> bool
+    {
+        const auto nx = cluster.nx;
+        const auto np = cluster.iprimary.size();
+
+        dx = x - VectorXdConstMap(cluster.x0.data() + irecord * nx, nx);
+
+        // The chemical potentials of the primary species at the record and their derivatives with respect to x
+        const auto mu0 = VectorXdConstMap(cluster.mu0.data() + irecord * np, np);
+        const auto dmudx = detail::RowMajorMatrixXdConstMap(cluster.dmudx.data() + irecord * np * nx, np, nx);
+
+        using std::abs;
+
+        for(auto i = 0; i < np; ++i)
+        {
+            const auto dmu = dmudx.row(i).dot(dx);
+            if(abs(dmu) >= options.reltol * abs(mu0[i]) + options.abstol || isnan(mu0[i]) || isnan(dmu))
+                return false;
+        }
+
+        return true;
+    }
+
+    /// Perform a prediction operation in which a chemical equilibrium state is predicted using a first-order Taylor approximation.
+    /// Only the clusters learned with the reactivity restrictions in `currentrestrictions` are used.
+    /// @param homekey The key of the temperature-pressure grid cell within which the state temperature and pressure are located
+    auto predict(ChemicalState& state, EquilibriumSensitivity* sensitivityout, EquilibriumConditions const& conditions, CellKey const& homekey) -> void
+    {
+        // Set the prediction status to false at the beginning
+        result.prediction.accepted = false;
+
+        // Skip prediction operation if no learning data exists yet
+        if(grid.cells.empty())
+            return;
+
+        const auto wvals = conditions.inputValuesGetOrCompute(state);
+        const auto cvals = conditions.initialComponentAmountsGetOrCompute(state);
+
+        // The current input variables and initial component amounts x = (w, c)
+        x.resize(wvals.size() + cvals.size());
+        x << wvals.cast<double>().matrix(), cvals.matrix();
+
+        // The input conditions and initial component amounts used to search for nearest records in the clusters
+        if(options.search_num_nearest > 0)
+            treepoint = x.array();
 
         // Generate the hash number for indices of primary species in the state
         const auto iprimary = state.equilibrium().indicesPrimarySpecies();
         const auto label = hashVector(iprimary);
 
+        // Search first the temperature-pressure grid cell within which the state temperature/pressure are located
+        auto it = grid.cells.find(homekey);
+
+        if(it != grid.cells.end())
+        {
+            auto& cell = it->second;
+
+            result.prediction.num_cells_visited += 1;
+            cell.numattempts += 1;
+
+            if(predictInCell(state, sensitivityout, cell, iprimary.size(), label))
+            {
+                cell.numaccepted += 1;
+                return;
+            }
+        }
+
+        // Search next the neighbouring cells (at the same refinement level), starting with those sharing an edge with the home cell
+        if(!options.search_neighbour_cells)
+            return;
+
+        const auto [level, iT, iP] = homekey;
+
+        const auto T = (iT + 0.5) * std::ldexp(options.temperature_step, -level) - 0.5 * options.temperature_step;
+        const auto P = (iP + 0.5) * std::ldexp(options.pressure_step, -level) - 0.5 * options.pressure_step;
+
+        const auto dT = std::ldexp(options.temperature_step, -level);
+        const auto dP = std::ldexp(options.pressure_step, -level);
+
+        const int offsets[8][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}, {-1, -1}, {-1, 1}, {1, -1}, {1, 1}};
+
+        Vec<CellKey> visited = { homekey };
+
+        for(auto const& [a, b] : offsets)
+        {
+            const auto neighbourkey = locate(T + a*dT, P + b*dP);
+
+            if(contains(visited, neighbourkey))
+                continue;
+
+            visited.push_back(neighbourkey);
+
+            auto jt = grid.cells.find(neighbourkey);
+
+            if(jt == grid.cells.end())
+                continue;
+
+            result.prediction.num_cells_visited += 1;
+
+            if(predictInCell(state, sensitivityout, jt->second, iprimary.size(), label))
+            {
+                result.prediction.accepted_neighbour = true;
+                return;
+            }
+        }
+    }
+
+    /// Search a temperature-pressure grid cell for a learned record that produces an acceptable predicted state.
+    /// @param numprimary The number of primary species in the state
+    /// Only the clusters learned with the reactivity restrictions in `currentrestrictions` are used.
+    /// @param numprimary The number of primary species in the state
+    /// @param label The label of the cluster with the same primary species as the state
+    /// @return True if an acceptable predicted state was found (and set in the given state)
+    auto predictInCell(ChemicalState& state, EquilibriumSensitivity* sensitivityout, Cell& cell, Index numprimary, Index label) -> bool
+    {
         // The function that identifies the starting cluster index
         auto index_starting_cluster = [&]() -> Index
         {
             // If no primary species, then return number of clusters to trigger use of total usage counts of clusters
-            if(iprimary.size() == 0)
+            if(numprimary == 0)
                 return cell.clusters.size();
 
-            // Find the index of the cluster with the same set of primary species (search those with highest count first)
+            // Find the index of the cluster with the same set of primary species and reactivity restrictions (search those with highest count first)
             for(auto icluster : cell.priority.order())
-                if(cell.clusters[icluster].label == label)
+                if(cell.clusters[icluster].label == label && cell.clusters[icluster].restrictions == currentrestrictions)
                     return icluster;
 
             // In no cluster with the same set of primary species if found, then return number of clusters
@@ -314,86 +1167,405 @@ struct SmartEquilibriumSolver::Impl
         //---------------------------------------------------------------------
         tic(SEARCH_STEP)
 
+        // The indication whether the error tests of all records in the current cluster have been evaluated at once
+        auto batched = false;
+
+        // The function that checks if a record in a cluster produces an acceptable predicted state (and accepts it if so)
+        auto accept_record = [&](Index jcluster, Index irecord) -> bool
+        {
+            result.prediction.num_records_tested += 1;
+
+            //---------------------------------------------------------------------
+            // ERROR CONTROL STEP DURING THE PREDICTION PROCESS
+            //---------------------------------------------------------------------
+            tic(ERROR_CONTROL_STEP)
+
+            // Check if the current record passes the error test (already evaluated if all records in the cluster were tested at once)
+            const auto success = batched ? passed[irecord] : passErrorTest(cell.clusters[jcluster], irecord);
+
+            result.timing.prediction_error_control += toc(ERROR_CONTROL_STEP);
+
+            if(!success)
+                return false;
+
+            //---------------------------------------------------------------------
+            // TAYLOR PREDICTION STEP DURING THE PREDICTION PROCESS
+            //---------------------------------------------------------------------
+            tic(TAYLOR_STEP)
+
+            predictWithRecord(state, cell.clusters[jcluster], irecord);
+
+            result.timing.prediction_taylor = toc(TAYLOR_STEP);
+
+            // Check if all projected species amounts are positive or at least very small negative values
+            auto const& n = state.speciesAmounts();
+
+            const double nmin = n.minCoeff();
+            const double nsum = n.sum();
+
+            if(nmin <= options.reltol_negative_amounts * nsum)
+                return false; // continue searching for a another record that produces positive amounts only or tolerable negative values
+
+            // Check if the predicted species amounts respect the bounds imposed by the reactivity restrictions (otherwise treat as a failed error test)
+            if(!respectRestrictionBounds(n, nsum))
+                return false;
+
+            result.timing.prediction_search = toc(SEARCH_STEP);
+
+            //---------------------------------------------------------------------
+            // After the search is finished successfully
+            //---------------------------------------------------------------------
+
+            // Assign small positive values to all negative amounts
+            for(auto i = 0; i < n.size(); ++i)
+                if(n[i] < 0.0)
+                    state.setSpeciesAmount(i, options.learning.epsilon);
+
+            // Assign the bounds imposed by the reactivity restrictions to the amounts that exceed them within the tolerance
+            for(auto const& [kind, i, value] : currentrestrictions)
+                state.setSpeciesAmount(i, std::clamp<double>(n[i].val(), nlower[i], nupper[i]));
+
+            // Output the sensitivity derivatives of the predicted state if requested
+            if(sensitivityout)
+                predictSensitivityWithRecord(*sensitivityout, cell.clusters[jcluster], irecord);
+
+            //---------------------------------------------------------------------
+            // DATABASE PRIORITY UPDATE STEP DURING THE PREDICTION PROCESS
+            //---------------------------------------------------------------------
+            tic(PRIORITY_UPDATE_STEP)
+
+            // Increment priority of the current record (irecord) in the current cluster (jcluster)
+            cell.clusters[jcluster].priority.increment(irecord);
+
+            // Register the current record as the most recently used one
+            cell.clusters[jcluster].lastused[irecord] = clock;
+
+            // Increment priority of the current cluster (jcluster) with respect to starting cluster (icluster)
+            cell.connectivity.increment(icluster, jcluster);
+
+            // Increment priority of the current cluster (jcluster)
+            cell.priority.increment(jcluster);
+
+            // Mark the predicted state as accepted
+            result.prediction.accepted = true;
+
+            result.timing.prediction_priority_update = toc(PRIORITY_UPDATE_STEP);
+
+            return true;
+        };
+
         // Iterate over all clusters (starting with icluster)
         for(auto jcluster : clusters_ordering)
         {
-            // Fetch records from the cluster and the order they have to be processed in
-            auto const& records = cell.clusters[jcluster].records;
-            auto const& records_ordering = cell.clusters[jcluster].priority.order();
+            auto const& cluster = cell.clusters[jcluster];
 
-            // Iterate over all records in current cluster (using the order based on the priorities)
-            for(auto irecord : records_ordering)
-            {
-                auto const& record = records[irecord];
+            // Skip the clusters learned with different reactivity restrictions
+            if(cluster.restrictions != currentrestrictions)
+                continue;
+
+            result.prediction.num_clusters_visited += 1;
 
-                //---------------------------------------------------------------------
-                // ERROR CONTROL STEP DURING THE PREDICTION PROCESS
-                //---------------------------------------------------------------------
-                tic(ERROR_CONTROL_STEP)
+            batched = false;
 
-                // Check if the current record passes the error test
-                const auto success = pass_error_test(record);
+            // Find the nearest records in the cluster, if the nearest-neighbour search is enabled and the cluster is large enough
+            inearest.clear();
+            if(options.search_num_nearest > 0 && cluster.numrecords >= options.search_min_records)
+            {
+                treekey = (treepoint * cluster.treescaling).matrix();
+                cluster.tree.nearest(treekey, options.search_num_nearest, inearest);
+            }
 
-                result.timing.prediction_error_control += toc(ERROR_CONTROL_STEP);
+            // Iterate over the nearest records in the cluster first (in increasing order of distance)
+            for(auto irecord : inearest)
+            {
+                result.prediction.num_nearest_records_tested += 1;
 
-                if(success)
+                if(accept_record(jcluster, irecord))
                 {
-                    //---------------------------------------------------------------------
-                    // TAYLOR PREDICTION STEP DURING THE PREDICTION PROCESS
-                    //---------------------------------------------------------------------
-                    tic(TAYLOR_STEP)
+                    result.prediction.accepted_nearest = true;
+                    return true;
+                }
+            }
 
-                    auto const& predictor0 = record.predictor;
+            // Skip the remaining records in the cluster if nearest records were tested and no fallback is allowed
+            if(inearest.size() && !options.search_fallback)
+                continue;
 
-                    predictor0.predict(state, conditions);
+            // Evaluate the error test of all records in the cluster at once before iterating over the remaining ones
+            tic(ERROR_CONTROL_STEP)
 
-                    result.timing.prediction_taylor = toc(TAYLOR_STEP);
+            passErrorTests(cluster);
+            batched = true;
 
-                    // Check if all projected species amounts are positive or at least very small negative values
-                    auto const& n = state.speciesAmounts();
+            result.timing.prediction_error_control += toc(ERROR_CONTROL_STEP);
 
-                    const double nmin = n.minCoeff();
-                    const double nsum = n.sum();
+            // Iterate over the remaining records in current cluster (using the order based on the priorities)
+            for(auto irecord : cluster.priority.order())
+            {
+                if(inearest.size() && contains(inearest, irecord))
+                    continue;
 
-                    if(nmin <= options.reltol_negative_amounts * nsum)
-                        continue; // continue searching for a another record that produces positive amounts only or tolerable negative values
+                if(accept_record(jcluster, irecord))
+                    return true;
+            }
+        }
 
-                    result.timing.prediction_search = toc(SEARCH_STEP);
+        return false;
+    }
 
-                    //---------------------------------------------------------------------
-                    // After the search is finished successfully
-                    //---------------------------------------------------------------------
+    //=================================================================================================================
+    //
+    // SAVE AND LOAD METHODS
+    //
+    //=================================================================================================================
 
-                    // Assign small positive values to all negative amounts
-                    for(auto i = 0; i < n.size(); ++i)
-                        if(n[i] < 0.0)
-                            state.setSpeciesAmount(i, options.learning.epsilon);
+    /// Write the data that identifies the chemical system and equilibrium specifications of the learned data.
+    auto writeHeader(BinaryWriter& writer) const -> void
+    {
+        writer.writeString(detail::smartEquilibriumFileMagic);
+        writer.writeValue(detail::smartEquilibriumFileVersion);
+        writer.writeValues(vectorize(specs.system().species(), RKT_LAMBDA(x, x.name())));
+        writer.writeValues(specs.namesInputs());
+        writer.writeValues(specs.namesControlVariablesP());
+        writer.writeValues(specs.namesControlVariablesQ());
+        writer.writeValue(options.temperature_step);
+        writer.writeValue(options.pressure_step);
+        writer.writeValue(options.adaptive_cells);
+        writer.writeValue(options.adaptive_max_coarsening);
+        writer.writeValue(options.adaptive_max_refinement);
+    }
 
-                    //---------------------------------------------------------------------
-                    // DATABASE PRIORITY UPDATE STEP DURING THE PREDICTION PROCESS
-                    //---------------------------------------------------------------------
-                    tic(PRIORITY_UPDATE_STEP)
+    /// Read and check the data that identifies the chemical system and equilibrium specifications of the learned data.
+    auto readHeader(BinaryReader& reader, String const& path) const -> void
+    {
+        errorif(reader.readString() != detail::smartEquilibriumFileMagic, "The file `", path, "` is not a file of learned data of SmartEquilibriumSolver.");
 
-                    // Increment priority of the current record (irecord) in the current cluster (jcluster)
-                    cell.clusters[jcluster].priority.increment(irecord);
+        const auto version = reader.readValue<Index>();
+        errorif(version != detail::smartEquilibriumFileVersion, "The file `", path, "` has version ", version, " of the format of learned data of SmartEquilibriumSolver, but only version ", detail::smartEquilibriumFileVersion, " is supported.");
 
-                    // Increment priority of the current cluster (jcluster) with respect to starting cluster (icluster)
-                    cell.connectivity.increment(icluster, jcluster);
+        const auto species = reader.readValues<Strings>();
+        const auto wnames = reader.readValues<Strings>();
+        const auto pnames = reader.readValues<Strings>();
+        const auto qnames = reader.readValues<Strings>();
 
-                    // Increment priority of the current cluster (jcluster)
-                    cell.priority.increment(jcluster);
+        errorif(species != vectorize(specs.system().species(), RKT_LAMBDA(x, x.name())), "The learned data in file `", path, "` was produced for a chemical system with different species.");
+        errorif(wnames != specs.namesInputs() || pnames != specs.namesControlVariablesP() || qnames != specs.namesControlVariablesQ(), "The learned data in file `", path, "` was produced with different chemical equilibrium specifications.");
 
-                    // Mark the predicted state as accepted
-                    result.prediction.accepted = true;
+        const auto temperature_step = reader.readValue<double>();
+        const auto pressure_step = reader.readValue<double>();
 
-                    result.timing.prediction_priority_update = toc(PRIORITY_UPDATE_STEP);
+        errorif(temperature_step != options.temperature_step || pressure_step != options.pressure_step, "The learned data in file `", path, "` was produced with temperature and pressure steps (", temperature_step, " K, ", pressure_step, " Pa) that differ from those in the current options (", options.temperature_step, " K, ", options.pressure_step, " Pa).");
 
-                    return;
-                }
+        const auto adaptive_cells = reader.readValue<bool>();
+        const auto adaptive_max_coarsening = reader.readValue<Index>();
+        const auto adaptive_max_refinement = reader.readValue<Index>();
+
+        errorif(adaptive_cells != options.adaptive_cells, "The learned data in file `", path, "` was produced with adaptive temperature-pressure cells ", adaptive_cells ? "enabled" : "disabled", ", which differs from the current options.");
+        errorif(adaptive_cells && (adaptive_max_coarsening != options.adaptive_max_coarsening || adaptive_max_refinement != options.adaptive_max_refinement), "The learned data in file `", path, "` was produced with adaptive temperature-pressure cells with coarsening and refinement limits (", adaptive_max_coarsening, ", ", adaptive_max_refinement, ") that differ from those in the current options (", options.adaptive_max_coarsening, ", ", options.adaptive_max_refinement, ").");
+    }
+
+    /// Write a cluster and its learned records.
+    auto writeCluster(BinaryWriter& writer, Cluster const& cluster) const -> void
+    {
+        auto const& optstate = cluster.equilibrium->optimaState();
+
+        writer.writeMatrix(cluster.iprimary);
+        detail::writeRestrictions(writer, cluster.restrictions);
+        detail::writePriorityQueue(writer, cluster.priority);
+
+        writer.writeValue(optstate.dims.x);
+        writer.writeValue(optstate.dims.p);
+        writer.writeValue(optstate.dims.be);
+        writer.writeValue(optstate.dims.c);
+        writer.writeMatrix(optstate.x);
+        writer.writeMatrix(optstate.p);
+        writer.writeMatrix(optstate.ye);
+        writer.writeMatrix(optstate.s);
+        writer.writeMatrix(optstate.jb);
+        writer.writeMatrix(optstate.jn);
+
+        writer.writeValue(cluster.numrecords);
+        writer.writeValue(cluster.nx);
+        writer.writeValue(cluster.ny);
+        writer.writeValue(cluster.no);
+        writer.writeValue(cluster.singleprecision);
+        writer.writeValues(cluster.x0);
+        writer.writeValues(cluster.y0);
+        writer.writeValues(cluster.mu0);
+        writer.writeValues(cluster.dmudx);
+        writer.writeValues(cluster.dydx);
+        writer.writeValues(cluster.dydxf);
+        writer.writeValues(cluster.optima);
+        writer.writeValues(cluster.lastused);
+    }
+
+    /// Read a cluster and its learned records.
+    auto readCluster(BinaryReader& reader, String const& path) const -> Cluster
+    {
+        Cluster cluster;
+
+        cluster.iprimary = reader.readMatrix<ArrayXl>();
+        cluster.label = hashVector(cluster.iprimary); // not stored, since the hash is implementation-defined
+        cluster.restrictions = detail::readRestrictions(reader);
+        cluster.priority = detail::readPriorityQueue(reader);
+
+        Optima::Dims optdims;
+        optdims.x  = reader.readValue<Index>();
+        optdims.p  = reader.readValue<Index>();
+        optdims.be = reader.readValue<Index>();
+        optdims.c  = reader.readValue<Index>();
+
+        Optima::State optstate(optdims);
+        optstate.x  = reader.readMatrix<VectorXd>();
+        optstate.p  = reader.readMatrix<VectorXd>();
+        optstate.ye = reader.readMatrix<VectorXd>();
+        optstate.s  = reader.readMatrix<VectorXd>();
+        optstate.jb = reader.readMatrix<ArrayXl>();
+        optstate.jn = reader.readMatrix<ArrayXl>();
+
+        ChemicalState::Equilibrium equilibrium(specs.system());
+        equilibrium.setNamesInputVariables(specs.namesInputs());
+        equilibrium.setNamesControlVariablesP(specs.namesControlVariablesP());
+        equilibrium.setNamesControlVariablesQ(specs.namesControlVariablesQ());
+        equilibrium.setOptimaState(optstate);
+
+        cluster.equilibrium = std::make_shared<ChemicalState::Equilibrium const>(equilibrium);
+
+        cluster.numrecords = reader.readValue<Index>();
+        cluster.nx = reader.readValue<Index>();
+        cluster.ny = reader.readValue<Index>();
+        cluster.no = reader.readValue<Index>();
+        cluster.singleprecision = reader.readValue<bool>();
+        cluster.x0 = reader.readValues<Vec<double>>();
+        cluster.y0 = reader.readValues<Vec<double>>();
+        cluster.mu0 = reader.readValues<Vec<double>>();
+        cluster.dmudx = reader.readValues<Vec<double>>();
+        cluster.dydx = reader.readValues<Vec<double>>();
+        cluster.dydxf = reader.readValues<Vec<float>>();
+        cluster.optima = reader.readValues<Vec<double>>();
+        cluster.lastused = reader.readValues<Vec<Index>>();
+
+        const Index numrecords = cluster.numrecords;
+        const Index np = cluster.iprimary.size();
+        const Index nxy = cluster.nx * cluster.ny;
+
+        errorif(numrecords != cluster.priority.size() || numrecords != cluster.lastused.size(), "Inconsistent record data in file `", path, "`.");
+        errorif(cluster.x0.size() != numrecords * cluster.nx || cluster.y0.size() != numrecords * cluster.ny, "Inconsistent record data in file `", path, "`.");
+        errorif(cluster.mu0.size() != numrecords * np || cluster.dmudx.size() != numrecords * np * cluster.nx, "Inconsistent record data in file `", path, "`.");
+        errorif(cluster.dydx.size() + cluster.dydxf.size() != numrecords * nxy, "Inconsistent record data in file `", path, "`.");
+        errorif(cluster.no != detail::numOptimaStateValues(optstate) || cluster.optima.size() != numrecords * cluster.no, "Inconsistent record data in file `", path, "`.");
+
+        // Compute the products of the derivatives of the chemical potentials of the primary species with the x0 of their records
+        for(auto k = 0; k < cluster.numrecords; ++k)
+        {
+            const auto x0 = VectorXdConstMap(cluster.x0.data() + k * cluster.nx, cluster.nx);
+            const auto dmudx = detail::RowMajorMatrixXdConstMap(cluster.dmudx.data() + k * np * cluster.nx, np, cluster.nx);
+            detail::append(cluster.dmudx0, VectorXd(dmudx * x0));
+        }
+
+        return cluster;
+    }
+
+    /// Save the learned data to a binary file.
+    auto save(String const& path) const -> void
+    {
+        BinaryWriter writer(path);
+
+        writeHeader(writer);
+
+        writer.writeValue(clock);
+
+        writer.writeValue(grid.cells.size());
+
+        for(auto const& [key, cell] : grid.cells)
+        {
+            writer.writeValue(std::get<0>(key));
+            writer.writeValue(std::get<1>(key));
+            writer.writeValue(std::get<2>(key));
+
+            detail::writePriorityQueue(writer, cell.priority);
+            detail::writePriorityQueue(writer, cell.connectivity.usageQueue());
+            for(auto const& queue : cell.connectivity.matrixQueues())
+                detail::writePriorityQueue(writer, queue);
+
+            writer.writeValue(cell.clusters.size());
+
+            for(auto const& cluster : cell.clusters)
+                writeCluster(writer, cluster);
+        }
+
+        writer.writeValue(grid.splits.size());
+
+        for(auto const& [level, iT, iP] : grid.splits)
+        {
+            writer.writeValue(level);
+            writer.writeValue(iT);
+            writer.writeValue(iP);
+        }
+    }
+
+    /// Load the learned data from a binary file (replacing the current learned data).
+    auto load(String const& path) -> void
+    {
+        BinaryReader reader(path);
+
+        readHeader(reader, path);
+
+        const auto newclock = reader.readValue<Index>();
+
+        Grid newgrid;
+
+        const auto numcells = reader.readValue<Index>();
+
+        for(auto i = 0; i < numcells; ++i)
+        {
+            const auto level = reader.readValue<long>();
+            const auto iT = reader.readValue<long>();
+            const auto iP = reader.readValue<long>();
+
+            auto& cell = newgrid.cells[{ level, iT, iP }];
+
+            cell.priority = detail::readPriorityQueue(reader);
+
+            const auto usage = detail::readPriorityQueue(reader);
+            Deque<PriorityQueue> matrix(usage.size());
+            for(auto& queue : matrix)
+                queue = detail::readPriorityQueue(reader);
+            cell.connectivity = ClusterConnectivity::withInitialQueues(matrix, usage);
+
+            const auto numclusters = reader.readValue<Index>();
+
+            errorif(numclusters != cell.priority.size() || numclusters != usage.size(), "Inconsistent cluster data in file `", path, "`.");
+
+            for(auto j = 0; j < numclusters; ++j)
+            {
+                auto& cluster = cell.clusters.emplace_back(readCluster(reader, path));
+
+                for(auto k = 0; k < cluster.numrecords; ++k)
+                    insertTreePoint(cluster, k);
+
+                const auto bytes = cluster.numrecords * detail::estimatedRecordBytes(cluster);
+                cell.numrecords += cluster.numrecords;
+                cell.numbytes += bytes;
+                newgrid.numrecords += cluster.numrecords;
+                newgrid.numbytes += bytes;
             }
         }
 
-        result.prediction.accepted = false;
+        const auto numsplits = reader.readValue<Index>();
+
+        for(auto i = 0; i < numsplits; ++i)
+        {
+            const auto level = reader.readValue<long>();
+            const auto iT = reader.readValue<long>();
+            const auto iP = reader.readValue<long>();
+            newgrid.splits.insert({ level, iT, iP });
+        }
+
+        newgrid.numevicted = grid.numevicted;
+
+        grid = std::move(newgrid);
+        clock = newclock;
     }
 
     //=================================================================================================================
@@ -438,8 +1610,7 @@ auto SmartEquilibriumSolver::solve(ChemicalState& state) -> SmartEquilibriumResu
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-    return {};
+    return pimpl->solve(state, restrictions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
@@ -449,32 +1620,27 @@ auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumConditions c
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-    return {};
+    return pimpl->solve(state, conditions, restrictions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity, restrictions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity, conditions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity, conditions, restrictions);
 }
 
 auto SmartEquilibriumSolver::setOptions(SmartEquilibriumOptions const& options) -> void
@@ -482,4 +1648,14 @@ auto SmartEquilibriumSolver::setOptions(SmartEquilibriumOptions const& options)
     pimpl->setOptions(options);
 }
 
+auto SmartEquilibriumSolver::save(String const& path) const -> void
+{
+    pimpl->save(path);
+}
+
+auto SmartEquilibriumSolver::load(String const& path) -> void
+{
+    pimpl->load(path);
+}
+
 } // namespace Reaktoro
@@ -23,9 +23,9 @@
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
-#include <Reaktoro/Equilibrium/EquilibriumPredictor.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/ODML/ClusterConnectivity.hpp>
+#include <Reaktoro/ODML/KdTree.hpp>
 #include <Reaktoro/ODML/PriorityQueue.hpp>
 
 namespace Reaktoro {
@@ -69,6 +69,8 @@ public:
     auto solve(ChemicalState& state) -> SmartEquilibriumResult;
 
     /// Equilibrate a chemical state respecting given reactivity restrictions.
+    /// Only the records learned under the same reactivity restrictions are used in smart predictions, and
+    /// predicted species amounts that violate the bounds imposed by these restrictions on the given state are not accepted.
     /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult;
@@ -90,6 +92,10 @@ public:
     //
     //=================================================================================================================
 
+    // When a smart prediction is accepted, the sensitivity derivatives are those of the learned record used in the
+    // first-order Taylor prediction (which are constant in this approximation). When a learning operation is needed,
+    // they are those computed in the full chemical equilibrium calculation.
+
     /// Equilibrate a chemical state and compute sensitivity derivatives.
     /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
     /// @param[out] sensitivity The sensitivity derivatives of the equilibrium state with respect to given input conditions
@@ -123,23 +129,41 @@ public:
     /// Set the options of the equilibrium solver.
     auto setOptions(SmartEquilibriumOptions const& options) -> void;
 
-    /// The record of the knowledge database containing input, output, and derivatives data.
-    struct Record
-    {
-        /// The fully calculated chemical equilibrium state.
-        ChemicalState state;
-
-        /// The conditions at which the chemical equilibrium state was calculated.
-        EquilibriumConditions conditions;
-
-        /// The sensitivity derivatives at the calculated chemical equilibrium state.
-        EquilibriumSensitivity sensitivity;
-
-        /// The predictor of chemical equilibrium states at given new conditions.
-        EquilibriumPredictor predictor;
-    };
+    /// Save the learned data of the smart equilibrium solver to a binary file.
+    /// The file contains the learned records of every temperature-pressure grid cell
+    /// (reference values, sensitivity derivatives, and the data shared by the records
+    /// of each cluster) as well as the usage counts of records and clusters and the
+    /// times the records were last used, so that eviction continues in the same order
+    /// after loading. Its format is versioned and all its entries are stored at 8-byte
+    /// aligned offsets, with derivatives in single precision stored as 4-byte floats.
+    /// The file can only be loaded by a solver with the same chemical system,
+    /// equilibrium specifications, temperature and pressure step lengths, and adaptive cell settings.
+    /// @param path The path of the file (overwritten if it exists)
+    auto save(String const& path) const -> void;
+
+    /// Load learned data from a binary file produced by @ref save (replacing the current learned data).
+    /// The learned data is copied from the file into this solver, which owns it afterwards.
+    /// @param path The path of the file
+    auto load(String const& path) -> void;
+
+    /// The reactivity restrictions of a chemical equilibrium calculation in canonical form.
+    /// Each entry contains the kind of restriction (0: cannot increase, 1: cannot decrease, 2: cannot
+    /// increase above a value, 3: cannot decrease below a value), the index of the restricted species
+    /// and the value of its bound (in mol, zero for kinds 0 and 1). The entries are sorted, so that
+    /// equal reactivity restrictions have equal canonical forms.
+    using Restrictions = Vec<Tuple<Index, Index, double>>;
 
     /// The cluster storing learned input-output data with same classification.
+    /// The learned records of a cluster are stored contiguously in structure-of-arrays layout and
+    /// contain only the data needed for the acceptance test and the first-order Taylor prediction.
+    /// Let *x = (w, c)* denote the input variables and initial component amounts of a record and
+    /// *y = (n, p, q, u)* its species amounts, control variables and serialized chemical properties.
+    /// The `k`-th record of the cluster then has its reference values of *x* in `x0[k*nx:(k+1)*nx]`,
+    /// its reference values of *y* in `y0[k*ny:(k+1)*ny]`, and its derivatives *dy/dx* (in
+    /// column-major order) in `dydx[k*ny*nx:(k+1)*ny*nx]`. The values in the state of the optimization
+    /// solver of the `k`-th record are stored in `optima[k*no:(k+1)*no]`, while the remaining data
+    /// in this state, common to all records in the cluster (e.g. its dimensions and the partition of
+    /// the variables into basic and non-basic), is shared.
     struct Cluster
     {
         /// The indices of the primary species for this cluster.
@@ -148,11 +172,65 @@ public:
         /// The hash of the indices of the primary species for this cluster.
         Index label = 0;
 
-        /// The records stored in this cluster with learning data.
-        Deque<Record> records;
+        /// The reactivity restrictions under which the records of this cluster were learned (empty if none).
+        Restrictions restrictions;
+
+        /// The chemical equilibrium data of the first learned record shared by all records in this cluster.
+        /// The values in its state of the optimization solver are replaced by those of the record used in a prediction.
+        SharedPtr<ChemicalState::Equilibrium const> equilibrium;
+
+        /// The number of records stored in this cluster.
+        Index numrecords = 0;
+
+        /// The number of input variables and initial component amounts in each record.
+        Index nx = 0;
+
+        /// The number of species amounts, control variables and chemical properties in each record.
+        Index ny = 0;
+
+        /// The number of values in the state of the optimization solver of each record.
+        Index no = 0;
+
+        /// The indication whether the derivatives *dy/dx* of the records are stored in single precision.
+        bool singleprecision = false;
+
+        /// The input variables and initial component amounts *x0* of the records.
+        Vec<double> x0;
+
+        /// The species amounts, control variables and chemical properties *y0* of the records.
+        Vec<double> y0;
+
+        /// The chemical potentials of the primary species of the records.
+        Vec<double> mu0;
+
+        /// The derivatives of the chemical potentials of the primary species with respect to *x* (row-major, one row per primary species).
+        /// The rows of all records form a packed row-major matrix with `numrecords * iprimary.size()` rows and `nx` columns.
+        Vec<double> dmudx;
+
+        /// The products of the rows of `dmudx` with the *x0* of their records (used to evaluate the error test of all records at once).
+        Vec<double> dmudx0;
+
+        /// The derivatives *dy/dx* of the records (if stored in double precision).
+        Vec<double> dydx;
+
+        /// The derivatives *dy/dx* of the records (if stored in single precision).
+        Vec<float> dydxf;
+
+        /// The variables *x*, *p*, the Lagrange multipliers *ye* and the stabilities *s* in the states of the optimization solver of the records.
+        /// These are set in a predicted chemical equilibrium state so that a subsequent full calculation starting from it is warm started with the data of the record used.
+        Vec<double> optima;
+
+        /// The number of the last smart equilibrium calculation in which each record was learned or used.
+        Vec<Index> lastused;
 
         /// The priority queue for the records based on their usage count.
         PriorityQueue priority;
+
+        /// The k-d tree of the scaled input conditions and initial component amounts of the records used for nearest-neighbour search.
+        KdTree tree;
+
+        /// The scaling factors of the input conditions and initial component amounts in the k-d tree.
+        ArrayXd treescaling;
     };
 
     /// The collection of clusters containing learned input-output data associated to a temperature-pressure grid cell.
@@ -166,16 +244,45 @@ public:
 
         /// The priority queue for the clusters based on their usage counts.
         PriorityQueue priority;
+
+        /// The number of learned records in this cell.
+        Index numrecords = 0;
+
+        /// The estimated memory used by the learned records in this cell (in bytes).
+        Index numbytes = 0;
+
+        /// The number of predictions attempted in this cell since its acceptance rate was last assessed.
+        Index numattempts = 0;
+
+        /// The number of predictions accepted in this cell since its acceptance rate was last assessed.
+        Index numaccepted = 0;
     };
 
+    /// The key of a temperature-pressure grid cell (its refinement level followed by the indices of its temperature and pressure intervals).
+    /// At refinement level `l`, the temperature and pressure intervals have lengths equal to the temperature and
+    /// pressure steps divided by `2^l`. The intervals at level zero are centered at multiples of these steps,
+    /// and each interval at level `l` is split into the intervals of indices `2i` and `2i + 1` at level `l + 1`.
+    using CellKey = Tuple<long, long, long>;
+
     /// The temperature-pressure grid cells containing learned input-output data.
     struct Grid
     {
         /// The hash table used to access a temperature-pressure grid cell containing learned computations.
-        /// Note the use of `long` as number type for a temperature-pressure pairs. Temperatures and
-        /// pressures are rounded to nearest checkpoints based on provided temperature/pressure step
-        /// lengths for discretization.
-        Map<Pair<long, long>, Cell> cells;
+        /// Temperatures and pressures are rounded to the nearest checkpoints based on the
+        /// temperature/pressure step lengths for discretization (at the refinement level of the cell).
+        Map<CellKey, Cell> cells;
+
+        /// The keys of the cells that have been split into four cells at the next refinement level (if cells are adaptive).
+        Set<CellKey> splits;
+
+        /// The number of learned records in all cells.
+        Index numrecords = 0;
+
+        /// The estimated memory used by the learned records in all cells (in bytes).
+        Index numbytes = 0;
+
+        /// The number of learned records evicted from the cells so far.
+        Index numevicted = 0;
     };
 
 private:
@@ -48,5 +48,7 @@ void exportSmartEquilibriumSolver(py::module& m)
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&SmartEquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"), py::arg("restrictions"))
 
         .def("setOptions", &SmartEquilibriumSolver::setOptions)
+        .def("save", &SmartEquilibriumSolver::save, "Save the learned data of the smart equilibrium solver to a binary file.", py::arg("path"))
+        .def("load", &SmartEquilibriumSolver::load, "Load learned data from a binary file produced by method save (replacing the current learned data).", py::arg("path"))
         ;
 }
@@ -16,7 +16,10 @@
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
 // C++ includes
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 
 // Catch includes
 #include <catch2/catch.hpp>
@@ -115,4 +118,523 @@ TEST_CASE("Testing SmartEquilibriumSolver", "[SmartEquilibriumSolver]")
         CHECK( result.learned() );
         CHECK( result.iterations() == 17 );
     }
+
+    WHEN("the nearest-neighbour search of learned records is enabled")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumOptions options;
+        options.search_num_nearest = 2;
+        options.search_min_records = 1;
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        SmartEquilibriumResult result;
+
+        ChemicalState state(system);
+
+        // Learn a few chemical states with increasing amounts of water and calcite
+        for(auto i = 0; i < 4; ++i)
+        {
+            state = ChemicalState(system);
+            state.temperature(25.0, "celsius");
+            state.pressure(1.0, "bar");
+            state.set("H2O(aq)", 1.0 + i, "kg");
+            state.set("Calcite", 1.0 + i, "mol");
+
+            result = solver.solve(state);
+
+            CHECK( result.succeeded() );
+        }
+
+        // Check the prediction of a state near the last learned one is found among the nearest records
+        state = ChemicalState(system);
+        state.temperature(26.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 4.1, "kg");
+        state.set("Calcite", 4.1, "mol");
+
+        result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+        CHECK( result.prediction.accepted_nearest );
+        CHECK( result.prediction.num_clusters_visited >= 1 );
+        CHECK( result.prediction.num_nearest_records_tested >= 1 );
+        CHECK( result.prediction.num_nearest_records_tested <= 2 );
+        CHECK( result.prediction.num_records_tested == result.prediction.num_nearest_records_tested );
+    }
+
+    WHEN("the state of the optimization solver in a predicted state comes from the record used in the prediction")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumOptions options;
+        options.reltol = 0.0; // force a learning operation in every calculation
+        options.abstol = 0.0;
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        ChemicalState state(system);
+
+        auto solve = [&](double nCO2)
+        {
+            state = ChemicalState(system);
+            state.temperature(25.0, "celsius");
+            state.pressure(1.0, "bar");
+            state.set("H2O(aq)", 1.0, "kg");
+            state.set("Calcite", 1.0, "mol");
+            state.set("CO2(aq)", nCO2, "mol");
+            return solver.solve(state);
+        };
+
+        // Learn two chemical states with very different amounts of CO2 and keep the element chemical potentials computed by the optimization solver
+        CHECK( solve(1e-6).learned() );
+        const ArrayXd yeA = state.equilibrium().elementChemicalPotentials();
+
+        CHECK( solve(0.5).learned() );
+        const ArrayXd yeB = state.equilibrium().elementChemicalPotentials();
+
+        REQUIRE( !(yeA == yeB).all() );
+
+        // Predict a chemical state near the last learned one using only its nearest record
+        SmartEquilibriumOptions defaultoptions;
+        defaultoptions.search_num_nearest = 1;
+        defaultoptions.search_min_records = 1;
+        solver.setOptions(defaultoptions);
+
+        CHECK( solve(0.51).predicted() );
+        CHECK( (state.equilibrium().elementChemicalPotentials() == yeB).all() );
+    }
+
+    WHEN("the learned data is saved to a file and loaded by another solver")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumSolver solver(system);
+
+        SmartEquilibriumResult result;
+
+        ChemicalState state(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        result = solver.solve(state);
+
+        CHECK( result.learned() );
+
+        const auto path = (std::filesystem::temp_directory_path() / "reaktoro-smart-equilibrium-test.bin").string();
+        const auto pathcopy = (std::filesystem::temp_directory_path() / "reaktoro-smart-equilibrium-test-copy.bin").string();
+
+        solver.save(path);
+
+        // The chemical state to be predicted by both the original solver and the one with loaded learned data
+        ChemicalState state0(system);
+        state0.temperature(30.0, "celsius");
+        state0.pressure(2.0, "bar");
+        state0.set("H2O(aq)", 1.1, "kg");
+        state0.set("Calcite", 1.1, "mol");
+
+        SmartEquilibriumSolver loaded(system);
+        loaded.load(path);
+
+        // Saving the loaded learned data must reproduce the original file (including the times the records were last used)
+        loaded.save(pathcopy);
+
+        auto contents = [](String const& filepath) { std::ifstream file(filepath, std::ios::binary); return String(std::istreambuf_iterator<char>(file), {}); };
+
+        CHECK( contents(pathcopy) == contents(path) );
+
+        ChemicalState state1 = state0;
+        ChemicalState state2 = state0;
+
+        result = solver.solve(state1);
+
+        CHECK( result.predicted() );
+
+        result = loaded.solve(state2);
+
+        CHECK( result.predicted() );
+
+        CHECK( largestRelativeDifference(state1.speciesAmounts(), state2.speciesAmounts()) == Approx(0.0).margin(1e-14) );
+
+        // Check loading fails if the temperature and pressure steps are different
+        SmartEquilibriumOptions options;
+        options.temperature_step = 5.0;
+
+        SmartEquilibriumSolver other(system);
+        other.setOptions(options);
+
+        CHECK_THROWS( other.load(path) );
+
+        std::filesystem::remove(path);
+        std::filesystem::remove(pathcopy);
+    }
+
+    WHEN("the sensitivity derivatives of the learned records are stored in single precision")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumOptions options;
+        options.single_precision_derivatives = true;
+
+        SmartEquilibriumSolver solver(system);
+        SmartEquilibriumSolver solverf(system);
+        solverf.setOptions(options);
+
+        ChemicalState state(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        ChemicalState statef = state;
+
+        auto result = solver.solve(state);
+        auto resultf = solverf.solve(statef);
+
+        CHECK( result.learned() );
+        CHECK( resultf.learned() );
+        CHECK( resultf.database.num_bytes < result.database.num_bytes );
+
+        // Check the predictions with single and double precision derivatives are nearly identical
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        statef = state;
+
+        CHECK( solver.solve(state).predicted() );
+        CHECK( solverf.solve(statef).predicted() );
+
+        CHECK( largestRelativeDifference(state.speciesAmounts(), statef.speciesAmounts()) == Approx(0.0).margin(1e-5) );
+    }
+
+    WHEN("sensitivity derivatives and reactivity restrictions are given")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+
+        EquilibriumConditions conditions(specs);
+
+        SmartEquilibriumSolver solver(specs);
+        EquilibriumSolver exactsolver(specs);
+
+        EquilibriumSensitivity sensitivity(specs);
+        EquilibriumSensitivity exactsensitivity(specs);
+
+        SmartEquilibriumResult result;
+
+        auto initialize = [&](ChemicalState& state, double scale)
+        {
+            state = ChemicalState(system);
+            state.temperature(25.0, "celsius");
+            state.pressure(1.0, "bar");
+            state.set("H2O(aq)", scale, "kg");
+            state.set("Calcite", scale, "mol");
+            conditions.temperature(state.temperature());
+            conditions.pressure(state.pressure());
+        };
+
+        ChemicalState state(system);
+        ChemicalState exactstate(system);
+
+        // Check the sensitivity derivatives of a learning operation are those of a full calculation
+        initialize(state, 1.0);
+        exactstate = state;
+
+        result = solver.solve(state, sensitivity, conditions);
+        exactsolver.solve(exactstate, exactsensitivity, conditions);
+
+        CHECK( result.learned() );
+        CHECK( sensitivity.dndc().isApprox(exactsensitivity.dndc()) );
+        CHECK( sensitivity.dndw().isApprox(exactsensitivity.dndw()) );
+
+        const MatrixXd dndc = sensitivity.dndc();
+
+        // Check the sensitivity derivatives of an accepted prediction are those of the learned record (using a default constructed sensitivity object)
+        EquilibriumSensitivity predicted;
+
+        initialize(state, 1.1);
+
+        result = solver.solve(state, predicted, conditions);
+
+        CHECK( result.predicted() );
+        CHECK( predicted.dndc().isApprox(dndc) );
+
+        // Check a prediction with reactivity restrictions does not use records learned without them (and vice versa)
+        EquilibriumRestrictions restrictions(system);
+        restrictions.cannotReact("Calcite");
+
+        initialize(state, 1.1);
+
+        result = solver.solve(state, sensitivity, conditions, restrictions);
+
+        CHECK( result.learned() );
+
+        initialize(state, 1.2);
+
+        result = solver.solve(state, sensitivity, conditions, restrictions);
+
+        CHECK( result.predicted() );
+
+        initialize(state, 1.2);
+
+        result = solver.solve(state, conditions);
+
+        CHECK( result.predicted() );
+        CHECK( result.database.num_records == 2 );
+
+        // Check a prediction that violates the bounds imposed by the reactivity restrictions on the current state is not accepted
+        EquilibriumRestrictions noincrease(system);
+        noincrease.cannotIncrease("Calcite");
+
+        initialize(state, 1.0);
+
+        result = solver.solve(state, conditions, noincrease);
+
+        CHECK( result.learned() );
+        CHECK( state.speciesAmount("Calcite") > 0.5 );
+
+        // The same input conditions and initial component amounts, but with calcite initially dissolved (so it cannot precipitate)
+        initialize(state, 1.0);
+        state.set("Calcite", 0.0, "mol");
+        state.set("Ca+2", 1.0, "mol");
+        state.set("CO3-2", 1.0, "mol");
+
+        result = solver.solve(state, conditions, noincrease);
+
+        CHECK( result.learned() ); // the learned record passes the error test, but it predicts the precipitation of calcite
+        CHECK( state.speciesAmount("Calcite") < 1e-6 );
+    }
+
+    WHEN("the temperature-pressure grid cells are adaptive")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        // Reject all predictions at first so that the acceptance rate of the coarse cell is zero and it gets split
+        SmartEquilibriumOptions options;
+        options.adaptive_cells = true;
+        options.adaptive_min_predictions = 2;
+        options.adaptive_split_min_records = 2;
+        options.reltol = 0.0;
+        options.abstol = 0.0;
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        SmartEquilibriumResult result;
+
+        ChemicalState state(system);
+
+        // The temperatures 25 and 7 °C are in the same coarsest cell (40 K wide) but in different cells after its split (20 K wide)
+        for(auto T : { 25.0, 7.0, 25.0 })
+        {
+            state = ChemicalState(system);
+            state.temperature(T, "celsius");
+            state.pressure(1.0, "bar");
+            state.set("H2O(aq)", 1.0, "kg");
+            state.set("Calcite", 1.0, "mol");
+
+            result = solver.solve(state);
+
+            CHECK( result.succeeded() );
+            CHECK( result.learned() );
+        }
+
+        CHECK( result.database.num_records == 3 );
+        CHECK( result.database.num_cells == 2 );
+
+        // Check the records moved to the finer cells are still used for predictions
+        options.reltol = 0.005;
+        options.abstol = 0.01;
+        solver.setOptions(options);
+
+        state = ChemicalState(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+        CHECK( result.database.num_cells == 2 );
+    }
+
+    WHEN("the search of learned records in neighbouring temperature-pressure grid cells is enabled")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumOptions options;
+        options.search_neighbour_cells = true;
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        // The temperatures 31.5 and 32.5 °C are in neighbouring cells (centered at 300 and 310 K)
+        ChemicalState state(system);
+        state.temperature(31.5, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        CHECK( solver.solve(state).learned() );
+
+        state = ChemicalState(system);
+        state.temperature(32.5, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        auto result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+        CHECK( result.prediction.accepted_neighbour );
+        CHECK( result.prediction.num_cells_visited == 1 );
+        CHECK( result.database.num_cells == 1 );
+    }
+
+    WHEN("the memory budget of the learned data is limited")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumOptions options;
+        options.reltol = 0.0; // force a learning operation in every calculation
+        options.abstol = 0.0;
+        options.eviction_fraction = 0.0; // evict only the necessary records
+
+        SmartEquilibriumResult result;
+
+        ChemicalState state(system);
+
+        auto solve = [&](SmartEquilibriumSolver& solver, Index i)
+        {
+            state = ChemicalState(system);
+            state.temperature(25.0, "celsius");
+            state.pressure(1.0, "bar");
+            state.set("H2O(aq)", 1.0 + 0.1 * i, "kg");
+            state.set("Calcite", 1.0 + 0.1 * i, "mol");
+            return solver.solve(state);
+        };
+
+        SECTION("with a maximum number of records per cell")
+        {
+            options.max_records_per_cell = 3;
+
+            SmartEquilibriumSolver solver(system);
+            solver.setOptions(options);
+
+            for(auto i = 0; i < 3; ++i)
+            {
+                result = solve(solver, i);
+                CHECK( result.learned() );
+                CHECK( result.learning.num_evicted_records == 0 );
+                CHECK( result.database.num_records == i + 1 );
+            }
+
+            for(auto i = 3; i < 6; ++i)
+            {
+                result = solve(solver, i);
+                CHECK( result.learned() );
+                CHECK( result.learning.num_evicted_records == 1 );
+                CHECK( result.database.num_records == 3 );
+            }
+
+            CHECK( result.database.num_evicted_records == 3 );
+        }
+
+        SECTION("with a maximum estimated memory for all records")
+        {
+            SmartEquilibriumSolver solver(system);
+            solver.setOptions(options);
+
+            result = solve(solver, 0);
+
+            const auto bytes = result.database.num_bytes;
+
+            CHECK( bytes > 0 );
+
+            options.max_bytes = 2 * bytes + bytes / 2; // room for two records only
+
+            solver.setOptions(options);
+
+            for(auto i = 1; i < 5; ++i)
+            {
+                result = solve(solver, i);
+                CHECK( result.learned() );
+                CHECK( result.database.num_records <= 2 );
+                CHECK( result.database.num_bytes <= options.max_bytes );
+            }
+
+            CHECK( result.database.num_evicted_records == 3 );
+        }
+    }
 }
@@ -17,6 +17,9 @@
 
 #include "PhreeqcDatabase.hpp"
 
+// C++ includes
+#include <utility>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
@@ -110,7 +113,7 @@ struct PhreeqcDatabaseHelper
         const auto agstate = PhreeqcUtils::aggregateState(s);
         const auto idx = indexfn(species_list, RKT_LAMBDA(x, x.name() == name && x.aggregateState() == agstate));
         if(idx < species_list.size())
-            return species_list[idx];
+            return std::as_const(species_list)[idx];
 
         const auto newspecies = PhreeqcUtils::isMasterSpecies(s) ? createMasterSpecies(s) : createProductSpecies(s);
 
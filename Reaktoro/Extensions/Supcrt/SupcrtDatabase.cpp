@@ -28,20 +28,10 @@
 #include <Reaktoro/Core/Support/DatabaseParser.hpp>
 
 namespace Reaktoro {
+namespace {
 
-SupcrtDatabase::SupcrtDatabase()
-: Database()
-{}
-
-SupcrtDatabase::SupcrtDatabase(const Database& other)
-: Database(other)
-{}
-
-SupcrtDatabase::SupcrtDatabase(const String& name)
-: Database(SupcrtDatabase::withName(name))
-{}
-
-auto SupcrtDatabase::withName(const String& name) -> SupcrtDatabase
+/// Return the Data object with the contents of an embedded SUPCRT database file with given name.
+auto parseSupcrtDatabase(const String& name) -> Data
 {
     errorif(!oneof(name,
         "supcrt98",
@@ -64,8 +54,32 @@ auto SupcrtDatabase::withName(const String& name) -> SupcrtDatabase
         "    - supcrtbl-organics \n",
         "");
     const auto text = Embedded::get("databases/reaktoro/" + name + ".json");
-    const auto doc = Data::parseJson(text);
-    DatabaseParser dbparser(doc);
+    return Data::parseJson(text);
+}
+
+} // namespace
+
+SupcrtDatabase::SupcrtDatabase()
+: Database()
+{}
+
+SupcrtDatabase::SupcrtDatabase(const Database& other)
+: Database(other)
+{}
+
+SupcrtDatabase::SupcrtDatabase(const String& name)
+: Database(SupcrtDatabase::withName(name))
+{}
+
+auto SupcrtDatabase::withName(const String& name) -> SupcrtDatabase
+{
+    DatabaseParser dbparser(parseSupcrtDatabase(name));
+    return Database(dbparser);
+}
+
+auto SupcrtDatabase::withNameLazy(const String& name) -> SupcrtDatabase
+{
+    DatabaseParser dbparser(parseSupcrtDatabase(name), true);
     return Database(dbparser);
 }
 
@@ -54,6 +54,13 @@ public:
     /// @warning An exception is thrown if `name` is not one of the above names.
     /// @param name The name of the embedded database.
     static auto withName(const String& name) -> SupcrtDatabase;
+
+    /// Return a lazy SupcrtDatabase object initialized using an embedded database file.
+    /// Only the species needed (e.g., by the phases of a chemical system) are created.
+    /// @warning An exception is thrown if `name` is not a supported name (see @ref withName).
+    /// @param name The name of the embedded database.
+    /// @see Database::fromFileLazy
+    static auto withNameLazy(const String& name) -> SupcrtDatabase;
 };
 
 } // namespace Reaktoro
@@ -29,5 +29,6 @@ void exportSupcrtDatabase(py::module& m)
         .def(py::init<const String&>())
         .def(py::init<const Database&>())
         .def_static("withName", &SupcrtDatabase::withName)
+        .def_static("withNameLazy", &SupcrtDatabase::withNameLazy)
         ;
 }
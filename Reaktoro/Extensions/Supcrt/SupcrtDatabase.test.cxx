@@ -15,11 +15,20 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <thread>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Phases.hpp>
 #include <Reaktoro/Extensions/Supcrt/SupcrtDatabase.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelHKF.hpp>
+#include <Reaktoro/Utils/AqueousProps.hpp>
 using namespace Reaktoro;
 
 TEST_CASE("Testing SupcrtDatabase object creation using embedded files", "[SupcrtDatabase]")
@@ -100,3 +109,113 @@ TEST_CASE("Testing SupcrtDatabase module", "[SupcrtDatabase]")
         CHECK( Cp0 == Approx(81.8711)     );
     }
 }
+
+TEST_CASE("Testing lazy SupcrtDatabase objects", "[SupcrtDatabase]")
+{
+    auto const createChemicalSystem = [](Database const& db)
+    {
+        Phases phases(db);
+        phases.add( AqueousPhase(speciate("H O C Na Cl Ca Mg")).set(ActivityModelHKF()) );
+        phases.add( GaseousPhase("CO2(g) H2O(g)") );
+        phases.add( MineralPhase("Calcite") );
+        phases.add( MineralPhase("Halite") );
+        return ChemicalSystem(phases);
+    };
+
+    auto const eagerdb = SupcrtDatabase::withName("supcrtbl");
+    auto const lazydb = SupcrtDatabase::withNameLazy("supcrtbl");
+
+    CHECK_FALSE( eagerdb.isLazy() );
+    CHECK( lazydb.isLazy() );
+
+    SECTION("Checking the chemical systems constructed with eager and lazy databases are equivalent")
+    {
+        ChemicalSystem eagersystem = createChemicalSystem(eagerdb);
+        ChemicalSystem lazysystem = createChemicalSystem(lazydb);
+
+        REQUIRE( lazysystem.elements().size() == eagersystem.elements().size() );
+        REQUIRE( lazysystem.species().size() == eagersystem.species().size() );
+        REQUIRE( lazysystem.phases().size() == eagersystem.phases().size() );
+
+        for(auto i = 0; i < eagersystem.elements().size(); ++i)
+            CHECK( lazysystem.element(i).symbol() == eagersystem.element(i).symbol() );
+
+        for(auto i = 0; i < eagersystem.species().size(); ++i)
+        {
+            CHECK( lazysystem.species(i).name() == eagersystem.species(i).name() );
+            CHECK( lazysystem.species(i).aggregateState() == eagersystem.species(i).aggregateState() );
+            CHECK( lazysystem.species(i).elements().symbols() == eagersystem.species(i).elements().symbols() );
+        }
+
+        for(auto i = 0; i < eagersystem.phases().size(); ++i)
+            CHECK( lazysystem.phase(i).species().size() == eagersystem.phase(i).species().size() );
+
+        auto const createChemicalState = [](ChemicalSystem const& system)
+        {
+            ChemicalState state(system);
+            state.temperature(60.0, "celsius");
+            state.pressure(100.0, "bar");
+            state.set("H2O(aq)", 1.0, "kg");
+            state.set("Na+", 1.0, "mol");
+            state.set("Cl-", 1.0, "mol");
+            state.set("CO2(aq)", 0.5, "mol");
+            state.set("HCO3-", 0.1, "mol");
+            state.set("Ca+2", 0.05, "mol");
+            state.set("CO2(g)", 1.0, "mol");
+            state.set("Calcite", 1.0, "mol");
+            return state;
+        };
+
+        ChemicalState eagerstate = createChemicalState(eagersystem);
+        ChemicalState lazystate = createChemicalState(lazysystem);
+
+        ChemicalProps eagerprops(eagerstate);
+        ChemicalProps lazyprops(lazystate);
+
+        for(auto i = 0; i < eagersystem.species().size(); ++i)
+        {
+            CHECK( lazyprops.speciesStandardGibbsEnergy(i) == Approx(eagerprops.speciesStandardGibbsEnergy(i)) );
+            CHECK( lazyprops.speciesChemicalPotential(i) == Approx(eagerprops.speciesChemicalPotential(i)) );
+        }
+
+        AqueousProps eageraqprops(eagerprops);
+        AqueousProps lazyaqprops(lazyprops);
+
+        auto const eagersatspecies = eageraqprops.saturationSpecies();
+        auto const lazysatspecies = lazyaqprops.saturationSpecies();
+
+        REQUIRE( lazysatspecies.size() == eagersatspecies.size() );
+        REQUIRE( lazysatspecies.size() > 0 );
+
+        for(auto i = 0; i < eagersatspecies.size(); ++i)
+        {
+            CHECK( lazysatspecies[i].name() == eagersatspecies[i].name() );
+            CHECK( lazyaqprops.saturationIndexLg(i) == Approx(eageraqprops.saturationIndexLg(i)) );
+        }
+
+        CHECK( lazyaqprops.pH() == Approx(eageraqprops.pH()) );
+        CHECK( lazyaqprops.ionicStrength() == Approx(eageraqprops.ionicStrength()) );
+    }
+
+    SECTION("Checking a lazy database can be queried from several threads")
+    {
+        auto const names = eagerdb.speciesWithAggregateState(AggregateState::Aqueous);
+
+        Vec<std::thread> threads;
+        for(auto k = 0; k < 4; ++k)
+            threads.emplace_back([&, k]() {
+                for(auto i = k; i < names.size(); i += 4)
+                    lazydb.species(names[i].name());
+                lazydb.speciesWithAggregateStateAndElements(AggregateState::Gas, {"C", "O"});
+                lazydb.reaction("CO2(aq) + H2O(aq) = HCO3- + H+");
+            });
+        for(auto& thread : threads)
+            thread.join();
+
+        auto const species = lazydb.speciesWithAggregateState(AggregateState::Aqueous);
+
+        REQUIRE( species.size() == names.size() );
+        for(auto i = 0; i < names.size(); ++i)
+            CHECK( species[i].name() == names[i].name() );
+    }
+}
@@ -17,6 +17,9 @@
 
 #include "ThermoFunEngine.hpp"
 
+// C++ includes
+#include <mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 
@@ -51,6 +54,9 @@ struct ThermoFunEngine::Impl
     /// The ThermoFun::Database object.
     ThermoFun::Database database;
 
+    /// The mutex used to serialize calls to `engine`, which is not thread-safe and is shared among copies of ThermoFunEngine.
+    mutable std::mutex mutex;
+
     /// Costruct a Impl object with given ThermoFun::Database object.
     Impl(const ThermoFun::Database& database)
     : engine(database), database(database)
@@ -77,6 +83,7 @@ struct ThermoFunEngine::Impl
     {
         double Tval = T.val();
         double Pval = P.val();
+        std::lock_guard<std::mutex> lock(mutex);
         const auto props = engine.thermoPropertiesSubstance(Tval, Pval, substance);
         return convertProps(props, substance);
     }
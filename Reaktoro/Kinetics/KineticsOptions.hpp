@@ -18,10 +18,46 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
 
 namespace Reaktoro {
 
+/// The options for the adaptive time integration of chemical kinetics.
+/// Each step is accepted when the estimated local error in the amount of every species @eq{n_i}
+/// satisfies @eq{|e_i| \leq \mathrm{atol} + \mathrm{rtol}\,|n_i|}. Otherwise, the step is
+/// rejected and attempted again with a smaller time step.
+/// @see KineticsSolver::integrate
+struct KineticsIntegrationOptions
+{
+    /// The relative tolerance for the local error in the species amounts.
+    double rtol = 1e-4;
+
+    /// The absolute tolerance for the local error in the species amounts (in mol).
+    double atol = 1e-10;
+
+    /// The time step of the first attempted step (in s). If zero, the whole time interval is attempted first.
+    double dt = 0.0;
+
+    /// The smallest time step allowed (in s). The integration fails if smaller time steps are needed.
+    double dtmin = 0.0;
+
+    /// The largest time step allowed (in s).
+    double dtmax = inf;
+
+    /// The factor applied to the optimal time step estimated from the local error to reduce step rejections.
+    double safety = 0.9;
+
+    /// The maximum factor by which the time step can grow after an accepted step.
+    double max_growth = 5.0;
+
+    /// The minimum factor by which the time step can shrink after a rejected step.
+    double min_shrink = 0.1;
+
+    /// The maximum number of attempted steps (accepted or rejected) in the integration.
+    Index max_steps = 10000;
+};
+
 /// The options for chemical kinetics calculation.
 struct KineticsOptions : EquilibriumOptions
 {
@@ -35,6 +71,9 @@ struct KineticsOptions : EquilibriumOptions
 
     /// The time step used for preconditioning the chemical state when performing the very first chemical kinetics step.
     double dt0 = 1e-6;
+
+    /// The options for the adaptive time integration with KineticsSolver::integrate.
+    KineticsIntegrationOptions integration;
 };
 
 } // namespace Reaktoro
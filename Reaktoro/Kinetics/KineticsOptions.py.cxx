@@ -25,9 +25,23 @@ using namespace Reaktoro;
 
 void exportKineticsOptions(py::module& m)
 {
+    py::class_<KineticsIntegrationOptions>(m, "KineticsIntegrationOptions")
+        .def(py::init<>())
+        .def_readwrite("rtol", &KineticsIntegrationOptions::rtol, "The relative tolerance for the local error in the species amounts.")
+        .def_readwrite("atol", &KineticsIntegrationOptions::atol, "The absolute tolerance for the local error in the species amounts (in mol).")
+        .def_readwrite("dt", &KineticsIntegrationOptions::dt, "The time step of the first attempted step (in s). If zero, the whole time interval is attempted first.")
+        .def_readwrite("dtmin", &KineticsIntegrationOptions::dtmin, "The smallest time step allowed (in s). The integration fails if smaller time steps are needed.")
+        .def_readwrite("dtmax", &KineticsIntegrationOptions::dtmax, "The largest time step allowed (in s).")
+        .def_readwrite("safety", &KineticsIntegrationOptions::safety, "The factor applied to the optimal time step estimated from the local error to reduce step rejections.")
+        .def_readwrite("max_growth", &KineticsIntegrationOptions::max_growth, "The maximum factor by which the time step can grow after an accepted step.")
+        .def_readwrite("min_shrink", &KineticsIntegrationOptions::min_shrink, "The minimum factor by which the time step can shrink after a rejected step.")
+        .def_readwrite("max_steps", &KineticsIntegrationOptions::max_steps, "The maximum number of attempted steps (accepted or rejected) in the integration.")
+        ;
+
     py::class_<KineticsOptions, EquilibriumOptions>(m, "KineticsOptions")
         .def(py::init<>())
         .def(py::init<EquilibriumOptions const&>())
         .def_readwrite("dt0", &KineticsOptions::dt0, "The time step used for preconditioning the chemical state when performing the very first chemical kinetics step.")
+        .def_readwrite("integration", &KineticsOptions::integration, "The options for the adaptive time integration with KineticsSolver::integrate.")
         ;
 }
@@ -22,6 +22,32 @@
 
 namespace Reaktoro {
 
+/// Used to provide statistics of an adaptive time integration of chemical kinetics.
+/// @see KineticsSolver::integrate
+struct KineticsIntegrationResult
+{
+    /// The number of accepted time steps.
+    Index accepted = 0;
+
+    /// The number of rejected time steps.
+    Index rejected = 0;
+
+    /// The number of chemical kinetics steps solved, including those of rejected time steps.
+    Index solves = 0;
+
+    /// The time reached by the integration (in s), which is the final time if the integration succeeded.
+    double time = 0.0;
+
+    /// The smallest accepted time step (in s).
+    double dtmin = 0.0;
+
+    /// The largest accepted time step (in s).
+    double dtmax = 0.0;
+
+    /// The time step estimated for the next step after the last accepted one (in s), which can be used to continue the integration.
+    double dtnext = 0.0;
+};
+
 /// Used to describe the result of a chemical kinetics calculation.
 struct KineticsResult : EquilibriumResult
 {
@@ -31,6 +57,9 @@ struct KineticsResult : EquilibriumResult
     /// Construct a  KineticsResult object from a EquilibriumResult one.
     KineticsResult(EquilibriumResult const& other)
     : EquilibriumResult(other) {}
+
+    /// The statistics of the adaptive time integration (only set by KineticsSolver::integrate).
+    KineticsIntegrationResult integration;
 };
 
 } // namespace Reaktoro
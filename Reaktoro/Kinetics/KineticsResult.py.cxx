@@ -25,7 +25,19 @@ using namespace Reaktoro;
 
 void exportKineticsResult(py::module& m)
 {
+    py::class_<KineticsIntegrationResult>(m, "KineticsIntegrationResult")
+        .def(py::init<>())
+        .def_readwrite("accepted", &KineticsIntegrationResult::accepted, "The number of accepted time steps.")
+        .def_readwrite("rejected", &KineticsIntegrationResult::rejected, "The number of rejected time steps.")
+        .def_readwrite("solves", &KineticsIntegrationResult::solves, "The number of chemical kinetics steps solved, including those of rejected time steps.")
+        .def_readwrite("time", &KineticsIntegrationResult::time, "The time reached by the integration (in s), which is the final time if the integration succeeded.")
+        .def_readwrite("dtmin", &KineticsIntegrationResult::dtmin, "The smallest accepted time step (in s).")
+        .def_readwrite("dtmax", &KineticsIntegrationResult::dtmax, "The largest accepted time step (in s).")
+        .def_readwrite("dtnext", &KineticsIntegrationResult::dtnext, "The time step estimated for the next step after the last accepted one (in s).")
+        ;
+
     py::class_<KineticsResult, EquilibriumResult>(m, "KineticsResult")
         .def(py::init<>())
+        .def_readwrite("integration", &KineticsResult::integration, "The statistics of the adaptive time integration (only set by KineticsSolver::integrate).")
         ;
 }
@@ -17,6 +17,10 @@
 
 #include "KineticsSolver.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <cmath>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
@@ -220,6 +224,133 @@ struct KineticsSolver::Impl
         updateEquilibriumConditionsForKinetics(state, dt, conditions);
         return result += ksolver.solve(state, sensitivity, kconditions, restrictions);
     }
+
+    //=================================================================================================================
+    //
+    // CHEMICAL KINETICS INTEGRATION METHODS
+    //
+    //=================================================================================================================
+
+    auto integrate(ChemicalState& state, double t0, double t1) -> KineticsResult
+    {
+        return integrate(state, t0, t1, [&](ChemicalState& s, double dt) { updateEquilibriumConditionsForKinetics(s, dt); return KineticsResult(ksolver.solve(s, kconditions)); });
+    }
+
+    auto integrate(ChemicalState& state, double t0, double t1, EquilibriumRestrictions const& restrictions) -> KineticsResult
+    {
+        return integrate(state, t0, t1, [&](ChemicalState& s, double dt) { updateEquilibriumConditionsForKinetics(s, dt); return KineticsResult(ksolver.solve(s, kconditions, restrictions)); });
+    }
+
+    auto integrate(ChemicalState& state, double t0, double t1, EquilibriumConditions const& conditions) -> KineticsResult
+    {
+        return integrate(state, t0, t1, [&](ChemicalState& s, double dt) { updateEquilibriumConditionsForKinetics(s, dt, conditions); return KineticsResult(ksolver.solve(s, kconditions)); });
+    }
+
+    auto integrate(ChemicalState& state, double t0, double t1, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult
+    {
+        return integrate(state, t0, t1, [&](ChemicalState& s, double dt) { updateEquilibriumConditionsForKinetics(s, dt, conditions); return KineticsResult(ksolver.solve(s, kconditions, restrictions)); });
+    }
+
+    /// React a chemical state from time `t0` to time `t1` with adaptive time steps, each performed with a given kinetics step function.
+    /// The step function must not precondition the state with a short time step (as done in method solve), since this time would not be accounted for.
+    template<typename StepFn>
+    auto integrate(ChemicalState& state, double t0, double t1, StepFn const& step) -> KineticsResult
+    {
+        errorif(t1 < t0, "Expecting a final time (", t1, " s) not smaller than the initial time (", t0, " s) in KineticsSolver::integrate.");
+
+        auto const& opts = koptions.integration;
+
+        KineticsResult result;
+        result.optima.succeeded = true; // in case no kinetics step is needed (e.g., when t0 == t1)
+
+        auto& stats = result.integration;
+
+        // Ensure the species reacting according to equilibrium are first equilibrated with a zero time step, so that no reaction takes place before t0
+        if(state.equilibrium().empty())
+        {
+            result += step(state, 0.0);
+            ++stats.solves;
+        }
+
+        ChemicalState full = state; // the chemical state computed with a single full step
+        ChemicalState half = state; // the chemical state computed with two half steps
+
+        auto t = t0;
+        auto dt = opts.dt > 0.0 ? opts.dt : t1 - t0;
+
+        while(t < t1)
+        {
+            if(stats.accepted + stats.rejected >= opts.max_steps)
+            {
+                result.optima.succeeded = false;
+                break;
+            }
+
+            dt = std::min(dt, opts.dtmax);
+
+            const auto last = t + dt >= t1; // true if this step reaches the final time
+            const auto h = last ? t1 - t : dt;
+
+            full = state;
+            half = state;
+
+            const auto rfull = step(full, h);
+            const auto rhalf1 = step(half, 0.5 * h);
+            const auto rhalf2 = rhalf1.succeeded() ? step(half, 0.5 * h) : rhalf1;
+
+            stats.solves += rhalf1.succeeded() ? 3 : 2;
+
+            const auto succeeded = rfull.succeeded() && rhalf1.succeeded() && rhalf2.succeeded();
+
+            const auto error = succeeded ? estimateLocalError(state, full, half) : inf;
+
+            if(error <= 1.0)
+            {
+                state = half;
+                t = last ? t1 : t + h;
+                stats.dtmin = stats.accepted ? std::min(stats.dtmin, h) : h;
+                stats.dtmax = std::max(stats.dtmax, h);
+                ++stats.accepted;
+                result += rhalf1;
+                result += rhalf2;
+            }
+            else ++stats.rejected;
+
+            // The local error of a backward Euler step is proportional to h², so the time step with unit error is h/sqrt(error)
+            const auto factor = error > 0.0 ? opts.safety / std::sqrt(error) : opts.max_growth;
+            const auto max_factor = error <= 1.0 ? opts.max_growth : 1.0; // never grow the time step after a rejected one
+
+            const auto dtnew = h * std::clamp(factor, opts.min_shrink, max_factor);
+
+            // An accepted last step truncated to reach t1 does not limit the time step estimated for a next step
+            dt = last && error <= 1.0 ? std::max(dt, dtnew) : dtnew;
+
+            if(t < t1 && dt < opts.dtmin)
+            {
+                result.optima.succeeded = false;
+                break;
+            }
+        }
+
+        stats.time = t;
+        stats.dtnext = dt;
+
+        return result;
+    }
+
+    /// Return the local error in the species amounts of a kinetics step, scaled by the tolerances, estimated from the states computed with a single full step and two half steps.
+    auto estimateLocalError(ChemicalState const& state, ChemicalState const& full, ChemicalState const& half) const -> double
+    {
+        auto const& opts = koptions.integration;
+
+        const ArrayXd n0 = state.speciesAmounts().cast<double>();
+        const ArrayXd n1 = full.speciesAmounts().cast<double>();
+        const ArrayXd n2 = half.speciesAmounts().cast<double>();
+
+        const ArrayXd scale = opts.atol + opts.rtol * n0.abs().max(n2.abs());
+
+        return ((n2 - n1).abs() / scale).maxCoeff();
+    }
 };
 
 KineticsSolver::KineticsSolver(ChemicalSystem const& system)
@@ -303,6 +434,26 @@ auto KineticsSolver::solve(ChemicalState& state, KineticsSensitivity& sensitivit
     return pimpl->solve(state, sensitivity, dt, conditions, restrictions);
 }
 
+auto KineticsSolver::integrate(ChemicalState& state, double t0, double t1) -> KineticsResult
+{
+    return pimpl->integrate(state, t0, t1);
+}
+
+auto KineticsSolver::integrate(ChemicalState& state, double t0, double t1, EquilibriumRestrictions const& restrictions) -> KineticsResult
+{
+    return pimpl->integrate(state, t0, t1, restrictions);
+}
+
+auto KineticsSolver::integrate(ChemicalState& state, double t0, double t1, EquilibriumConditions const& conditions) -> KineticsResult
+{
+    return pimpl->integrate(state, t0, t1, conditions);
+}
+
+auto KineticsSolver::integrate(ChemicalState& state, double t0, double t1, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult
+{
+    return pimpl->integrate(state, t0, t1, conditions, restrictions);
+}
+
 auto KineticsSolver::setOptions(KineticsOptions const& options) -> void
 {
     pimpl->setOptions(options);
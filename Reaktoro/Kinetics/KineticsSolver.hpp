@@ -149,6 +149,41 @@ public:
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult;
 
+    //=================================================================================================================
+    //
+    // CHEMICAL KINETICS INTEGRATION METHODS
+    //
+    //=================================================================================================================
+
+    /// React a chemical state from a given initial time to a given final time using adaptive time steps.
+    /// The time steps are chosen automatically so that the local error in the species amounts, estimated with
+    /// step doubling (one step compared against two half steps), satisfies the tolerances in
+    /// KineticsOptions::integration. Rejected steps are attempted again with smaller time steps and the time step
+    /// grows when the error estimate allows, so that large time steps are taken wherever the reaction rates permit.
+    /// A state that has not reacted previously is first equilibrated with a zero time step (without the short
+    /// reacting step with KineticsOptions::dt0 performed in method solve), so that it reacts only from `t0` to `t1`.
+    /// Use @ref KineticsResult::integration for the statistics of the integration.
+    /// @param[in,out] state The initial chemical state at time `t0` (in) and the computed reacted state at time `t1` (out)
+    /// @param t0 The initial time (in s).
+    /// @param t1 The final time (in s).
+    auto integrate(ChemicalState& state, double t0, double t1) -> KineticsResult;
+
+    /// React a chemical state from a given initial time to a given final time using adaptive time steps respecting given reactivity restrictions.
+    /// \copydetails KineticsSolver::integrate(ChemicalState&, double, double)
+    /// @param restrictions The reactivity restrictions on the amounts of selected species
+    auto integrate(ChemicalState& state, double t0, double t1, EquilibriumRestrictions const& restrictions) -> KineticsResult;
+
+    /// React a chemical state from a given initial time to a given final time using adaptive time steps respecting given constraint conditions.
+    /// \copydetails KineticsSolver::integrate(ChemicalState&, double, double)
+    /// @param conditions The specified constraint conditions to be attained during chemical kinetics
+    auto integrate(ChemicalState& state, double t0, double t1, EquilibriumConditions const& conditions) -> KineticsResult;
+
+    /// React a chemical state from a given initial time to a given final time using adaptive time steps respecting given constraint conditions and reactivity restrictions.
+    /// \copydetails KineticsSolver::integrate(ChemicalState&, double, double)
+    /// @param conditions The specified constraint conditions to be attained during chemical kinetics
+    /// @param restrictions The reactivity restrictions on the amounts of selected species
+    auto integrate(ChemicalState& state, double t0, double t1, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult;
+
     //=================================================================================================================
     //
     // MISCELLANEOUS METHODS
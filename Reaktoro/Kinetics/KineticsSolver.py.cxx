@@ -50,6 +50,11 @@ void exportKineticsSolver(py::module& m)
         .def("solve", py::overload_cast<ChemicalState&, KineticsSensitivity&, real const&, EquilibriumConditions const&>(&KineticsSolver::solve), "React a chemical state for a given time interval respecting given constraint conditions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("dt"), py::arg("conditions"))
         .def("solve", py::overload_cast<ChemicalState&, KineticsSensitivity&, real const&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&KineticsSolver::solve), "React a chemical state for a given time interval respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("dt"), py::arg("conditions"), py::arg("restrictions"))
 
+        .def("integrate", py::overload_cast<ChemicalState&, double, double>(&KineticsSolver::integrate), "React a chemical state from a given initial time to a given final time using adaptive time steps.", py::arg("state"), py::arg("t0"), py::arg("t1"))
+        .def("integrate", py::overload_cast<ChemicalState&, double, double, EquilibriumRestrictions const&>(&KineticsSolver::integrate), "React a chemical state from a given initial time to a given final time using adaptive time steps respecting given reactivity restrictions.", py::arg("state"), py::arg("t0"), py::arg("t1"), py::arg("restrictions"))
+        .def("integrate", py::overload_cast<ChemicalState&, double, double, EquilibriumConditions const&>(&KineticsSolver::integrate), "React a chemical state from a given initial time to a given final time using adaptive time steps respecting given constraint conditions.", py::arg("state"), py::arg("t0"), py::arg("t1"), py::arg("conditions"))
+        .def("integrate", py::overload_cast<ChemicalState&, double, double, EquilibriumConditions const&, EquilibriumRestrictions const&>(&KineticsSolver::integrate), "React a chemical state from a given initial time to a given final time using adaptive time steps respecting given constraint conditions and reactivity restrictions.", py::arg("state"), py::arg("t0"), py::arg("t1"), py::arg("conditions"), py::arg("restrictions"))
+
         .def("setOptions", &KineticsSolver::setOptions)
         ;
 }
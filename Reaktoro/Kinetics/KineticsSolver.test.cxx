@@ -16,6 +16,7 @@
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
 // C++ includes
+#include <cmath>
 #include <iomanip>
 
 // Catch includes
@@ -116,6 +117,76 @@ TEST_CASE("Testing KineticsSolver", "[KineticsSolver]")
         CHECK( bfinal[iO] == Approx(b0[iO]) );
     }
 
+    SECTION("When the chemical state is integrated in time with adaptive time steps")
+    {
+        KineticsOptions options;
+        options.integration.rtol = 1e-4;
+
+        KineticsSolver solver(system);
+        solver.setOptions(options);
+
+        ChemicalState unreacted = state;
+
+        auto res = solver.integrate(unreacted, 0.0, 0.0);
+
+        REQUIRE( res.succeeded() );
+
+        CHECK( res.integration.time == 0.0 );
+        CHECK( res.integration.accepted == 0 );
+        CHECK( res.integration.solves == 1 ); // the equilibration of the species reacting according to equilibrium
+        CHECK( unreacted.speciesAmount("C(gr)") == Approx(1.0) ); // no reaction takes place when t0 == t1
+
+        res = solver.integrate(state, 0.0, 100.0);
+
+        REQUIRE( res.succeeded() );
+
+        CHECK( res.integration.time == 100.0 );
+        CHECK( res.integration.accepted > 1 );
+        CHECK( res.integration.rejected >= 1 ); // the first attempt with the whole time interval is too large
+        CHECK( res.integration.dtmin <= res.integration.dtmax );
+        CHECK( res.integration.dtnext >= res.integration.dtmin ); // not limited by a last step truncated to reach the final time
+
+        CHECK( state.speciesAmount("C(gr)") == Approx(std::exp(-1.0)).epsilon(1e-2) ); // exact solution n(t) = exp(-k0*t)
+
+        options.integration.max_steps = 1;
+
+        solver.setOptions(options);
+
+        res = solver.integrate(state, 100.0, 200.0);
+
+        CHECK( res.failed() );
+        CHECK( res.integration.time < 200.0 );
+    }
+
+    SECTION("When the reaction rate declares the phases on which it depends")
+    {
+        ChemicalSystem system(db,
+            CondensedPhase("C(gr)"),
+            GaseousPhase("O2 CO2"),
+            GeneralReaction("C(gr) + O2 = CO2").setRateModel(ratefn).setRateDependencies("C(gr)")
+        );
+
+        CHECK( system.reaction(0).rateDependencies() == Strings{ "C(gr)" } );
+
+        ChemicalState state(system);
+        state.set("C(gr)", 1.0, "mol");
+        state.set("O2", 1.0, "mol");
+
+        KineticsOptions options;
+        options.hessian_seed_group_size = 4; // the amounts of C(gr) and a gaseous species can be seeded together
+
+        KineticsSolver solver(system);
+        solver.setOptions(options);
+
+        const auto dt = 1.0;
+
+        auto res = solver.solve(state, dt);
+
+        REQUIRE( res.succeeded() );
+
+        CHECK( state.speciesAmount("C(gr)") == Approx(0.990099) );
+    }
+
     SECTION("When a state previously used in an equilibrium calculation is used in a kinetics calculation")
     {
         EquilibriumSolver esolver(system);
@@ -18,6 +18,8 @@
 #include "KineticsUtils.hpp"
 
 // Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
@@ -77,6 +79,34 @@ auto createEquilibriumSpecsForKinetics(EquilibriumSpecs specs) -> EquilibriumSpe
         return dxi - dt * M * r; // Δξ - ΔtMr = 0
     };
 
+    // Set the species on which each equation constraint depends if the rates of all reactions have declared phase dependencies
+    const auto sparse = std::all_of(reactions.begin(), reactions.end(), RKT_LAMBDA(x, !x.rateDependencies().empty()));
+
+    if(sparse)
+    {
+        auto const& phases = system.phases();
+
+        // The indices of the species in the phases on which the rate of each reaction depends
+        Vec<Indices> ratedeps(Nr);
+        for(auto const& [ireaction, reaction] : enumerate(reactions))
+        {
+            for(auto const& phasename : reaction.rateDependencies())
+            {
+                const auto iphase = phases.indexWithName(phasename);
+                const auto offset = phases.numSpeciesUntilPhase(iphase);
+                const auto size = phases[iphase].species().size();
+                ratedeps[ireaction] = merge(ratedeps[ireaction], range(offset, offset + size));
+            }
+        }
+
+        // The residual of the equation constraint of a reaction depends on the rates of the reactions coupled to it in M
+        econstraints.dependencies.resize(Nr);
+        for(auto r = 0; r < Nr; ++r)
+            for(auto s = 0; s < Nr; ++s)
+                if(M(r, s) != 0.0)
+                    econstraints.dependencies[r] = merge(econstraints.dependencies[r], ratedeps[s]);
+    }
+
     specs.addConstraints(econstraints);
 
     return specs;
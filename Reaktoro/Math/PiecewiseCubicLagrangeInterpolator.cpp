@@ -0,0 +1,150 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "PiecewiseCubicLagrangeInterpolator.hpp"
+
+// C++ includes
+#include <algorithm>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// Return the index of the first of the (at most) four coordinates used to interpolate at `p`.
+auto stencilBegin(double p, const Vec<double>& coordinates, Index stencilsize) -> Index
+{
+    const auto size = coordinates.size();
+    const auto upper = std::upper_bound(coordinates.begin(), coordinates.end(), p) - coordinates.begin();
+    const auto cell = upper == 0 ? 0 : upper - 1; // the index of the coordinate at the left of p
+    const auto begin = cell == 0 ? 0 : cell - 1;
+    return std::min<Index>(begin, size - stencilsize);
+}
+
+/// Compute the weights of the Lagrange polynomials over the coordinates in [begin, begin + stencilsize) at `p`.
+auto lagrangeWeights(const real& p, const Vec<double>& coordinates, Index begin, Index stencilsize, real weights[4]) -> void
+{
+    for(auto k = 0; k < stencilsize; ++k)
+    {
+        weights[k] = 1.0;
+        const auto xk = coordinates[begin + k];
+        for(auto m = 0; m < stencilsize; ++m)
+            if(m != k)
+                weights[k] *= (p - coordinates[begin + m])/(xk - coordinates[begin + m]);
+    }
+}
+
+auto linearize(const Vec<Vec<double>>& data) -> Vec<double>
+{
+    if(data.empty())
+        return {};
+    Vec<double> result;
+    result.reserve(data.size() * data.front().size());
+    for(const auto& row : data)
+        result.insert(result.end(), row.begin(), row.end());
+    return result;
+}
+
+} // namespace
+
+PiecewiseCubicLagrangeInterpolator::PiecewiseCubicLagrangeInterpolator()
+{}
+
+PiecewiseCubicLagrangeInterpolator::PiecewiseCubicLagrangeInterpolator(
+    const Vec<double>& xcoordinates,
+    const Vec<double>& ycoordinates,
+    const Vec<double>& data)
+: m_xcoordinates(xcoordinates),
+  m_ycoordinates(ycoordinates),
+  m_data(data)
+{
+    errorif(m_data.size() != m_xcoordinates.size() * m_ycoordinates.size(), "Expecting ",
+        m_xcoordinates.size() * m_ycoordinates.size(), " data points in PiecewiseCubicLagrangeInterpolator but got ", m_data.size(), ".");
+}
+
+PiecewiseCubicLagrangeInterpolator::PiecewiseCubicLagrangeInterpolator(
+    const Vec<double>& xcoordinates,
+    const Vec<double>& ycoordinates,
+    const Vec<Vec<double>>& data)
+: PiecewiseCubicLagrangeInterpolator(xcoordinates, ycoordinates, linearize(data))
+{}
+
+auto PiecewiseCubicLagrangeInterpolator::xCoordinates() const -> const Vec<double>&
+{
+    return m_xcoordinates;
+}
+
+auto PiecewiseCubicLagrangeInterpolator::yCoordinates() const -> const Vec<double>&
+{
+    return m_ycoordinates;
+}
+
+auto PiecewiseCubicLagrangeInterpolator::data() const -> const Vec<double>&
+{
+    return m_data;
+}
+
+auto PiecewiseCubicLagrangeInterpolator::empty() const -> bool
+{
+    return m_data.empty();
+}
+
+auto PiecewiseCubicLagrangeInterpolator::operator()(real x, real y) const -> real
+{
+    // Check if the interpolation data contains only one point
+    if(m_data.size() == 1) return m_data[0];
+
+    const auto xA = m_xcoordinates.front();
+    const auto xB = m_xcoordinates.back();
+    const auto yA = m_ycoordinates.front();
+    const auto yB = m_ycoordinates.back();
+
+    warningif(xA != xB && (x < xA || x > xB), "Interpolating with x = ", x, " when x(min) = ", xA, " and x(max) = ", xB, ".");
+    warningif(yA != yB && (y < yA || y > yB), "Interpolating with y = ", y, " when y(min) = ", yA, " and y(max) = ", yB, ".");
+
+    if(x < xA) x = xA;
+    if(x > xB) x = xB;
+    if(y < yA) y = yA;
+    if(y > yB) y = yB;
+
+    const auto size_x = m_xcoordinates.size();
+    const auto size_y = m_ycoordinates.size();
+
+    const auto stencilsize_x = std::min<Index>(size_x, 4);
+    const auto stencilsize_y = std::min<Index>(size_y, 4);
+
+    const auto i0 = stencilBegin(x.val(), m_xcoordinates, stencilsize_x);
+    const auto j0 = stencilBegin(y.val(), m_ycoordinates, stencilsize_y);
+
+    real wx[4], wy[4];
+    lagrangeWeights(x, m_xcoordinates, i0, stencilsize_x, wx);
+    lagrangeWeights(y, m_ycoordinates, j0, stencilsize_y, wy);
+
+    real res = 0.0;
+    for(auto j = 0; j < stencilsize_y; ++j)
+    {
+        real row = 0.0;
+        for(auto i = 0; i < stencilsize_x; ++i)
+            row += wx[i] * m_data[(i0 + i) + (j0 + j)*size_x];
+        res += wy[j] * row;
+    }
+
+    return res;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,83 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// A class used to calculate piecewise cubic Lagrange interpolation of data in two dimensions.
+/// The interpolation at a point (x, y) uses a tensor product of cubic Lagrange
+/// polynomials over the 4x4 grid points closest to the cell containing (x, y).
+/// It is exact for data generated by bicubic polynomials. Along a direction
+/// with fewer than four coordinates, the polynomials have lower degree. The
+/// interpolation is continuous across cells, but its derivatives are not,
+/// since neighboring cells use different stencils (i.e., it is not a C1
+/// bicubic spline or Hermite interpolation).
+class PiecewiseCubicLagrangeInterpolator
+{
+public:
+    /// Construct a default PiecewiseCubicLagrangeInterpolator instance
+    PiecewiseCubicLagrangeInterpolator();
+
+    /// Construct a PiecewiseCubicLagrangeInterpolator instance with given data
+    /// @param xcoordinates The x-coordinates for the interpolation
+    /// @param ycoordinates The y-coordinates for the interpolation
+    /// @param data The data to be interpolated over the (x, y) coordinates
+    PiecewiseCubicLagrangeInterpolator(
+        const Vec<double>& xcoordinates,
+        const Vec<double>& ycoordinates,
+        const Vec<double>& data);
+
+    /// Construct a PiecewiseCubicLagrangeInterpolator instance with given data
+    /// @param xcoordinates The x-coordinates for the interpolation
+    /// @param ycoordinates The y-coordinates for the interpolation
+    /// @param data The data to be interpolated over the (x, y) coordinates
+    PiecewiseCubicLagrangeInterpolator(
+        const Vec<double>& xcoordinates,
+        const Vec<double>& ycoordinates,
+        const Vec<Vec<double>>& data);
+
+    /// Return the x-coordinates of the interpolation.
+    auto xCoordinates() const -> const Vec<double>&;
+
+    /// Return the y-coordinates of the interpolation.
+    auto yCoordinates() const -> const Vec<double>&;
+
+    /// Return the interpolation data.
+    auto data() const -> const Vec<double>&;
+
+    /// Check if the PiecewiseCubicLagrangeInterpolator instance is empty.
+    auto empty() const -> bool;
+
+    /// Calculate the interpolation at the provided (x, y) point.
+    /// @param x The x-coordinate of the point
+    /// @param y The y-coordinate of the point
+    /// @return The interpolation of the data at (x, y) point
+    auto operator()(real x, real y) const -> real;
+
+private:
+    /// The coordinates of the x and y points
+    Vec<double> m_xcoordinates, m_ycoordinates;
+
+    /// The interpolated data on every (x, y) point
+    Vec<double> m_data;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,94 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Math/PiecewiseCubicLagrangeInterpolator.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing PiecewiseCubicLagrangeInterpolator", "[PiecewiseCubicLagrangeInterpolator]")
+{
+    auto nx = GENERATE(10, 5, 4);
+    auto ny = GENERATE(10, 5, 4);
+
+    INFO("nx = " << nx);
+    INFO("ny = " << ny);
+
+    Vec<double> x(nx);
+    Vec<double> y(ny);
+    Vec<double> z(nx * ny);
+
+    for(auto i = 0; i < nx; ++i)
+        x[i] = i;
+
+    for(auto j = 0; j < ny; ++j)
+        y[j] = j*j;
+
+    auto f = [](auto x, auto y) { return 1 + 3*x + 5*y + 7*x*y + 2*x*x*x - y*y*y + x*x*y*y*y; };
+
+    for(auto i = 0; i < nx; ++i) for(auto j = 0; j < ny; ++j)
+    {
+        const auto k = i + nx*j;
+        z[k] = f(x[i], y[j]);
+    }
+
+    PiecewiseCubicLagrangeInterpolator interpolator(x, y, z);
+
+    for(auto i = 0; i < nx; ++i) for(auto j = 0; j < ny; ++j)
+        CHECK( interpolator(x[i], y[j]) == Approx(z[i + nx*j]) );
+
+    for(auto i = 0; i < 2*nx; ++i) for(auto j = 0; j < 2*ny; ++j)
+    {
+        const auto xi = x.front() + i*(x.back() - x.front())/(2*nx);
+        const auto yj = y.front() + j*(y.back() - y.front())/(2*ny);
+
+        CHECK( interpolator(xi, yj) == Approx(f(xi, yj)) );
+    }
+
+    // Check derivatives of the interpolation are exact as well
+    real xr = 0.5 * (x[1] + x[2]);
+    real yr = 0.5 * (y[1] + y[2]);
+
+    autodiff::seed(xr);
+    CHECK( grad(interpolator(xr, yr)) == Approx(3 + 7*yr.val() + 6*xr.val()*xr.val() + 2*xr.val()*yr.val()*yr.val()*yr.val()) );
+    autodiff::unseed(xr);
+
+    autodiff::seed(yr);
+    CHECK( grad(interpolator(xr, yr)) == Approx(5 + 7*xr.val() - 3*yr.val()*yr.val() + 3*xr.val()*xr.val()*yr.val()*yr.val()) );
+    autodiff::unseed(yr);
+}
+
+TEST_CASE("Testing PiecewiseCubicLagrangeInterpolator with few coordinates", "[PiecewiseCubicLagrangeInterpolator]")
+{
+    Vec<double> x = { 1.0, 2.0 };
+    Vec<double> y = { 3.0, 4.0, 5.0 };
+
+    auto f = [](auto x, auto y) { return 1 + 3*x + 5*y + 7*x*y + 2*y*y; }; // linear in x and quadratic in y
+
+    Vec<double> z;
+    for(auto yj : y) for(auto xi : x)
+        z.push_back(f(xi, yj));
+
+    PiecewiseCubicLagrangeInterpolator interpolator(x, y, z);
+
+    CHECK( interpolator(1.5, 3.5) == Approx(f(1.5, 3.5)) );
+    CHECK( interpolator(1.2, 4.7) == Approx(f(1.2, 4.7)) );
+
+    CHECK_THROWS( PiecewiseCubicLagrangeInterpolator(x, y, Vec<double>{ 1.0, 2.0 }) );
+}
@@ -15,11 +15,15 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <thread>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
 #include <Reaktoro/Models/ActivityModels/ActivityModelDavies.hpp>
+#include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
 using namespace Reaktoro;
 
@@ -125,4 +129,19 @@ TEST_CASE("Testing ActivityModelDavies", "[ActivityModelDavies]")
 
         checkActivities(x, props);
     }
+
+    SECTION("Checking the exported aqueous mixture state remains valid after the evaluating thread has exited")
+    {
+        ActivityModel fn = ActivityModelDavies()(species);
+
+        ActivityProps props = ActivityProps::create(species.size());
+
+        std::thread worker([&] { fn(props, {T, P, x}); });
+        worker.join();
+
+        const auto state = props.extra.get(aqueousMixtureStateSlot());
+
+        REQUIRE( state != nullptr );
+        CHECK( state->Is == Approx(AqueousMixture(species).state(T, P, x).Is) );
+    }
 }
@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/ThreadLocal.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
 
@@ -326,10 +327,14 @@ auto activityModelDebyeHuckel(const SpeciesList& species, ActivityModelDebyeHuck
         bneutral.push_back(params.bneutral(species.formula()));
     }
 
-    // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    // Shared pointers to the objects exported via `props.extra` (one aqueous mixture state per thread)
+    ThreadLocal<SharedPtr<AqueousMixtureState>> stateptrs([] { return std::make_shared<AqueousMixtureState>(); });
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
+    // The slots in `props.extra` used to export the aqueous mixture and its state
+    const auto stateslot = aqueousMixtureStateSlot();
+    const auto mixtureslot = aqueousMixtureSlot();
+
     // Define the activity model function of the aqueous mixture
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
     {
@@ -337,14 +342,16 @@ auto activityModelDebyeHuckel(const SpeciesList& species, ActivityModelDebyeHuck
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
-        auto const& state = *stateptr = mixture.state(T, P, x);
+        auto const& stateptr = stateptrs.local();
+        mixture.state(T, P, x, *stateptr);
+        auto const& state = *stateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous mixture and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = stateptr;
-        props.extra["AqueousMixture"] = mixtureptr;
+        props.extra.set(stateslot, stateptr);
+        props.extra.set(mixtureslot, mixtureptr);
 
         // Auxiliary constant references
         const auto& m = state.m;             // the molalities of all species
@@ -36,16 +36,19 @@ auto ActivityModelDrummond(String gas, ActivityModelDrummondParams params) -> Ac
         // The index of the dissolved gas in the aqueous phase.
         const auto igas = species.indexWithFormula(gas);
 
+        // The slot in `props.extra` with the aqueous mixture state exported by a base aqueous activity model
+        const auto stateslot = aqueousMixtureStateSlot();
+
         ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
         {
             // Check AqueousMixtureState is available in props.extra
-            auto stateit = props.extra.find("AqueousMixtureState");
+            auto stateptr = props.extra.get(stateslot);
 
-            errorif(stateit == props.extra.end(),
+            errorif(stateptr == nullptr,
                 "ActivityModelDuanSun expects that another aqueous activity model has been chained first (e.g., Davies, Debye-Huckel, HKF, PitzerHMW, etc.) ");
 
             // The aqueous mixture state exported by a base aqueous activity model.
-            const auto& state = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(stateit->second);
+            const auto& state = *stateptr;
 
             const auto& [a1, a2, a3, a4, a5] = params;
             const auto& T = state.T;
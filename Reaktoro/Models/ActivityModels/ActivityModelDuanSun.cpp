@@ -97,18 +97,22 @@ auto ActivityModelDuanSun(String gas) -> ActivityModelGenerator
         const auto iCl  = aqmix.charged().findWithFormula("Cl-");
         const auto iSO4 = aqmix.charged().findWithFormula("SO4--");
 
+        // The slots in `props.extra` with the aqueous mixture and its state exported by a base aqueous activity model
+        const auto stateslot = aqueousMixtureStateSlot();
+        const auto mixtureslot = aqueousMixtureSlot();
+
         ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
         {
             // Check AqueousMixture and AqueousMixtureState are available in props.extra
-            auto mixtureit = props.extra.find("AqueousMixture");
-            auto stateit = props.extra.find("AqueousMixtureState");
+            auto mixtureptr = props.extra.get(mixtureslot);
+            auto stateptr = props.extra.get(stateslot);
 
-            errorif(stateit == props.extra.end(),
+            errorif(stateptr == nullptr || mixtureptr == nullptr,
                 "ActivityModelDuanSun expects that another aqueous activity model has been chained first (e.g., Davies, Debye-Huckel, HKF, PitzerHMW, etc.) ");
 
             // The aqueous mixture and its state exported by a base aqueous activity model.
-            const auto& mixture = *std::any_cast<SharedPtr<AqueousMixture> const&>(mixtureit->second);
-            const auto& state = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(stateit->second);
+            const auto& mixture = *mixtureptr;
+            const auto& state = *stateptr;
 
             const auto& T  = state.T;
             const auto& P  = state.P;
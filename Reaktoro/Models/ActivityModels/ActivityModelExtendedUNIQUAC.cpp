@@ -23,6 +23,7 @@
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/ThreadLocal.hpp>
 #include <Reaktoro/Core/Embedded.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
 #include <Reaktoro/Serialization/Models/ActivityModels.hpp>
@@ -146,6 +147,9 @@ auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityMode
     ArrayXr xr;
     ArrayXr xq;
 
+    // The state of the aqueous solution reused in every evaluation to avoid heap memory allocation (one per thread)
+    ThreadLocal<AqueousMixtureState> aqstates;
+
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
     {
         // The arguments for the activity model evaluation
@@ -156,7 +160,8 @@ auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityMode
         auto const RT = universalGasConstant*T;
 
         // Evaluate the state of the aqueous solution
-        auto const& aqstate = solution.state(T, P, x);
+        auto& aqstate = aqstates.local();
+        solution.state(T, P, x, aqstate);
 
         // The ionic strength of the solution and its square root
         auto const& I = aqstate.Ie;
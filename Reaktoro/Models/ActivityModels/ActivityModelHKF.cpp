@@ -25,6 +25,7 @@
 #include <Reaktoro/Common/ConvertUtils.hpp>
 #include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Common/NamingUtils.hpp>
+#include <Reaktoro/Common/ThreadLocal.hpp>
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
@@ -333,10 +334,14 @@ auto activityModelHKF(const SpeciesList& species) -> ActivityModel
         charges.push_back(species.charge());
     }
 
-    // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    // Shared pointers to the objects exported via `props.extra` (one aqueous mixture state per thread)
+    ThreadLocal<SharedPtr<AqueousMixtureState>> stateptrs([] { return std::make_shared<AqueousMixtureState>(); });
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
+    // The slots in `props.extra` used to export the aqueous mixture and its state
+    const auto stateslot = aqueousMixtureStateSlot();
+    const auto mixtureslot = aqueousMixtureSlot();
+
     // Define the activity model function of the aqueous phase
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
     {
@@ -344,14 +349,16 @@ auto activityModelHKF(const SpeciesList& species) -> ActivityModel
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
-        auto const& state = *stateptr = mixture.state(T, P, x);
+        auto const& stateptr = stateptrs.local();
+        mixture.state(T, P, x, *stateptr);
+        auto const& state = *stateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous mixture and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = stateptr;
-        props.extra["AqueousMixture"] = mixtureptr;
+        props.extra.set(stateslot, stateptr);
+        props.extra.set(mixtureslot, mixtureptr);
 
         // Auxiliary references to state variables
         const auto& I = state.Is;  // the stoichiometric ionic strength
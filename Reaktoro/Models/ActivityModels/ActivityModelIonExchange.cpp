@@ -42,6 +42,9 @@ auto activityModelIonExchangeGainesThomas(const SpeciesList& species) -> Activit
     // The numbers of exchanger's equivalents for exchange species
     ArrayXd ze = surface.ze();
 
+    // The slot in `props.extra` with the aqueous mixture state exported by the aqueous activity model
+    const auto aqstateslot = aqueousMixtureStateSlot();
+
     // Define the activity model function of the ion exchange phase
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
     {
@@ -59,10 +62,10 @@ auto activityModelIonExchangeGainesThomas(const SpeciesList& species) -> Activit
         ln_g = ArrayXr::Zero(num_species);
 
         // Calculate Davies and Debye--Huckel parameters only if the AqueousPhase has been already evaluated
-        if(props.extra["AqueousMixtureState"].has_value())
+        if(auto aqstateptr = props.extra.get(aqstateslot))
         {
-            // Export aqueous mixture state via `extra` data member
-            const auto& aqstate = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(props.extra["AqueousMixtureState"]);
+            // The aqueous mixture state exported via `extra` data member
+            const auto& aqstate = *aqstateptr;
 
             // Auxiliary constant references properties
             const auto& I = aqstate.Is;            // the stoichiometric ionic strength
@@ -119,6 +122,9 @@ auto activityModelIonExchangeVanselow(const SpeciesList& species) -> ActivityMod
         // The numbers of exchanger's equivalents for exchange species
         ArrayXd ze = surface.ze();
 
+        // The slot in `props.extra` with the aqueous mixture state exported by the aqueous activity model
+        const auto aqstateslot = aqueousMixtureStateSlot();
+
         // Define the activity model function of the ion exchange phase
         ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
         {
@@ -136,10 +142,10 @@ auto activityModelIonExchangeVanselow(const SpeciesList& species) -> ActivityMod
             ln_g = ArrayXr::Zero(num_species);
 
             // Calculate Davies and Debye--Huckel parameters only if the AqueousPhase has been already evaluated
-            if(props.extra["AqueousMixtureState"].has_value())
+            if(auto aqstateptr = props.extra.get(aqstateslot))
             {
-                // Export aqueous mixture state via `extra` data member
-                const auto& aqstate = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(props.extra["AqueousMixtureState"]);
+                // The aqueous mixture state exported via `extra` data member
+                const auto& aqstate = *aqstateptr;
 
                 // Auxiliary constant references properties
                 const auto& I = aqstate.Is;            // the stoichiometric ionic strength
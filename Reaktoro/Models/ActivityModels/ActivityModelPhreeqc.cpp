@@ -25,6 +25,7 @@
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/ThreadLocal.hpp>
 #include <Reaktoro/Common/Warnings.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcDatabase.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcLegacy.hpp>
@@ -93,10 +94,14 @@ auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase cons
         s_x.push_back(s);
     }
 
-    // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto aqstateptr = std::make_shared<AqueousMixtureState>();
+    // Shared pointers to the objects exported via `props.extra` (one aqueous mixture state per thread)
+    ThreadLocal<SharedPtr<AqueousMixtureState>> aqstateptrs([] { return std::make_shared<AqueousMixtureState>(); });
     auto aqsolutionptr = std::make_shared<AqueousMixture>(solution);
 
+    // The slots in `props.extra` used to export the aqueous mixture and its state
+    const auto stateslot = aqueousMixtureStateSlot();
+    const auto mixtureslot = aqueousMixtureSlot();
+
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
     {
         // The arguments for the activity model evaluation
@@ -106,14 +111,16 @@ auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase cons
         assert(x.minCoeff() > 0.0 && x.maxCoeff() <= 1.0);
 
         // Evaluate the state of the aqueous solution
-        auto const& aqstate = *aqstateptr = solution.state(T, P, x);
+        auto const& aqstateptr = aqstateptrs.local();
+        solution.state(T, P, x, *aqstateptr);
+        auto const& aqstate = *aqstateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous solution and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = aqstateptr;
-        props.extra["AqueousMixture"] = aqsolutionptr;
+        props.extra.set(stateslot, aqstateptr);
+        props.extra.set(mixtureslot, aqsolutionptr);
 
         // Calculates gammas and [moles * d(ln gamma)/d mu] for all aqueous species.
         int i, j;
@@ -42,19 +42,22 @@ auto ActivityModelPhreeqcIonicStrengthPressureCorrection() -> ActivityModelGener
 
         const auto Pref = 1.0e5; // reference pressure at 1 bar (in Pa)
 
+        // The slot in `props.extra` with the aqueous mixture state exported by a base aqueous activity model
+        const auto stateslot = aqueousMixtureStateSlot();
+
         ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
         {
             // The arguments for the activity model evaluation
             const auto& [T, P, x] = args;
 
             // Check AqueousMixtureState is available in props.extra
-            auto stateit = props.extra.find("AqueousMixtureState");
+            auto stateptr = props.extra.get(stateslot);
 
-            errorif(stateit == props.extra.end(),
+            errorif(stateptr == nullptr,
                 "ActivityModelPhreeqcIonicStrengthPressureCorrection expects that another aqueous activity model has been chained first (e.g., Davies, Debye-Huckel, HKF, PitzerHMW, etc.) ");
 
             // The aqueous mixture state exported by a base aqueous activity model.
-            const auto& state = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(stateit->second);
+            const auto& state = *stateptr;
 
             const auto mu = state.Ie;
             const auto RT = universalGasConstant * T;
@@ -20,12 +20,15 @@
 // C++ includes
 #include <cassert>
 #include <cmath>
+#include <map>
 #include <set>
 #include <string>
+#include <tuple>
 #include <vector>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/AutoDiff.hpp>
 #include <Reaktoro/Common/ConvertUtils.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
@@ -34,6 +37,7 @@
 #include <Reaktoro/Common/ParseUtils.hpp>
 #include <Reaktoro/Common/Real.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
+#include <Reaktoro/Common/ThreadLocal.hpp>
 #include <Reaktoro/Core/Embedded.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcWater.hpp>
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
@@ -627,6 +631,76 @@ auto computeThetaValuesPHREEQC(real const& I, real const& sqrtI, real const& Aph
     return { thetaE, thetaEP };
 }
 
+/// Used to represent the contribution of an interaction parameter to an entry of a compiled Pitzer interaction table.
+struct PitzerTableTerm
+{
+    Index iparam;        ///< The index of the interaction parameter in PitzerModel::models.
+    Index ientry;        ///< The index of the entry in the interaction table.
+    Vec<double> factors; ///< The factors multiplying the value of the interaction parameter in each coefficient column of the entry.
+};
+
+/// Used to represent interactions of some kind in the Pitzer model packed in contiguous arrays.
+/// Each entry in the table corresponds to a unique combination of species (and of alpha value
+/// for \eq{\beta^{(1)}_{ij}} and \eq{\beta^{(2)}_{ij}} parameters). Its coefficients combine
+/// the current values of all interaction parameters involving these species, so that they are
+/// updated only when temperature or pressure change instead of at every model evaluation.
+struct PitzerTable
+{
+    Indices i0;                  ///< The index of the first species in each entry.
+    Indices i1;                  ///< The index of the second species in each entry.
+    Indices i2;                  ///< The index of the third species in each entry (empty for binary interactions).
+    Indices ialpha;              ///< The index of the alpha value of each entry in PitzerModel::alphas (empty if not applicable).
+    Vec<ArrayXr> coeffs;         ///< The coefficients of the entries in each column of the table.
+    Vec<PitzerTableTerm> terms;  ///< The contributions of the interaction parameters to the entries in the table.
+    std::map<Indices, Index> ientries; ///< The index of the entry with given species indices (and alpha index), used while the table is assembled.
+
+    /// Construct a PitzerTable object with given number of coefficient columns.
+    explicit PitzerTable(Index numcols)
+    : coeffs(numcols)
+    {}
+
+    /// Return the number of entries in the table.
+    auto size() const -> Index
+    {
+        return i0.size();
+    }
+
+    /// Add the contribution of an interaction parameter to the entry of given species (and alpha value).
+    auto add(Indices const& ispecies, Index iparam, Vec<double> const& factors, Index ialphaval = -1) -> void
+    {
+        assert(factors.size() == coeffs.size());
+
+        auto key = ispecies;
+        if(ialphaval != Index(-1))
+            key.push_back(ialphaval);
+
+        auto const [it, inserted] = ientries.emplace(key, size());
+
+        if(inserted)
+        {
+            i0.push_back(ispecies[0]);
+            i1.push_back(ispecies[1]);
+            if(ispecies.size() > 2)
+                i2.push_back(ispecies[2]);
+            if(ialphaval != Index(-1))
+                ialpha.push_back(ialphaval);
+        }
+
+        terms.push_back({ iparam, it->second, factors });
+    }
+
+    /// Update the coefficients of the entries with the current values of the interaction parameters.
+    auto update(ArrayXr const& values) -> void
+    {
+        for(auto& column : coeffs)
+            column = ArrayXr::Zero(size());
+
+        for(auto const& term : terms)
+            for(auto k = 0; k < coeffs.size(); ++k)
+                coeffs[k][term.ientry] += term.factors[k] * values[term.iparam];
+    }
+};
+
 /// The auxiliary type used to store computed values from the Pitzer activity model implemented by @ref Pitzer.
 struct PitzerState
 {
@@ -636,34 +710,35 @@ struct PitzerState
 };
 
 /// The auxiliary type used to implement the Pitzer activity model.
+/// The interaction parameters are compiled into a few tables grouped by the form of their
+/// contributions to the activity coefficients and osmotic coefficient, so that the evaluation
+/// of the model consists of tight loops over contiguous arrays of species indices and coefficients.
 struct PitzerModel
 {
     AqueousMixture solution; ///< The aqueous solution for which this Pitzer activity model is defined.
 
-    Vec<PitzerParam> beta0;  ///< The parameters \eq{\beta^{(0)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> beta1;  ///< The parameters \eq{\beta^{(1)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> beta2;  ///< The parameters \eq{\beta^{(2)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> Cphi;   ///< The parameters \eq{C^{\phi}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> theta;  ///< The parameters \eq{\theta_{ij}(T, P)} in the Pitzer model for cation-cation and anion-anion interactions.
-    Vec<PitzerParam> psi;    ///< The parameters \eq{\psi_{ijk}(T, P)} in the Pitzer model for cation-cation-anion and anion-anion-cation interactions.
-    Vec<PitzerParam> lambda; ///< The parameters \eq{\lambda_{ij}(T, P)} in the Pitzer model for neutral-cation and neutral-anion interactions.
-    Vec<PitzerParam> zeta;   ///< The parameters \eq{\zeta_{ijk}(T, P)} in the Pitzer model for neutral-cation-anion interactions.
-    Vec<PitzerParam> mu;     ///< The parameters \eq{\mu_{ijk}(T, P)} in the Pitzer model for neutral-neutral-neutral, neutral-neutral-cation, and neutral-neutral-anion interactions.
-    Vec<PitzerParam> eta;    ///< The parameters \eq{\eta_{ijk}(T, P)} in the Pitzer model for neutral-cation-cation and neutral-anion-anion interactions.
+    Vec<Fn<real(real const&, real const&)>> models; ///< The temperature-pressure correction models of all interaction parameters.
+
+    ArrayXr values; ///< The current values of all interaction parameters since last update.
 
-    Vec<real> alpha1; ///< The parameters \eq{alpha_1_{ij}} associated to the parameters \eq{\beta^{(1)}_{ij}}.
-    Vec<real> alpha2; ///< The parameters \eq{alpha_2_{ij}} associated to the parameters \eq{\beta^{(1)}_{ij}}.
+    PitzerTable binary{3};  ///< The compiled \eq{\beta^{(0)}_{ij}}, \eq{\theta_{ij}} and \eq{\lambda_{ij}} interactions with coefficients for \eq{\ln\gamma_i}, \eq{\ln\gamma_j} and the osmotic coefficient.
+    PitzerTable ternary{4}; ///< The compiled \eq{\psi_{ijk}}, \eq{\zeta_{ijk}}, \eq{\mu_{ijk}} and \eq{\eta_{ijk}} interactions with coefficients for \eq{\ln\gamma_i}, \eq{\ln\gamma_j}, \eq{\ln\gamma_k} and the osmotic coefficient.
+    PitzerTable betaG{1};   ///< The compiled \eq{\beta^{(1)}_{ij}} and \eq{\beta^{(2)}_{ij}} interactions grouped by their associated alpha values.
+    PitzerTable cphi{1};    ///< The compiled \eq{C^{\phi}_{ij}} interactions already divided by \eq{2\sqrt{|z_iz_j|}}.
 
-    using Tuples2i = Tuples<Index, Index>;                   ///< Auxiliary type for a tuple of 2 index values.
-    using Tuples3d = Tuples<double, double, double>;         ///< Auxiliary type for a tuple of 3 double values.
-    using Tuples4d = Tuples<double, double, double, double>; ///< Auxiliary type for a tuple of 4 double values.
+    Vec<real> alphas; ///< The unique values of the parameters \eq{\alpha_1} and \eq{\alpha_2} associated to the parameters \eq{\beta^{(1)}_{ij}} and \eq{\beta^{(2)}_{ij}}.
+    ArrayXr galpha;   ///< The current values of \eq{g(\alpha\sqrt{I})} for each unique alpha value.
+    ArrayXr gpalpha;  ///< The current values of \eq{g^\prime(\alpha\sqrt{I})/I} for each unique alpha value.
+    ArrayXr ealpha;   ///< The current values of \eq{e^{-\alpha\sqrt{I}}} for each unique alpha value.
 
-    Tuples3d lambda_coeffs; ///< The coefficients multiplying the terms where the lambda Pitzer parameter is involved.
-    Tuples4d mu_coeffs;     ///< The coefficients multiplying the terms where the mu Pitzer parameter is involved.
+    Tuples<Index, Index, Index> thetaij;   ///< The indices (i, j) of the cation-cation and anion-anion species pairs with different charges and the index of their charge pair in `thetacharges`, used to account for \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)} contributions.
+    Vec<Pair<double, double>> thetacharges; ///< The unique pairs of charges (zi, zj) among the species pairs in `thetaij`.
+    ArrayXr thetaE;   ///< The current values of the parameters \eq{^{E}\theta_{ij}(I)} for each unique pair of charges.
+    ArrayXr thetaEP;  ///< The current values of the parameters \eq{^{E}\theta_{ij}^{\prime}(I)} for each unique pair of charges.
 
-    Tuples2i thetaij; ///< The indices (i, j) of the cation-cation and anion-anion species pairs used to account for \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)} contributions.
-    ArrayXr thetaE;   ///< The current values of the parameters \eq{^{E}\theta_{ij}(I)} associated to the \eq{\theta_{ij}} parameters.
-    ArrayXr thetaEP;  ///< The current values of the parameters \eq{^{E}\theta_{ij}^{\prime}(I)} associated to the \eq{\theta_{ij}} parameters.
+    real Tlast; ///< The temperature used in the last update of the interaction parameters.
+    real Plast; ///< The pressure used in the last update of the interaction parameters.
+    bool updated = false; ///< The indication whether the interaction parameters have been updated at least once.
 
     Fn<real(real const&, real const&)> Aphi; ///< The function that computes the Debye-huckel parameter \eq{A^\phi(T, P)} in the Pitzer model.
 
@@ -672,83 +747,125 @@ struct PitzerModel
     {}
 
     /// Construct a Pitzer object with given list of species in the aqueous solution and the parameters for the Pitzer activity model.
-    // PitzerModel(SpeciesList const& specieslist, ActivityModelParamsPitzer const& params)
     PitzerModel(AqueousMixture const& solution, ActivityModelParamsPitzer const& params)
     : solution(solution)
     {
-        for(auto const& entry : params.beta0)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta0.push_back(param);
+        auto const& specieslist = solution.species();
+        auto const& z = solution.charges();
 
-        for(auto const& entry : params.beta1)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta1.push_back(param);
+        // Register the temperature-pressure correction model of an interaction parameter and return its index
+        auto addparam = [&](PitzerParam const& param) -> Index
+        {
+            models.push_back(param.model);
+            return models.size() - 1;
+        };
 
-        for(auto const& entry : params.beta2)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta2.push_back(param);
+        // Return the index of an alpha value in `alphas`, registering it if not there yet
+        auto addalpha = [&](real const& alpha) -> Index
+        {
+            auto const idx = indexfn(alphas, RKT_LAMBDA(x, x == alpha));
+            if(idx < alphas.size())
+                return idx;
+            alphas.push_back(alpha);
+            return alphas.size() - 1;
+        };
 
-        for(auto const& entry : params.Cphi)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                Cphi.push_back(param);
+        for(auto const& entry : params.beta0)
+            if(PitzerParam param = createPitzerParamBinary(specieslist, entry); !param.ispecies.empty())
+                binary.add(param.ispecies, addparam(param), { 2.0, 2.0, 1.0 });
 
         for(auto const& entry : params.theta)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                theta.push_back(param);
-
-        for(auto const& entry : params.psi)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                psi.push_back(param);
+            if(PitzerParam param = createPitzerParamBinary(specieslist, entry); !param.ispecies.empty())
+                binary.add(param.ispecies, addparam(param), { 2.0, 2.0, 1.0 });
 
         for(auto const& entry : params.lambda)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                lambda.push_back(param);
+        {
+            if(PitzerParam param = createPitzerParamBinary(specieslist, entry); !param.ispecies.empty())
+            {
+                auto const i1 = param.ispecies[0];
+                auto const i2 = param.ispecies[1];
+                auto const [clng0, clng1, cosm] = determineLambdaCoeffs(z[i1], z[i2], i1, i2);
+                binary.add(param.ispecies, addparam(param), { clng0, clng1, cosm });
+            }
+        }
+
+        for(auto const& entry : params.psi)
+            if(PitzerParam param = createPitzerParamTernary(specieslist, entry); !param.ispecies.empty())
+                ternary.add(param.ispecies, addparam(param), { 1.0, 1.0, 1.0, 1.0 });
 
         for(auto const& entry : params.zeta)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                zeta.push_back(param);
+            if(PitzerParam param = createPitzerParamTernary(specieslist, entry); !param.ispecies.empty())
+                ternary.add(param.ispecies, addparam(param), { 1.0, 1.0, 1.0, 1.0 });
 
         for(auto const& entry : params.mu)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                mu.push_back(param);
+        {
+            if(PitzerParam param = createPitzerParamTernary(specieslist, entry); !param.ispecies.empty())
+            {
+                auto const i1 = param.ispecies[0];
+                auto const i2 = param.ispecies[1];
+                auto const i3 = param.ispecies[2];
+                auto const [clng0, clng1, clng2, cosm] = determineMuCoeffs(z[i1], z[i2], z[i3], i1, i2, i3);
+                ternary.add(param.ispecies, addparam(param), { clng0, clng1, clng2, cosm });
+            }
+        }
 
         for(auto const& entry : params.eta)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                eta.push_back(param);
+            if(PitzerParam param = createPitzerParamTernary(specieslist, entry); !param.ispecies.empty())
+                ternary.add(param.ispecies, addparam(param), { 1.0, 1.0, 1.0, 1.0 });
+
+        // Note: the i-th beta1 (beta2) parameter kept for the species in the solution is paired with the alpha1 (alpha2) value of the i-th entry in params.beta1 (params.beta2).
+        auto const alpha1 = vectorize(params.beta1, RKT_LAMBDA(entry, determineAlpha1(entry.formulas[0], entry.formulas[1], params.alpha1)));
+        auto const alpha2 = vectorize(params.beta2, RKT_LAMBDA(entry, determineAlpha2(entry.formulas[0], entry.formulas[1], params.alpha2)));
 
+        Index ibeta1 = 0;
         for(auto const& entry : params.beta1)
-            alpha1.push_back(determineAlpha1(entry.formulas[0], entry.formulas[1], params.alpha1));
+            if(PitzerParam param = createPitzerParamBinary(specieslist, entry); !param.ispecies.empty())
+                betaG.add(param.ispecies, addparam(param), { 1.0 }, addalpha(alpha1[ibeta1++]));
 
+        Index ibeta2 = 0;
         for(auto const& entry : params.beta2)
-            alpha2.push_back(determineAlpha2(entry.formulas[0], entry.formulas[1], params.alpha2));
+            if(PitzerParam param = createPitzerParamBinary(specieslist, entry); !param.ispecies.empty())
+                betaG.add(param.ispecies, addparam(param), { 1.0 }, addalpha(alpha2[ibeta2++]));
 
-        auto const& ications = solution.indicesCations();
-        auto const& ianions = solution.indicesAnions();
-
-        for(auto i = 0; i < ications.size() - 1; ++i)
-            for(auto j = i + 1; j < ications.size(); ++j)
-                thetaij.emplace_back(ications[i], ications[j]);
-
-        for(auto i = 0; i < ianions.size() - 1; ++i)
-            for(auto j = i + 1; j < ianions.size(); ++j)
-                thetaij.emplace_back(ianions[i], ianions[j]);
-
-        auto const& z = solution.charges();
-
-        for(auto const& entry : lambda)
+        for(auto const& entry : params.Cphi)
         {
-            auto const i1 = entry.ispecies[0];
-            auto const i2 = entry.ispecies[1];
-            lambda_coeffs.push_back(determineLambdaCoeffs(z[i1], z[i2], i1, i2));
+            if(PitzerParam param = createPitzerParamBinary(specieslist, entry); !param.ispecies.empty())
+            {
+                auto const aux = 2.0 * sqrt(abs(z[param.ispecies[0]] * z[param.ispecies[1]]));
+                cphi.add(param.ispecies, addparam(param), { 1.0/aux });
+            }
         }
 
-        for(auto const& entry : mu)
+        values.resize(models.size());
+        galpha.resize(alphas.size());
+        gpalpha.resize(alphas.size());
+        ealpha.resize(alphas.size());
+
+        // Collect the cation-cation and anion-anion pairs with unsymmetrical mixing effects (pairs with equal charges have zero ^Eθ and ^Eθ' contributions)
+        auto addthetaij = [&](Indices const& iions)
         {
-            auto const i1 = entry.ispecies[0];
-            auto const i2 = entry.ispecies[1];
-            auto const i3 = entry.ispecies[2];
-            mu_coeffs.push_back(determineMuCoeffs(z[i1], z[i2], z[i3], i1, i2, i3));
-        }
+            for(auto i = 0; i < iions.size(); ++i)
+            {
+                for(auto j = i + 1; j < iions.size(); ++j)
+                {
+                    auto const i0 = iions[i];
+                    auto const i1 = iions[j];
+                    if(z[i0] == z[i1])
+                        continue;
+                    auto const charges = Pair<double, double>{ z[i0], z[i1] };
+                    auto idx = index(thetacharges, charges);
+                    if(idx == thetacharges.size())
+                        thetacharges.push_back(charges);
+                    thetaij.emplace_back(i0, i1, idx);
+                }
+            }
+        };
+
+        addthetaij(solution.indicesCations());
+        addthetaij(solution.indicesAnions());
+
+        thetaE.resize(thetacharges.size());
+        thetaEP.resize(thetacharges.size());
 
         // Define the function Aphi(T, P) according to PHREEQC (see method calc_dielectrics at utilities.cpp for computing A0)
         Aphi = [](real const& T, real const& P) -> real
@@ -766,40 +883,30 @@ struct PitzerModel
         Aphi = memoizeLast(Aphi); // memoize so that subsequent repeated calls with same (T, P) return cached result.
     }
 
-    /// Update all Pitzer interaction parameters according to current temperature and pressure.
+    /// Update all Pitzer interaction parameters and the coefficients in the compiled tables if temperature or pressure have changed.
     auto updateParams(real const& T, real const& P)
     {
-        auto const Pbar = P * 1e-5; // from Pa to bar
-
-        for(auto& param : beta0)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : beta1)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : beta2)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : Cphi)
-            param.value = param.model(T, Pbar);
+        // Compare also the derivatives of temperature and pressure, which are seeded when computing derivatives of the activity model with respect to them
+        auto const unchanged = updated &&
+            T.val() == Tlast.val() && grad(T) == grad(Tlast) &&
+            P.val() == Plast.val() && grad(P) == grad(Plast);
 
-        for(auto& param : theta)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : psi)
-            param.value = param.model(T, Pbar);
+        if(unchanged)
+            return;
 
-        for(auto& param : lambda)
-            param.value = param.model(T, Pbar);
+        auto const Pbar = P * 1e-5; // from Pa to bar
 
-        for(auto& param : zeta)
-            param.value = param.model(T, Pbar);
+        for(auto i = 0; i < models.size(); ++i)
+            values[i] = models[i](T, Pbar);
 
-        for(auto& param : mu)
-            param.value = param.model(T, Pbar);
+        binary.update(values);
+        ternary.update(values);
+        betaG.update(values);
+        cphi.update(values);
 
-        for(auto& param : eta)
-            param.value = param.model(T, Pbar);
+        Tlast = T;
+        Plast = P;
+        updated = true;
     }
 
     /// Evaluate the Pitzer model and compute the properties of the aqueous solution.
@@ -846,131 +953,75 @@ struct PitzerModel
         // The osmotic coefficient of water in the Pitzer model
         OSMOT = -Aphi0*I*DI/(1 + B*DI);
 
-        for(auto const& param : beta0)
-        {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            LGAMMA[i0] += M[i1] * 2.0 * param.value;
-            LGAMMA[i1] += M[i0] * 2.0 * param.value;
-            OSMOT += M[i0] * M[i1] * param.value;
-        }
-
-        for(auto const& [i, param] : enumerate(beta1))
+        // Compute the functions of alpha*sqrt(I) shared by all beta1 and beta2 interactions with the same alpha value
+        for(auto k = 0; k < alphas.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            F += M[i0] * M[i1] * param.value * GP(alpha1[i] * DI)/I;
-            LGAMMA[i0] += M[i1] * 2.0 * param.value * G(alpha1[i] * DI);
-            LGAMMA[i1] += M[i0] * 2.0 * param.value * G(alpha1[i] * DI);
-            OSMOT += M[i0] * M[i1] * param.value * exp(-alpha1[i] * DI);
+            auto const x = alphas[k] * DI;
+            galpha[k] = G(x);
+            gpalpha[k] = GP(x)/I;
+            ealpha[k] = exp(-x);
         }
 
-        for(auto const& [i, param] : enumerate(beta2))
+        // Compute the unsymmetrical mixing terms shared by all cation-cation and anion-anion pairs with the same charges
+        for(auto k = 0; k < thetacharges.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            F += M[i0] * M[i1] * param.value * GP(alpha2[i] * DI)/I;
-            LGAMMA[i0] += M[i1] * 2.0 * param.value * G(alpha2[i] * DI);
-            LGAMMA[i1] += M[i0] * 2.0 * param.value * G(alpha2[i] * DI);
-            OSMOT += M[i0] * M[i1] * param.value * exp(-alpha2[i] * DI);
+            auto const [zi, zj] = thetacharges[k];
+            std::tie(thetaE[k], thetaEP[k]) = computeThetaValuesInterpolation(I, DI, Aphi0, zi, zj);
         }
 
-        for(auto const& param : Cphi)
+        for(auto k = 0; k < binary.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            auto const aux = 2.0 * sqrt(abs(z[i0] * z[i1]));
+            auto const i0 = binary.i0[k];
+            auto const i1 = binary.i1[k];
 
-            CSUM += M[i0] * M[i1] * param.value/aux;
-            LGAMMA[i0] += M[i1] * BIGZ * param.value/aux;
-            LGAMMA[i1] += M[i0] * BIGZ * param.value/aux;
-            OSMOT += M[i0] * M[i1] * BIGZ * param.value/aux;
+            LGAMMA[i0] += M[i1] * binary.coeffs[0][k];
+            LGAMMA[i1] += M[i0] * binary.coeffs[1][k];
+            OSMOT += M[i0] * M[i1] * binary.coeffs[2][k];
         }
 
-        for(auto const& param : theta)
+        for(auto k = 0; k < betaG.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            LGAMMA[i0] += 2.0 * M[i1] * param.value;
-            LGAMMA[i1] += 2.0 * M[i0] * param.value;
-            OSMOT += M[i0] * M[i1] * param.value;
+            auto const i0 = betaG.i0[k];
+            auto const i1 = betaG.i1[k];
+            auto const ia = betaG.ialpha[k];
+            auto const& value = betaG.coeffs[0][k];
+
+            F += M[i0] * M[i1] * value * gpalpha[ia];
+            LGAMMA[i0] += M[i1] * 2.0 * value * galpha[ia];
+            LGAMMA[i1] += M[i0] * 2.0 * value * galpha[ia];
+            OSMOT += M[i0] * M[i1] * value * ealpha[ia];
         }
 
-        for(auto const& [i0, i1] : thetaij)
+        for(auto k = 0; k < cphi.size(); ++k)
         {
-            auto const [etheta, ethetap] = computeThetaValuesInterpolation(I, DI, Aphi0, z[i0], z[i1]);
-
-            F += M[i0] * M[i1] * ethetap;
-            LGAMMA[i0] += 2.0 * M[i1] * etheta;
-            LGAMMA[i1] += 2.0 * M[i0] * etheta;
-            OSMOT += M[i0] * M[i1] * (etheta + I*ethetap);
+            auto const i0 = cphi.i0[k];
+            auto const i1 = cphi.i1[k];
+            auto const& value = cphi.coeffs[0][k];
+
+            CSUM += M[i0] * M[i1] * value;
+            LGAMMA[i0] += M[i1] * BIGZ * value;
+            LGAMMA[i1] += M[i0] * BIGZ * value;
+            OSMOT += M[i0] * M[i1] * BIGZ * value;
         }
 
-        for(auto const& param : psi)
+        for(auto const& [i0, i1, k] : thetaij)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
+            F += M[i0] * M[i1] * thetaEP[k];
+            LGAMMA[i0] += 2.0 * M[i1] * thetaE[k];
+            LGAMMA[i1] += 2.0 * M[i0] * thetaE[k];
+            OSMOT += M[i0] * M[i1] * (thetaE[k] + I*thetaEP[k]);
         }
 
-        for(auto const& [i, param] : enumerate(lambda))
+        for(auto k = 0; k < ternary.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            auto const [clng0, clng1, cosm] = lambda_coeffs[i];
-
-            LGAMMA[i0] += M[i1] * param.value * clng0;
-            LGAMMA[i1] += M[i0] * param.value * clng1;
-            OSMOT += M[i0] * M[i1] * param.value * cosm;
-        }
-
-        for(auto const& param : zeta)
-        {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
-        }
-
-        for(auto const& [i, param] : enumerate(mu))
-        {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            auto const [clng0, clng1, clng2, cosm] = mu_coeffs[i];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value * clng0;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value * clng1;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value * clng2;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value * cosm;
-        }
-
-        for(auto const& param : eta)
-        {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
+            auto const i0 = ternary.i0[k];
+            auto const i1 = ternary.i1[k];
+            auto const i2 = ternary.i2[k];
+
+            LGAMMA[i0] += M[i1] * M[i2] * ternary.coeffs[0][k];
+            LGAMMA[i1] += M[i0] * M[i2] * ternary.coeffs[1][k];
+            LGAMMA[i2] += M[i0] * M[i1] * ternary.coeffs[2][k];
+            OSMOT += M[i0] * M[i1] * M[i2] * ternary.coeffs[3][k];
         }
 
         // Finalise the calculation of the activity coefficient by adding the missing F and CSUM contributions
@@ -1001,24 +1052,30 @@ auto createActivityModelPitzer(SpeciesList const& species, ActivityModelParamsPi
     // The PitzerState object that holds computed properties of the aqueous solution by the Pitzer model
     PitzerState pzstate;
 
-    // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto aqstateptr = std::make_shared<AqueousMixtureState>();
+    // Shared pointers to the objects exported via `props.extra` (one aqueous mixture state per thread)
+    ThreadLocal<SharedPtr<AqueousMixtureState>> aqstateptrs([] { return std::make_shared<AqueousMixtureState>(); });
     auto aqsolutionptr = std::make_shared<AqueousMixture>(solution);
 
+    // The slots in `props.extra` used to export the aqueous mixture and its state
+    const auto stateslot = aqueousMixtureStateSlot();
+    const auto mixtureslot = aqueousMixtureSlot();
+
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
     {
         // The arguments for the activity model evaluation
         auto const& [T, P, x] = args;
 
         // Evaluate the state of the aqueous solution
-        auto const& aqstate = *aqstateptr = solution.state(T, P, x);
+        auto const& aqstateptr = aqstateptrs.local();
+        solution.state(T, P, x, *aqstateptr);
+        auto const& aqstate = *aqstateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous solution and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = aqstateptr;
-        props.extra["AqueousMixture"] = aqsolutionptr;
+        props.extra.set(stateslot, aqstateptr);
+        props.extra.set(mixtureslot, aqsolutionptr);
 
         // Evaluate the Pitzer activity model with given aqueous state
         pzmodel.evaluate(aqstate, pzstate);
@@ -19,6 +19,7 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/AutoDiff.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcDatabase.hpp>
 #include <Reaktoro/Models/ActivityModels/ActivityModelPitzer.hpp>
@@ -792,4 +793,67 @@ TEST_CASE("Testing ActivityModelPitzer", "[ActivityModelPitzer]")
         CHECK( props.ln_g[31]/ln10 == Approx( 0.239383000) ); // H4SiO4 (PHREEQC:  0.23937, difference: 5.43e-03 %)
         CHECK( props.ln_g[32]/ln10 == Approx(-1.906930000) ); // Sr+2 (PHREEQC: -1.90518, difference: 9.19e-02 %)
     }
+
+    WHEN("the activity model is evaluated repeatedly at different temperatures")
+    {
+        const auto species = SpeciesList("OH- H+ H2O Cl- Na+ Ca+2 Mg+2 SO4-2 HCO3- CO3-2 CO2");
+
+        const auto P = 1.0e+5;
+
+        const auto n = ArrayXr{{
+            1.0e-07, // OH-
+            1.0e-07, // H+
+            55.5062, // H2O
+            2.50000, // Cl-
+            2.00000, // Na+
+            0.10000, // Ca+2
+            0.20000, // Mg+2
+            0.15000, // SO4-2
+            0.01000, // HCO3-
+            0.00100, // CO3-2
+            0.01000, // CO2
+        }};
+
+        const auto x = n / n.sum();
+
+        const auto numspecies = species.size();
+
+        // The activity model whose compiled interaction parameters are updated with every change in temperature
+        ActivityModel fn = ActivityModelPitzer()(species);
+
+        ActivityProps props = ActivityProps::create(numspecies);
+        ActivityProps expected = ActivityProps::create(numspecies);
+
+        for(auto T : { 298.15, 348.15, 298.15, 398.15 })
+        {
+            fn(props, {T, P, x});
+
+            ActivityModel fresh = ActivityModelPitzer()(species);
+            fresh(expected, {T, P, x});
+
+            INFO("T = " << T);
+            for(auto i = 0; i < numspecies; ++i)
+                CHECK( props.ln_g[i] == Approx(expected.ln_g[i].val()) );
+        }
+
+        // Check the derivatives with respect to temperature after an evaluation at the same temperature without seeding
+        real T = 323.15;
+
+        fn(props, {T, P, x});
+
+        autodiff::seed(T);
+        fn(props, {T, P, x});
+        autodiff::unseed(T);
+
+        const auto h = 1.0e-4;
+
+        fn(expected, {T + h, P, x});
+        const ArrayXd ln_g_forward = expected.ln_g.cast<double>();
+
+        fn(expected, {T - h, P, x});
+        const ArrayXd ln_g_backward = expected.ln_g.cast<double>();
+
+        for(auto i = 0; i < numspecies; ++i)
+            CHECK( grad(props.ln_g[i]) == Approx((ln_g_forward[i] - ln_g_backward[i])/(2*h)).epsilon(1e-3).margin(1e-8) );
+    }
 }
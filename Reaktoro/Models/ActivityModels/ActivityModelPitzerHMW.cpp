@@ -29,6 +29,7 @@
 #include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Common/Real.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
+#include <Reaktoro/Common/ThreadLocal.hpp>
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
@@ -1390,24 +1391,30 @@ auto activityModelPitzerHMW(const SpeciesList& species) -> ActivityModel
     // Initialize the Pitzer params
     PitzerParams pitzer(mixture);
 
-    // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    // Shared pointers to the objects exported via `props.extra` (one aqueous mixture state per thread)
+    ThreadLocal<SharedPtr<AqueousMixtureState>> stateptrs([] { return std::make_shared<AqueousMixtureState>(); });
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
+    // The slots in `props.extra` used to export the aqueous mixture and its state
+    const auto stateslot = aqueousMixtureStateSlot();
+    const auto mixtureslot = aqueousMixtureSlot();
+
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
     {
         // The arguments for the activity model evaluation
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
-        auto const& state = *stateptr = mixture.state(T, P, x);
+        auto const& stateptr = stateptrs.local();
+        mixture.state(T, P, x, *stateptr);
+        auto const& state = *stateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous mixture and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = stateptr;
-        props.extra["AqueousMixture"] = mixtureptr;
+        props.extra.set(stateslot, stateptr);
+        props.extra.set(mixtureslot, mixtureptr);
 
         // Calculate the activity coefficients of the cations
         for(auto M = 0; M < pitzer.idx_cations.size(); ++M)
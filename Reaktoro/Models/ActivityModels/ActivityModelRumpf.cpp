@@ -39,18 +39,22 @@ auto ActivityModelRumpf(String gas) -> ActivityModelGenerator
         const auto iMg  = aqmix.charged().findWithFormula("Mg++");
         const auto iCl  = aqmix.charged().findWithFormula("Cl-");
 
+        // The slots in `props.extra` with the aqueous mixture and its state exported by a base aqueous activity model
+        const auto stateslot = aqueousMixtureStateSlot();
+        const auto mixtureslot = aqueousMixtureSlot();
+
         ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
         {
             // Check AqueousMixture and AqueousMixtureState are available in props.extra
-            auto mixtureit = props.extra.find("AqueousMixture");
-            auto stateit = props.extra.find("AqueousMixtureState");
+            auto mixtureptr = props.extra.get(mixtureslot);
+            auto stateptr = props.extra.get(stateslot);
 
-            errorif(stateit == props.extra.end(),
+            errorif(stateptr == nullptr || mixtureptr == nullptr,
                 "ActivityModelRumpf expects that another aqueous activity model has been chained first (e.g., Davies, Debye-Huckel, HKF, PitzerHMW, etc.) ");
 
             // The aqueous mixture and its state exported by a base aqueous activity model.
-            const auto& mixture = *std::any_cast<SharedPtr<AqueousMixture> const&>(mixtureit->second);
-            const auto& state = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(stateit->second);
+            const auto& mixture = *mixtureptr;
+            const auto& state = *stateptr;
 
             // The number of charged species
             const auto nions = mixture.charged().size();
@@ -32,16 +32,19 @@ auto ActivityModelSetschenow(String neutral, real b) -> ActivityModelGenerator
         // The index of the neutral aqueous species in the aqueous phase.
         const auto ineutral = species.indexWithFormula(neutral);
 
+        // The slot in `props.extra` with the aqueous mixture state exported by a base aqueous activity model
+        const auto stateslot = aqueousMixtureStateSlot();
+
         ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
         {
             // Check AqueousMixtureState is available in props.extra
-            auto stateit = props.extra.find("AqueousMixtureState");
+            auto stateptr = props.extra.get(stateslot);
 
-            errorif(stateit == props.extra.end(),
+            errorif(stateptr == nullptr,
                 "ActivityModelSetschenow expects that another aqueous activity model has been chained first (e.g., Davies, Debye-Huckel, HKF, PitzerHMW, etc.) ");
 
             // The aqueous mixture state exported by a base aqueous activity model.
-            const auto& state = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(stateit->second);
+            const auto& state = *stateptr;
 
             const auto& I = state.Is;
             props.ln_g[ineutral] = ln10 * b * I;
@@ -19,9 +19,13 @@
 
 // C++ includes
 #include <algorithm>
+#include <utility>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/AutoDiff.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
+#include <Reaktoro/Common/ThreadLocal.hpp>
 #include <Reaktoro/Singletons/DissociationReactions.hpp>
 #include <Reaktoro/Water/WaterElectroProps.hpp>
 #include <Reaktoro/Water/WaterElectroPropsJohnsonNorton.hpp>
@@ -84,15 +88,35 @@ struct AqueousMixture::Impl
     /// The electric charges of the aqueous species in the mixture.
     ArrayXd z;
 
+    /// The squared electric charges of the aqueous species in the mixture.
+    ArrayXd z2;
+
+    /// The squared electric charges of the charged species in the mixture.
+    ArrayXd zc2;
+
     /// The matrix that represents the dissociation of the aqueous complexes into ions.
     MatrixXd dissociation_matrix;
 
+    /// The non-zero entries (i, j, coefficient) of the dissociation matrix, with i for neutral species and j for charged species.
+    Tuples<Index, Index, double> dissociation_entries;
+
     /// The density function for water.
     Fn<real(real,real)> rho;
 
     /// The dielectric constant function for water.
     Fn<real(real,real)> epsilon;
 
+    /// The density and dielectric constant of water computed in the last call to state.
+    struct Memo
+    {
+        real T, P;
+        real rho, epsilon;
+        bool firsttime = true;
+    };
+
+    /// The last computed density and dielectric constant of water in each thread.
+    ThreadLocal<Memo> memos;
+
     /// Construct a default AqueousMixture::Impl instance.
     Impl()
     {}
@@ -157,6 +181,8 @@ struct AqueousMixture::Impl
     {
         const auto charges = vectorize(species, RKT_LAMBDA(x, x.charge()));
         z = ArrayXd::Map(charges.data(), charges.size());
+        z2 = z * z;
+        zc2 = z2(idx_charged_species);
     }
 
     /// Initialize the dissociation matrix of the neutral species w.r.t. the charged species.
@@ -179,59 +205,80 @@ struct AqueousMixture::Impl
         for(auto i = 0; i < num_neutral_species; ++i)
             for(auto j = 0; j < num_charged_species; ++j)
                 dissociation_matrix(i, j) = stoichiometry(i, j);
+
+        // Collect the non-zero entries of the dissociation matrix, which is very sparse in general
+        for(auto i = 0; i < num_neutral_species; ++i)
+            for(auto j = 0; j < num_charged_species; ++j)
+                if(dissociation_matrix(i, j) != 0.0)
+                    dissociation_entries.push_back({ i, j, dissociation_matrix(i, j) });
     }
 
-    /// Return the molalities of the aqueous species with given mole fractions.
-    auto molalities(ArrayXrConstRef x) const -> ArrayXr
+    /// Update the molalities of the aqueous species with given mole fractions.
+    auto updateMolalities(ArrayXrConstRef x, ArrayXr& m) const -> void
     {
         const auto xw = x[idx_water];
         const auto Mw = water.molarMass();
         if(xw == 0.0)
-            return ArrayXr::Zero(x.size());
-        return x/(Mw * xw);
+            m.setZero(x.size());
+        else m = x/(Mw * xw);
     }
 
-    /// Return the stoichiometric molalities of the charged species with given molalities.
-    auto stoichiometricMolalities(ArrayXrConstRef m) const -> ArrayXr
+    /// Update the stoichiometric molalities of the charged species with given molalities.
+    auto updateStoichiometricMolalities(ArrayXrConstRef m, ArrayXr& ms) const -> void
     {
         // The molalities of the charged species
-        const auto mc = m(idx_charged_species).matrix(); // convert from array to matrix expression
-
-        // The molalities of the neutral species
-        const auto mn = m(idx_neutral_species).matrix(); // convert from array to matrix expression
-
-        // The stoichiometric molalities of the charged species
-        const auto ms = mc + dissociation_matrix.transpose() * mn;
+        ms = m(idx_charged_species);
 
-        return ms;
+        // The contributions of the neutral species that dissociate into the charged species
+        for(auto const& [i, j, coeff] : dissociation_entries)
+            ms[j] += coeff * m[idx_neutral_species[i]];
     }
 
     /// Return the effective ionic strength of the aqueous mixture with given molalities.
     auto effectiveIonicStrength(ArrayXrConstRef m) const -> real
     {
-        return 0.5 * (z * z * m).sum();
+        return 0.5 * (z2 * m).sum();
     }
 
     /// Return the stoichiometric ionic strength of the aqueous mixture with given stoichiometric molalities of the charged species.
     auto stoichiometricIonicStrength(ArrayXrConstRef ms) const -> real
     {
-        const auto zc = z(idx_charged_species);
-        return 0.5 * (zc * zc * ms).sum();
+        return 0.5 * (zc2 * ms).sum();
+    }
+
+    /// Update the density and dielectric constant of water in a given state if temperature or pressure have changed since the last call.
+    auto updateWaterProps(real const& T, real const& P, AqueousMixtureState& state) const -> void
+    {
+        auto& memo = memos.local();
+
+        // Compare also the derivatives of temperature and pressure, which are seeded when computing derivatives of the activity models with respect to them
+        const auto memoized = !Memoization::isDisabled() && !memo.firsttime &&
+            T.val() == memo.T.val() && grad(T) == grad(memo.T) &&
+            P.val() == memo.P.val() && grad(P) == grad(memo.P);
+
+        if(!memoized)
+        {
+            memo.T = T;
+            memo.P = P;
+            memo.rho = rho(T, P);
+            memo.epsilon = epsilon(T, P);
+            memo.firsttime = false;
+        }
+
+        state.rho = memo.rho;
+        state.epsilon = memo.epsilon;
     }
 
-    /// Return the state of the aqueous mixture.
-    auto state(real T, real P, ArrayXrConstRef x) const -> AqueousMixtureState
+    /// Update the state of the aqueous mixture, reusing the arrays in the given state.
+    auto state(real const& T, real const& P, ArrayXrConstRef x, AqueousMixtureState& state) const -> void
     {
-        AqueousMixtureState state;
         state.T = T;
         state.P = P;
-        state.rho = rho(T, P);
-        state.epsilon = epsilon(T, P);
-        state.m  = molalities(x);
-        state.ms = stoichiometricMolalities(state.m);
+        updateWaterProps(T, P, state);
+        updateMolalities(x, state.m);
+        updateStoichiometricMolalities(state.m, state.ms);
         state.Ie = effectiveIonicStrength(state.m);
         state.Is = stoichiometricIonicStrength(state.ms);
-        return state;
     }
 };
 
@@ -247,6 +294,7 @@ auto AqueousMixture::clone() const -> AqueousMixture
 {
     AqueousMixture copy;
     *copy.pimpl = *pimpl;
+    copy.pimpl->memos = {}; // do not share the memoized water properties with this object, since copy may change the water property functions
     return copy;
 }
 
@@ -266,7 +314,7 @@ auto AqueousMixture::withWaterDielectricConstantFn(Fn<real(real,real)> epsilon)
 
 auto AqueousMixture::species(Index idx) const -> Species const&
 {
-    return pimpl->species[idx];
+    return std::as_const(pimpl->species)[idx];
 }
 
 auto AqueousMixture::species() const -> SpeciesList const&
@@ -336,7 +384,26 @@ auto AqueousMixture::charges() const -> ArrayXdConstRef
 
 auto AqueousMixture::state(real T, real P, ArrayXrConstRef x) const -> AqueousMixtureState
 {
-    return pimpl->state(T, P, x);
+    AqueousMixtureState res;
+    pimpl->state(T, P, x, res);
+    return res;
+}
+
+auto AqueousMixture::state(real T, real P, ArrayXrConstRef x, AqueousMixtureState& res) const -> void
+{
+    pimpl->state(T, P, x, res);
+}
+
+auto aqueousMixtureStateSlot() -> ActivityExtraSlot<AqueousMixtureState> const&
+{
+    static const ActivityExtraSlot<AqueousMixtureState> slot("AqueousMixtureState");
+    return slot;
+}
+
+auto aqueousMixtureSlot() -> ActivityExtraSlot<AqueousMixture> const&
+{
+    static const ActivityExtraSlot<AqueousMixture> slot("AqueousMixture");
+    return slot;
 }
 
 } // namespace Reaktoro
@@ -20,6 +20,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Types.hpp>
+#include <Reaktoro/Core/ActivityExtra.hpp>
 #include <Reaktoro/Core/SpeciesList.hpp>
 
 namespace Reaktoro {
@@ -133,10 +134,27 @@ public:
     /// @param x The mole fractions of the species in the mixture
     auto state(real T, real P, ArrayXrConstRef x) const -> AqueousMixtureState;
 
+    /// Calculate the state of the aqueous mixture in a given AqueousMixtureState object.
+    /// The arrays in @p res are reused if they already have the right sizes, so that
+    /// repeated calls with the same object do not allocate heap memory. The density
+    /// and dielectric constant of water are only recomputed when temperature or
+    /// pressure change.
+    /// @param T The temperature (in K)
+    /// @param P The pressure (in Pa)
+    /// @param x The mole fractions of the species in the mixture
+    /// @param[out] res The state of the aqueous mixture
+    auto state(real T, real P, ArrayXrConstRef x, AqueousMixtureState& res) const -> void;
+
 private:
     struct Impl;
 
     SharedPtr<Impl> pimpl;
 };
 
+/// Return the ActivityExtra slot in which aqueous activity models export the state of the aqueous mixture.
+auto aqueousMixtureStateSlot() -> ActivityExtraSlot<AqueousMixtureState> const&;
+
+/// Return the ActivityExtra slot in which aqueous activity models export the aqueous mixture.
+auto aqueousMixtureSlot() -> ActivityExtraSlot<AqueousMixture> const&;
+
 } // namespace Reaktoro
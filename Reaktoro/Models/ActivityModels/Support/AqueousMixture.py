@@ -23,3 +23,11 @@ import pytest
 # TODO Implement tests for the python bindings of component AqueousMixture in AqueousMixture[test].py
 def testAqueousMixture():
     pass
+
+
+def testActivityExtraAqueousMixtureSlots():
+    extra = ActivityExtra()
+
+    # Nothing has been exported by an aqueous activity model yet
+    assert extra.aqueousMixtureState is None
+    assert extra.aqueousMixture is None
@@ -55,6 +55,13 @@ void exportAqueousMixture(py::module& m)
         .def("indexWater", &AqueousMixture::indexWater, "Return the index of the solvent species in the mixture.")
         .def("charges", &AqueousMixture::charges, "Return the electric charges of the aqueous species in the mixture.")
         .def("dissociationMatrix", &AqueousMixture::dissociationMatrix, "Return the dissociation matrix of the neutral species into charged species.")
-        .def("state", &AqueousMixture::state, "Calculate the state of the aqueous mixture.")
+        .def("state", py::overload_cast<real, real, ArrayXrConstRef>(&AqueousMixture::state, py::const_), "Calculate the state of the aqueous mixture.")
+        .def("state", py::overload_cast<real, real, ArrayXrConstRef, AqueousMixtureState&>(&AqueousMixture::state, py::const_), "Calculate the state of the aqueous mixture in a given AqueousMixtureState object.")
+        ;
+
+    // Extend the ActivityExtra class (exported in Core before Models) with typed accessors to the slots of aqueous activity models
+    py::reinterpret_borrow<py::class_<ActivityExtra>>(m.attr("ActivityExtra"))
+        .def_property_readonly("aqueousMixtureState", [](ActivityExtra const& self) { return self.get(aqueousMixtureStateSlot()); }, py::return_value_policy::copy, "The state of the aqueous mixture exported by an aqueous activity model (or None if not set).")
+        .def_property_readonly("aqueousMixture", [](ActivityExtra const& self) { return self.get(aqueousMixtureSlot()); }, py::return_value_policy::copy, "The aqueous mixture exported by an aqueous activity model (or None if not set).")
         ;
 }
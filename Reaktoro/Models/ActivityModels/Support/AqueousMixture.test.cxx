@@ -19,6 +19,7 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/AutoDiff.hpp>
 #include <Reaktoro/Singletons/DissociationReactions.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
@@ -121,5 +122,63 @@ TEST_CASE("Testing AqueousMixture class", "[AqueousMixture]")
 
         REQUIRE( state.m.isApprox(m)   );
         REQUIRE( state.ms.isApprox(ms) );
+
+        //-------------------------------------------------------------------------------------
+        // Test AqueousMixture::state method that updates an existing AqueousMixtureState object
+        //-------------------------------------------------------------------------------------
+        AqueousMixtureState other;
+
+        mixture.state(T, P, x, other);
+
+        REQUIRE( other.T       == state.T       );
+        REQUIRE( other.P       == state.P       );
+        REQUIRE( other.Ie      == Approx(Ie)    );
+        REQUIRE( other.Is      == Approx(Is)    );
+        REQUIRE( other.rho     == state.rho     );
+        REQUIRE( other.epsilon == state.epsilon );
+
+        REQUIRE( other.m.isApprox(m)   );
+        REQUIRE( other.ms.isApprox(ms) );
+
+        // The arrays in the state are reused in subsequent updates
+        const auto mptr = other.m.data();
+        const auto msptr = other.ms.data();
+
+        const auto y = moleFractions(species.size());
+
+        mixture.state(T + 10.0, P, y, other);
+
+        REQUIRE( other.m.data() == mptr );
+        REQUIRE( other.ms.data() == msptr );
+        REQUIRE( other.T == T + 10.0 );
+        REQUIRE( other.m.isApprox(mixture.state(T + 10.0, P, y).m) );
+
+        //-------------------------------------------------------------------------------------
+        // Test the water density and dielectric constant are recomputed only when T or P change
+        //-------------------------------------------------------------------------------------
+        auto count = 0;
+
+        const auto mixture2 = mixture.withWaterDensityFn([&](real Tk, real Pk) { ++count; return 1000.0 + Tk - 300.0; });
+
+        mixture2.state(T, P, x, other);
+        mixture2.state(T, P, y, other);
+
+        REQUIRE( count == 1 );
+        REQUIRE( other.rho == Approx(1000.0 + T - 300.0) );
+
+        mixture2.state(T + 1.0, P, y, other);
+
+        REQUIRE( count == 2 );
+        REQUIRE( other.rho == Approx(1000.0 + T + 1.0 - 300.0) );
+
+        // The memoized water density is not reused when the temperature is seeded for derivative calculations
+        real Tr = T + 1.0;
+
+        autodiff::seed(Tr);
+        mixture2.state(Tr, P, y, other);
+        autodiff::unseed(Tr);
+
+        REQUIRE( count == 3 );
+        REQUIRE( grad(other.rho) == Approx(1.0) );
     }
 }
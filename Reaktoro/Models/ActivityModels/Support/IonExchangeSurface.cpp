@@ -17,6 +17,9 @@
 
 #include "IonExchangeSurface.hpp"
 
+// C++ includes
+#include <utility>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
@@ -145,7 +148,7 @@ auto IonExchangeSurface::clone() const -> IonExchangeSurface
 
 auto IonExchangeSurface::species(Index idx) const -> const Species&
 {
-    return pimpl->species[idx];
+    return std::as_const(pimpl->species)[idx];
 }
 
 auto IonExchangeSurface::species() const -> const SpeciesList&
@@ -56,6 +56,8 @@ auto mineralCatalystFnActivity(Catalyst const& catalyst, ReactionRateModelGenera
     auto const name = aqspecies[iaqueousspecies].name();
     auto const ispecies = species.findWithName(name);
 
+    args.dependencies.push_back(args.phases[args.phases.indexWithSpecies(ispecies)].name());
+
     auto fn = [=](ChemicalProps const& props)
     {
         auto const& ai = props.speciesActivity(ispecies);
@@ -84,6 +86,8 @@ auto mineralCatalystFnPartialPressure(Catalyst const& catalyst, ReactionRateMode
     auto const name = gases[igas].name();
     auto const ispecies = species.findWithName(name);
 
+    args.dependencies.push_back(args.phases[args.phases.indexWithSpecies(ispecies)].name());
+
     auto fn = [=](ChemicalProps const& props)
     {
         auto const P  = props.pressure(); // pressure in Pa
@@ -172,6 +176,14 @@ auto ReactionRateModelPalandriKharaka(ReactionRateModelParamsPalandriKharaka con
 {
     ReactionRateModelGenerator model = [=](ReactionRateModelGeneratorArgs args)
     {
+        // The rate depends on the aqueous phase (for the saturation ratio) and on the mineral phase (for the surface area)
+        const auto iaqueousphase = args.phases.findWithAggregateState(AggregateState::Aqueous);
+        const auto imineralphase = args.phases.findWithSpecies(args.name);
+        if(iaqueousphase < args.phases.size())
+            args.dependencies.push_back(args.phases[iaqueousphase].name());
+        if(imineralphase < args.phases.size())
+            args.dependencies.push_back(args.phases[imineralphase].name());
+
         Vec<Fn<real(ChemicalProps const&)>> mechanism_fns;
         for(auto const& mechanism : params.mechanisms)
             mechanism_fns.push_back(detail::mineralMechanismFn(mechanism, args));
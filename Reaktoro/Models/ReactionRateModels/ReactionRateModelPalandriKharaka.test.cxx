@@ -126,4 +126,7 @@ TEST_CASE("Testing ReactionRateModelPalandriKharaka class", "[ReactionRateModelP
     const auto rate_actual = system.reaction(0).rate(props);
 
     CHECK( rate_actual == Approx(rate_expected) );
+
+    // The rate depends on the aqueous and mineral phases, and on the gaseous phase because of the CO2 partial pressure catalyst
+    CHECK( system.reaction(0).rateDependencies() == Strings{ "AqueousPhase", "Calcite", "GaseousPhase" } );
 }
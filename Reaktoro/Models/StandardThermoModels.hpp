@@ -23,6 +23,7 @@
 #include <Reaktoro/Models/StandardThermoModels/ReactionStandardThermoModelPressureCorrection.hpp>
 #include <Reaktoro/Models/StandardThermoModels/ReactionStandardThermoModelVantHoff.hpp>
 #include <Reaktoro/Models/StandardThermoModels/ReactionStandardThermoModelFromData.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelBatch.hpp>
 #include <Reaktoro/Models/StandardThermoModels/StandardThermoModelConstant.hpp>
 #include <Reaktoro/Models/StandardThermoModels/StandardThermoModelExtendedUNIQUAC.hpp>
 #include <Reaktoro/Models/StandardThermoModels/StandardThermoModelHKF.hpp>
@@ -32,6 +33,7 @@
 #include <Reaktoro/Models/StandardThermoModels/StandardThermoModelMineralHKF.hpp>
 #include <Reaktoro/Models/StandardThermoModels/StandardThermoModelNasa.hpp>
 #include <Reaktoro/Models/StandardThermoModels/StandardThermoModelWaterHKF.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelsInterpolated.hpp>
 #include <Reaktoro/Models/StandardThermoModels/StandardThermoModelFromData.hpp>
 #include <Reaktoro/Models/StandardThermoModels/StandardVolumeModelConstant.hpp>
 
@@ -27,6 +27,7 @@ void exportStandardThermoModelMaierKelley(py::module& m);
 void exportStandardThermoModelMineralHKF(py::module& m);
 void exportStandardThermoModelNasa(py::module& m);
 void exportStandardThermoModelWaterHKF(py::module& m);
+void exportStandardThermoModelsInterpolated(py::module& m);
 void exportStandardThermoModelFromData(py::module& m);
 
 void exportReactionStandardThermoModelConstLgK(py::module& m);
@@ -49,6 +50,7 @@ void exportStandardThermoModels(py::module& m)
     exportStandardThermoModelMineralHKF(m);
     exportStandardThermoModelNasa(m);
     exportStandardThermoModelWaterHKF(m);
+    exportStandardThermoModelsInterpolated(m);
     exportStandardThermoModelFromData(m);
 
     exportReactionStandardThermoModelConstLgK(m);
@@ -0,0 +1,774 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "StandardThermoModelBatch.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/AutoDiff.hpp>
+#include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
+#include <Reaktoro/Common/ThreadLocal.hpp>
+#include <Reaktoro/Common/TraitsUtils.hpp>
+#include <Reaktoro/Core/SpeciesList.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelHKF.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelHollandPowell.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelMaierKelley.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelNasa.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/SpeciesElectroPropsHKF.hpp>
+#include <Reaktoro/Water/WaterElectroProps.hpp>
+#include <Reaktoro/Water/WaterElectroPropsJohnsonNorton.hpp>
+#include <Reaktoro/Water/WaterThermoProps.hpp>
+#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
+
+namespace Reaktoro {
+namespace {
+
+using std::abs;
+using std::exp;
+using std::log;
+using std::pow;
+using std::sqrt;
+
+/// Return the value of a real number as a number of type `Scalar` (i.e., `double` or `real`).
+template<typename Scalar>
+auto scalar(real const& x) -> Scalar
+{
+    if constexpr(isSame<Scalar, double>)
+        return x.val();
+    else return x;
+}
+
+/// Return true if a real number carries derivative information.
+auto seeded(real const& x) -> bool
+{
+    return grad(x) != 0.0;
+}
+
+/// Return an array with a given member of each parameters object in a list.
+template<typename Scalar, typename Params, typename Member>
+auto gather(Vec<Params> const& params, Member member) -> ArrayX<Scalar>
+{
+    ArrayX<Scalar> res(params.size());
+    for(auto i = 0; i < params.size(); ++i)
+        res[i] = scalar<Scalar>(params[i].*member);
+    return res;
+}
+
+/// Return true if any entry in one of the given arrays carries derivative information.
+template<typename... Arrays>
+auto seeded(Arrays const&... arrays) -> bool
+{
+    auto seededArray = [](ArrayXr const& array)
+    {
+        for(auto i = 0; i < array.size(); ++i)
+            if(seeded(array[i]))
+                return true;
+        return false;
+    };
+    return (seededArray(arrays) || ...);
+}
+
+/// The standard thermodynamic properties of the species computed in a batch.
+template<typename Scalar>
+struct BatchOutput
+{
+    ArrayXrRef G0, H0, V0, VT0, VP0, Cp0;
+
+    /// Set the properties of the species with given index in the system.
+    auto set(Index ispecies, Scalar const& g0, Scalar const& h0, Scalar const& v0, Scalar const& vt0, Scalar const& vp0, Scalar const& cp0) -> void
+    {
+        G0[ispecies]  = g0;
+        H0[ispecies]  = h0;
+        V0[ispecies]  = v0;
+        VT0[ispecies] = vt0;
+        VP0[ispecies] = vp0;
+        Cp0[ispecies] = cp0;
+    }
+};
+
+//=================================================================================================
+// MAIER-KELLEY MODEL
+//=================================================================================================
+
+/// The parameters of the species with Maier-Kelley model stored as structure of arrays.
+template<typename Scalar>
+struct BatchMaierKelley
+{
+    ArrayX<Scalar> Gf, Hf, Sr, Vr, a, b, c;
+
+    BatchMaierKelley() = default;
+
+    BatchMaierKelley(Vec<StandardThermoModelParamsMaierKelley> const& params)
+    {
+        using Params = StandardThermoModelParamsMaierKelley;
+        Gf = gather<Scalar>(params, &Params::Gf);
+        Hf = gather<Scalar>(params, &Params::Hf);
+        Sr = gather<Scalar>(params, &Params::Sr);
+        Vr = gather<Scalar>(params, &Params::Vr);
+        a  = gather<Scalar>(params, &Params::a);
+        b  = gather<Scalar>(params, &Params::b);
+        c  = gather<Scalar>(params, &Params::c);
+    }
+
+    /// Compute the standard thermodynamic properties of the species (see StandardThermoModelMaierKelley).
+    auto eval(Scalar const& T, Scalar const& P, Indices const& ispecies, BatchOutput<Scalar>& out) const -> void
+    {
+        const auto Tr = 298.15; // the reference temperature of 25 C (in K)
+        const auto Pr = 1.0e5;  // the reference pressure of 1 bar (in Pa)
+
+        // The terms that depend only on temperature and pressure
+        const Scalar dT      = T - Tr;
+        const Scalar dT2     = T*T - Tr*Tr;
+        const Scalar dTinv   = 1.0/T - 1.0/Tr;
+        const Scalar dTinv2  = 1.0/(T*T) - 1.0/(Tr*Tr);
+        const Scalar lnTTr   = log(T/Tr);
+        const Scalar dP      = P - Pr;
+        const Scalar TT      = T*T;
+        const Scalar zero    = 0.0;
+
+        const auto size = ispecies.size();
+        for(auto i = 0; i < size; ++i)
+        {
+            const Scalar CpdT   = a[i]*dT + 0.5*b[i]*dT2 - c[i]*dTinv;
+            const Scalar CpdlnT = a[i]*lnTTr + b[i]*dT - 0.5*c[i]*dTinv2;
+            const Scalar VdP    = Vr[i]*dP;
+
+            const Scalar V0  = Vr[i];
+            const Scalar G0  = Gf[i] - Sr[i]*dT + CpdT - T*CpdlnT + VdP;
+            const Scalar H0  = Hf[i] + CpdT + VdP;
+            const Scalar Cp0 = a[i] + b[i]*T + c[i]/TT;
+
+            out.set(ispecies[i], G0, H0, V0, zero, zero, Cp0);
+        }
+    }
+};
+
+//=================================================================================================
+// HOLLAND-POWELL MODEL
+//=================================================================================================
+
+/// The parameters of the species with Holland-Powell model stored as structure of arrays.
+template<typename Scalar>
+struct BatchHollandPowell
+{
+    ArrayX<Scalar> Gf, Hf, Sr, Vr, MKa, MKb, MKc, MKd, alpha0, kappa0, kappa0p, kappa0pp, numatoms;
+
+    BatchHollandPowell() = default;
+
+    BatchHollandPowell(Vec<StandardThermoModelParamsHollandPowell> const& params)
+    {
+        using Params = StandardThermoModelParamsHollandPowell;
+        Gf       = gather<Scalar>(params, &Params::Gf);
+        Hf       = gather<Scalar>(params, &Params::Hf);
+        Sr       = gather<Scalar>(params, &Params::Sr);
+        Vr       = gather<Scalar>(params, &Params::Vr);
+        MKa      = gather<Scalar>(params, &Params::a);
+        MKb      = gather<Scalar>(params, &Params::b);
+        MKc      = gather<Scalar>(params, &Params::c);
+        MKd      = gather<Scalar>(params, &Params::d);
+        alpha0   = gather<Scalar>(params, &Params::alpha0);
+        kappa0   = gather<Scalar>(params, &Params::kappa0);
+        kappa0p  = gather<Scalar>(params, &Params::kappa0p);
+        kappa0pp = gather<Scalar>(params, &Params::kappa0pp);
+        numatoms = gather<Scalar>(params, &Params::numatoms);
+    }
+
+    /// Compute the standard thermodynamic properties of the species (see StandardThermoModelHollandPowell).
+    auto eval(Scalar const& T, Scalar const& P, Indices const& ispecies, BatchOutput<Scalar>& out) const -> void
+    {
+        const auto Pr   = 1.0e5;
+        const auto Tr   = 298.15;
+        const auto Tr2  = Tr*Tr;
+        const auto Tr05 = sqrt(Tr);
+
+        // The terms that depend only on temperature and pressure
+        const Scalar T2  = T*T;
+        const Scalar T05 = sqrt(T);
+        const Scalar dT      = T - Tr;
+        const Scalar dT2     = T2 - Tr2;
+        const Scalar dTinv   = 1.0/T - 1.0/Tr;
+        const Scalar dT05    = T05 - Tr05;
+        const Scalar lnTTr   = log(T/Tr);
+        const Scalar dTinv2  = 1/T2 - 1/Tr2;
+        const Scalar dTinv05 = 1/T05 - 1/Tr05;
+        const Scalar dP      = P - Pr;
+        const Scalar zero    = 0.0;
+
+        const auto size = ispecies.size();
+        for(auto i = 0; i < size; ++i)
+        {
+            const Scalar Cp     = MKa[i] + MKb[i]*T + MKc[i]/T2 + MKd[i]/T05;
+            const Scalar CpdT   = MKa[i]*dT + 0.5*MKb[i]*dT2 - MKc[i]*dTinv + 2.0*MKd[i]*dT05;
+            const Scalar CpdlnT = MKa[i]*lnTTr + MKb[i]*dT - 0.5*MKc[i]*dTinv2 - 2.0*MKd[i]*dTinv05;
+
+            Scalar V = 0.0;
+            Scalar VdP = 0.0;
+
+            if(kappa0[i] == 0.0)
+            {
+                V = Vr[i];
+                VdP = Vr[i]*dP;
+            }
+            else
+            {
+                const Scalar ka = (1 + kappa0p[i])/(1 + kappa0p[i] + kappa0[i]*kappa0pp[i]);
+                const Scalar kb = kappa0p[i]/kappa0[i] - kappa0pp[i]/(1 + kappa0p[i]);
+                const Scalar kc = (1 + kappa0p[i] + kappa0[i]*kappa0pp[i])/(kappa0p[i]*(1 + kappa0p[i]) - kappa0[i]*kappa0pp[i]);
+
+                const Scalar theta  = 10636.0/(Sr[i]/numatoms[i] + 6.44);
+
+                const Scalar u  = theta/T;
+                const Scalar u0 = theta/Tr;
+
+                const Scalar exp_u  = exp(u);
+                const Scalar exp_u0 = exp(u0);
+
+                const Scalar w0 = u0/(exp_u0 - 1);
+
+                const Scalar E0 = w0*w0*exp_u0;
+
+                const Scalar Pth = alpha0[i]*kappa0[i]*(theta/E0)*(1/(exp_u - 1) - 1/(exp_u0 - 1));
+
+                const Scalar aux1 = 1 - kb*Pth;
+                const Scalar aux2 = pow(aux1, 1 - kc);
+                const Scalar aux3 = 1 + kb*(P - Pth);
+                const Scalar aux4 = pow(aux3, 1 - kc);
+                const Scalar aux5 = kb*(kc - 1)*P;
+                const Scalar aux7 = pow(aux3, kc);
+
+                V = Vr[i]*(1 - ka*(1 - 1/aux7));
+                VdP = P*Vr[i] * (1 - ka + ka*(aux2 - aux4)/aux5);
+            }
+
+            const Scalar G0 = Gf[i] - Sr[i]*dT + CpdT - T*CpdlnT + VdP;
+            const Scalar H0 = Hf[i] + CpdT + VdP;
+
+            out.set(ispecies[i], G0, H0, V, zero, zero, Cp);
+        }
+    }
+};
+
+//=================================================================================================
+// HKF MODEL
+//=================================================================================================
+
+/// The reference temperature assumed in the HKF equations of state (in units of K)
+const auto Tr = 298.15;
+
+/// The reference pressure assumed in the HKF equations of state (in units of Pa)
+const auto Pr = 1.0e+05;
+
+/// The reference Born function Z (dimensionless)
+const auto Zr = -1.278055636e-02;
+
+/// The reference Born function Y (dimensionless)
+const auto Yr = -5.795424563e-05;
+
+/// The constant characteristics @eq{\Theta} of the solvent (in units of K)
+const auto theta = 228.0;
+
+/// The constant characteristics @eq{\Psi} of the solvent (in units of Pa)
+const auto psi = 2600.0e+05;
+
+/// The @eq{\eta} constant in the HKF model (in units of A*(J/mol))
+const auto eta = 6.94656968e+05;
+
+/// The parameters of the aqueous species with HKF model stored as structure of arrays.
+template<typename Scalar>
+struct BatchHKF
+{
+    ArrayX<Scalar> Gf, Hf, Sr, a1, a2, a3, a4, c1, c2, wref, charge;
+
+    BatchHKF() = default;
+
+    BatchHKF(Vec<StandardThermoModelParamsHKF> const& params)
+    {
+        using Params = StandardThermoModelParamsHKF;
+        Gf     = gather<Scalar>(params, &Params::Gf);
+        Hf     = gather<Scalar>(params, &Params::Hf);
+        Sr     = gather<Scalar>(params, &Params::Sr);
+        a1     = gather<Scalar>(params, &Params::a1);
+        a2     = gather<Scalar>(params, &Params::a2);
+        a3     = gather<Scalar>(params, &Params::a3);
+        a4     = gather<Scalar>(params, &Params::a4);
+        c1     = gather<Scalar>(params, &Params::c1);
+        c2     = gather<Scalar>(params, &Params::c2);
+        wref   = gather<Scalar>(params, &Params::wref);
+        charge = gather<Scalar>(params, &Params::charge);
+    }
+
+    /// Compute the standard thermodynamic properties of the aqueous species (see StandardThermoModelHKF).
+    auto eval(real const& Treal, real const& Preal, Indices const& ispecies, BatchOutput<Scalar>& out) const -> void
+    {
+        if(ispecies.empty())
+            return;
+
+        // The thermodynamic and electrostatic properties of water and the g function, computed once for all species
+        const auto wtp = waterThermoPropsWagnerPrussMemoized(Treal, Preal, StateOfMatter::Liquid);
+        const auto wep = waterElectroPropsJohnsonNorton(Treal, Preal, wtp);
+        const auto gstate = gHKF::compute(Treal, Preal, wtp);
+
+        const Scalar T   = scalar<Scalar>(Treal);
+        const Scalar P   = scalar<Scalar>(Preal);
+        const Scalar g   = scalar<Scalar>(gstate.g);
+        const Scalar gT  = scalar<Scalar>(gstate.gT);
+        const Scalar gP  = scalar<Scalar>(gstate.gP);
+        const Scalar gTT = scalar<Scalar>(gstate.gTT);
+        const Scalar gTP = scalar<Scalar>(gstate.gTP);
+        const Scalar gPP = scalar<Scalar>(gstate.gPP);
+        const Scalar Z   = scalar<Scalar>(wep.bornZ);
+        const Scalar Y   = scalar<Scalar>(wep.bornY);
+        const Scalar Q   = scalar<Scalar>(wep.bornQ);
+        const Scalar U   = scalar<Scalar>(wep.bornU);
+        const Scalar N   = scalar<Scalar>(wep.bornN);
+        const Scalar X   = scalar<Scalar>(wep.bornX);
+
+        // The terms that depend only on temperature and pressure
+        const Scalar Tth     = T - theta;
+        const Scalar Tth2    = Tth*Tth;
+        const Scalar Tth3    = Tth*Tth2;
+        const Scalar psiP    = psi + P;
+        const Scalar psiP2   = (psi + P)*(psi + P);
+        const Scalar dP      = P - Pr;
+        const Scalar dT      = T - Tr;
+        const Scalar lnpsi   = log((psi + P)/(psi + Pr));
+        const Scalar TlnT    = T*log(T/Tr) - T + Tr;
+        const Scalar ctheta  = (1.0/(T - theta) - 1.0/(Tr - theta))*(theta - T)/theta - T/(theta*theta)*log(Tr/T * (T - theta)/(Tr - theta));
+        const Scalar chi     = 1.0/(T - theta) - 1.0/(Tr - theta);
+        const Scalar g3082   = 3.082 + g;
+        const Scalar g3082p2 = pow(3.082 + g, 2);
+        const Scalar g3082p3 = pow(3.082 + g, 3);
+
+        const auto size = ispecies.size();
+        for(auto i = 0; i < size; ++i)
+        {
+            Scalar w, wT, wP, wTT, wTP, wPP;
+
+            if(charge[i] == 0.0)
+            {
+                w   = wref[i];
+                wT  = 0.0;
+                wP  = 0.0;
+                wTT = 0.0;
+                wTP = 0.0;
+                wPP = 0.0;
+            }
+            else
+            {
+                const Scalar z = charge[i];
+
+                const Scalar reref = z*z/(wref[i]/eta + z/3.082);
+                const Scalar re    = reref + abs(z) * g;
+
+                const Scalar X1 =  -eta * (abs(z*z*z)/(re*re) - z/g3082p2);
+                const Scalar X2 = 2*eta * (z*z*z*z/(re*re*re) - z/g3082p3);
+
+                w   = eta * (z*z/re - z/g3082);
+                wT  = X1 * gT;
+                wP  = X1 * gP;
+                wTT = X1 * gTT + X2 * gT * gT;
+                wTP = X1 * gTP + X2 * gT * gP;
+                wPP = X1 * gPP + X2 * gP * gP;
+            }
+
+            const auto& wr = wref[i];
+
+            const Scalar V0 = a1[i] + a2[i]/psiP + (a3[i] + a4[i]/psiP)/Tth - w*Q - (Z + 1)*wP;
+
+            const Scalar VT0 = -(a3[i] + a4[i]/psiP)/(Tth*Tth) - wT*Q - w*U - Y*wP - (Z + 1)*wTP;
+
+            const Scalar VP0 = -a2[i]/psiP2 + (-a4[i]/psiP2)/Tth - wP*Q - w*N - Q*wP - (Z + 1)*wPP;
+
+            const Scalar G0 = Gf[i] - Sr[i]*dT - c1[i]*TlnT
+                + a1[i]*dP + a2[i]*lnpsi
+                - c2[i]*ctheta
+                + 1.0/Tth*(a3[i]*dP + a4[i]*lnpsi)
+                - w*(Z + 1) + wr*(Zr + 1) + wr*Yr*dT;
+
+            const Scalar H0 = Hf[i] + c1[i]*dT - c2[i]*chi
+                + a1[i]*dP + a2[i]*lnpsi
+                + (2.0*T - theta)/Tth2*(a3[i]*dP
+                + a4[i]*lnpsi)
+                - w*(Z + 1) + w*T*Y + T*(Z + 1)*wT + wr*(Zr + 1) - wr*Tr*Yr;
+
+            const Scalar Cp0 = c1[i] + c2[i]/Tth2 - 2.0*T/Tth3*(a3[i]*dP + a4[i]*lnpsi) + w*T*X + 2.0*T*Y*wT + T*(Z + 1.0)*wTT;
+
+            out.set(ispecies[i], G0, H0, V0, VT0, VP0, Cp0);
+        }
+    }
+};
+
+//=================================================================================================
+// NASA POLYNOMIAL MODEL
+//=================================================================================================
+
+/// The parameters of the species with NASA polynomial model stored as structure of arrays.
+/// The temperature intervals of all species are stored contiguously, with the intervals of
+/// the *i*-th species in the range `[offsets[i], offsets[i + 1])`.
+template<typename Scalar>
+struct BatchNasa
+{
+    Indices offsets;
+    ArrayXd Tmin, Tmax;
+    ArrayX<Scalar> a1, a2, a3, a4, a5, a6, a7, b1, b2, H0;
+
+    BatchNasa() = default;
+
+    BatchNasa(Vec<StandardThermoModelParamsNasa> const& params)
+    {
+        using Polynomial = StandardThermoModelParamsNasa::Polynomial;
+
+        Vec<Polynomial> polynomials;
+        offsets.push_back(0);
+        for(auto const& p : params)
+        {
+            polynomials.insert(polynomials.end(), p.polynomials.begin(), p.polynomials.end());
+            offsets.push_back(polynomials.size());
+        }
+
+        Tmin = gather<double>(polynomials, &Polynomial::Tmin);
+        Tmax = gather<double>(polynomials, &Polynomial::Tmax);
+        a1 = gather<Scalar>(polynomials, &Polynomial::a1);
+        a2 = gather<Scalar>(polynomials, &Polynomial::a2);
+        a3 = gather<Scalar>(polynomials, &Polynomial::a3);
+        a4 = gather<Scalar>(polynomials, &Polynomial::a4);
+        a5 = gather<Scalar>(polynomials, &Polynomial::a5);
+        a6 = gather<Scalar>(polynomials, &Polynomial::a6);
+        a7 = gather<Scalar>(polynomials, &Polynomial::a7);
+        b1 = gather<Scalar>(polynomials, &Polynomial::b1);
+        b2 = gather<Scalar>(polynomials, &Polynomial::b2);
+        H0 = gather<Scalar>(params, &StandardThermoModelParamsNasa::H0);
+    }
+
+    /// Compute the standard thermodynamic properties of the species (see StandardThermoModelNasa).
+    auto eval(Scalar const& T, Scalar const& P, Indices const& ispecies, BatchOutput<Scalar>& out) const -> void
+    {
+        const auto R = universalGasConstant;
+
+        // The terms that depend only on temperature
+        const Scalar T2  = T*T;
+        const Scalar T3  = T*T2;
+        const Scalar T4  = T*T3;
+        const Scalar lnT = log(T);
+        const Scalar zero = 0.0;
+
+        const auto size = ispecies.size();
+        for(auto i = 0; i < size; ++i)
+        {
+            const auto begin = offsets[i];
+            const auto end = offsets[i + 1];
+
+            // The case of a species without temperature intervals, and just enthalpy at a single temperature point (assume G0 = H0).
+            if(begin == end)
+            {
+                out.set(ispecies[i], H0[i], H0[i], zero, zero, zero, zero);
+                continue;
+            }
+
+            // Find the temperature interval in which T is contained
+            auto k = begin;
+            while(k < end && !(Tmin[k] <= T && T <= Tmax[k]))
+                ++k;
+
+            // Set a high G0 value if T is outside the valid temperature range (to penalize the species from appearing at equilibrium)
+            if(k == end)
+            {
+                const Scalar G0 = 999'999'999'999;
+                out.set(ispecies[i], G0, zero, zero, zero, zero, zero);
+                continue;
+            }
+
+            const Scalar Cp0 = ( a1[k]/T2 + a2[k]/T + a3[k] + a4[k]*T + a5[k]*T2 + a6[k]*T3 + a7[k]*T4) * R;
+            const Scalar H0k = (-a1[k]/T2 + a2[k]*lnT/T + a3[k] + a4[k]*T/2.0 + a5[k]*T2/3.0 + a6[k]*T3/4.0 + a7[k]*T4/5.0 + b1[k]/T) * R*T;
+            const Scalar S0  = (-a1[k]/T2*0.5 - a2[k]/T + a3[k]*lnT + a4[k]*T + a5[k]*T2/2.0 + a6[k]*T3/3.0 + a7[k]*T4/4.0 + b2[k]) * R;
+
+            out.set(ispecies[i], H0k - T*S0, H0k, zero, zero, zero, Cp0);
+        }
+    }
+};
+
+/// Return the name of the model family and its original parameters if the standard thermodynamic model of a species can be evaluated in batches.
+/// The parameters are taken from StandardThermoModel::originalParams and not from StandardThermoModel::params, which
+/// stores them as `double` numbers and thus without any derivative seeds. If the original parameters are not available
+/// (e.g., a model created by chaining other models), the model is evaluated one at a time.
+auto modelFamily(Species const& species) -> Pair<String, Any const*>
+{
+    StandardThermoModel const& model = species.standardThermoModel();
+
+    Data const& params = model.params();
+
+    if(!params.isDict() || params.asDict().size() != 1 || !model.originalParams().has_value())
+        return { "", nullptr };
+
+    auto const& name = params.asDict().begin()->first;
+
+    return { name, &model.originalParams() };
+}
+
+/// Return the original parameters of a standard thermodynamic model of type `Params` or `nullptr` if they have a different type.
+template<typename Params>
+auto originalParams(Any const* params) -> Params const*
+{
+    return std::any_cast<Params>(params);
+}
+
+/// Return the global variable that holds status if the evaluation in batches is currently enabled or disabled.
+auto getStandardThermoModelBatchStatus() -> std::atomic<bool>&
+{
+    static std::atomic<bool> batch_active = true;
+    return batch_active;
+}
+
+} // namespace
+
+struct StandardThermoModelBatch::Impl
+{
+    /// The species in the batch.
+    SpeciesList species;
+
+    /// The indices of the species evaluated in batches and one at a time.
+    Indices ibatched, inotbatched;
+
+    /// The indices of the species in each family of standard thermodynamic models.
+    Indices imaierkelley, ihollandpowell, ihkf, inasa;
+
+    /// The parameters of the species in each family of standard thermodynamic models (without derivative information).
+    BatchMaierKelley<double> maierkelley;
+    BatchHollandPowell<double> hollandpowell;
+    BatchHKF<double> hkf;
+    BatchNasa<double> nasa;
+
+    /// The parameters of the species in each family of standard thermodynamic models (with derivative information).
+    BatchMaierKelley<real> maierkelleyr;
+    BatchHollandPowell<real> hollandpowellr;
+    BatchHKF<real> hkfr;
+    BatchNasa<real> nasar;
+
+    /// True if any parameter in the batches carries derivative information.
+    bool paramsseeded = false;
+
+    /// The standard thermodynamic properties of the species computed in the last call to eval.
+    struct Memo
+    {
+        real T, P;
+        ArrayXr G0, H0, V0, VT0, VP0, Cp0;
+        bool firsttime = true;
+    };
+
+    /// The last computed standard thermodynamic properties of the species in each thread.
+    ThreadLocal<Memo> memos;
+
+    Impl()
+    {}
+
+    Impl(SpeciesList const& specieslist)
+    : species(specieslist)
+    {
+        Vec<StandardThermoModelParamsMaierKelley> pmaierkelley;
+        Vec<StandardThermoModelParamsHollandPowell> phollandpowell;
+        Vec<StandardThermoModelParamsHKF> phkf;
+        Vec<StandardThermoModelParamsNasa> pnasa;
+
+        for(auto i = 0; i < species.size(); ++i)
+        {
+            const auto [name, params] = modelFamily(species[i]);
+
+            if(auto p = originalParams<StandardThermoModelParamsMaierKelley>(params); p && name == "MaierKelley")
+            {
+                pmaierkelley.push_back(*p);
+                imaierkelley.push_back(i);
+            }
+            else if(auto p = originalParams<StandardThermoModelParamsHollandPowell>(params); p && name == "HollandPowell")
+            {
+                phollandpowell.push_back(*p);
+                ihollandpowell.push_back(i);
+            }
+            else if(auto p = originalParams<StandardThermoModelParamsHKF>(params); p && name == "HKF")
+            {
+                phkf.push_back(*p);
+                ihkf.push_back(i);
+            }
+            else if(auto p = originalParams<StandardThermoModelParamsNasa>(params); p && name == "Nasa")
+            {
+                pnasa.push_back(*p);
+                inasa.push_back(i);
+            }
+            else inotbatched.push_back(i);
+        }
+
+        ibatched = concatenate(concatenate(imaierkelley, ihollandpowell), concatenate(ihkf, inasa));
+        std::sort(ibatched.begin(), ibatched.end());
+
+        maierkelley    = pmaierkelley;
+        hollandpowell  = phollandpowell;
+        hkf            = phkf;
+        nasa           = pnasa;
+        maierkelleyr   = pmaierkelley;
+        hollandpowellr = phollandpowell;
+        hkfr           = phkf;
+        nasar          = pnasa;
+
+        paramsseeded =
+            seeded(maierkelleyr.Gf, maierkelleyr.Hf, maierkelleyr.Sr, maierkelleyr.Vr, maierkelleyr.a, maierkelleyr.b, maierkelleyr.c) ||
+            seeded(hollandpowellr.Gf, hollandpowellr.Hf, hollandpowellr.Sr, hollandpowellr.Vr, hollandpowellr.MKa, hollandpowellr.MKb, hollandpowellr.MKc, hollandpowellr.MKd) ||
+            seeded(hollandpowellr.alpha0, hollandpowellr.kappa0, hollandpowellr.kappa0p, hollandpowellr.kappa0pp, hollandpowellr.numatoms) ||
+            seeded(hkfr.Gf, hkfr.Hf, hkfr.Sr, hkfr.a1, hkfr.a2, hkfr.a3, hkfr.a4, hkfr.c1, hkfr.c2, hkfr.wref, hkfr.charge) ||
+            seeded(nasar.a1, nasar.a2, nasar.a3, nasar.a4, nasar.a5, nasar.a6, nasar.a7, nasar.b1, nasar.b2, nasar.H0);
+    }
+
+    /// Compute the standard thermodynamic properties of the species in the batches using either `double` or `real` numbers.
+    template<typename Scalar, typename MaierKelley, typename HollandPowell, typename HKF, typename Nasa>
+    auto evalBatches(real const& T, real const& P, MaierKelley const& mk, HollandPowell const& hp, HKF const& hkfs, Nasa const& ns, BatchOutput<Scalar>& out) const -> void
+    {
+        const Scalar Ts = scalar<Scalar>(T);
+        const Scalar Ps = scalar<Scalar>(P);
+        mk.eval(Ts, Ps, imaierkelley, out);
+        hp.eval(Ts, Ps, ihollandpowell, out);
+        hkfs.eval(T, P, ihkf, out);
+        ns.eval(Ts, Ps, inasa, out);
+    }
+
+    /// Compute the standard thermodynamic properties of the species with given index using its standard thermodynamic model.
+    auto evalOne(Index i, real const& T, real const& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void
+    {
+        const auto props = species[i].standardThermoProps(T, P);
+        G0[i]  = props.G0;
+        H0[i]  = props.H0;
+        V0[i]  = props.V0;
+        VT0[i] = props.VT0;
+        VP0[i] = props.VP0;
+        Cp0[i] = props.Cp0;
+    }
+
+    auto eval(real const& T, real const& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void
+    {
+        const auto size = species.size();
+
+        errorif(G0.size() != size, "Expecting G0 argument in StandardThermoModelBatch::eval with size ", size, " but got ", G0.size(), ".");
+        errorif(H0.size() != size, "Expecting H0 argument in StandardThermoModelBatch::eval with size ", size, " but got ", H0.size(), ".");
+        errorif(V0.size() != size, "Expecting V0 argument in StandardThermoModelBatch::eval with size ", size, " but got ", V0.size(), ".");
+        errorif(VT0.size() != size, "Expecting VT0 argument in StandardThermoModelBatch::eval with size ", size, " but got ", VT0.size(), ".");
+        errorif(VP0.size() != size, "Expecting VP0 argument in StandardThermoModelBatch::eval with size ", size, " but got ", VP0.size(), ".");
+        errorif(Cp0.size() != size, "Expecting Cp0 argument in StandardThermoModelBatch::eval with size ", size, " but got ", Cp0.size(), ".");
+
+        // Evaluate one at a time the standard thermodynamic models of all species if evaluation in batches is disabled
+        if(StandardThermoModelBatch::isDisabled())
+        {
+            for(auto i = 0; i < size; ++i)
+                evalOne(i, T, P, G0, H0, V0, VT0, VP0, Cp0);
+            return;
+        }
+
+        // Reuse the properties computed in the last call at the same temperature and pressure (with same derivative information)
+        auto& memo = memos.local();
+        const auto memoized = !Memoization::isDisabled() && !memo.firsttime &&
+            T.val() == memo.T.val() && grad(T) == grad(memo.T) &&
+            P.val() == memo.P.val() && grad(P) == grad(memo.P);
+
+        if(memoized)
+        {
+            G0  = memo.G0;
+            H0  = memo.H0;
+            V0  = memo.V0;
+            VT0 = memo.VT0;
+            VP0 = memo.VP0;
+            Cp0 = memo.Cp0;
+            return;
+        }
+
+        // Use the faster kernels in double precision if no derivative information needs to be propagated
+        if(!seeded(T) && !seeded(P) && !paramsseeded)
+        {
+            BatchOutput<double> out{ G0, H0, V0, VT0, VP0, Cp0 };
+            evalBatches(T, P, maierkelley, hollandpowell, hkf, nasa, out);
+        }
+        else
+        {
+            BatchOutput<real> out{ G0, H0, V0, VT0, VP0, Cp0 };
+            evalBatches(T, P, maierkelleyr, hollandpowellr, hkfr, nasar, out);
+        }
+
+        // Evaluate one at a time the standard thermodynamic models of the species that cannot be batched
+        for(auto i : inotbatched)
+            evalOne(i, T, P, G0, H0, V0, VT0, VP0, Cp0);
+
+        if(Memoization::isDisabled())
+            return;
+
+        memo.T   = T;
+        memo.P   = P;
+        memo.G0  = G0;
+        memo.H0  = H0;
+        memo.V0  = V0;
+        memo.VT0 = VT0;
+        memo.VP0 = VP0;
+        memo.Cp0 = Cp0;
+        memo.firsttime = false;
+    }
+};
+
+StandardThermoModelBatch::StandardThermoModelBatch()
+: pimpl(new Impl())
+{}
+
+StandardThermoModelBatch::StandardThermoModelBatch(SpeciesList const& species)
+: pimpl(new Impl(species))
+{}
+
+auto StandardThermoModelBatch::indicesSpeciesInBatches() const -> Indices const&
+{
+    return pimpl->ibatched;
+}
+
+auto StandardThermoModelBatch::indicesSpeciesNotInBatches() const -> Indices const&
+{
+    return pimpl->inotbatched;
+}
+
+auto StandardThermoModelBatch::eval(real const& T, real const& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void
+{
+    pimpl->eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+}
+
+auto StandardThermoModelBatch::isEnabled() -> bool
+{
+    return getStandardThermoModelBatchStatus();
+}
+
+auto StandardThermoModelBatch::isDisabled() -> bool
+{
+    return !getStandardThermoModelBatchStatus();
+}
+
+auto StandardThermoModelBatch::enable() -> void
+{
+    getStandardThermoModelBatchStatus() = true;
+}
+
+auto StandardThermoModelBatch::disable() -> void
+{
+    getStandardThermoModelBatchStatus() = false;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,94 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class SpeciesList;
+
+/// The class used to evaluate the standard thermodynamic models of many species at once.
+/// The species are grouped by the family of their standard thermodynamic model
+/// (HKF, Maier-Kelley, Holland-Powell and NASA polynomials), with the parameters
+/// of each family stored as structure of arrays. The standard thermodynamic
+/// properties of all species in a family are then computed in a single loop, in
+/// which the terms that depend only on temperature and pressure (including the
+/// thermodynamic and electrostatic properties of water in the HKF model) are
+/// computed only once. The parameters of each model are taken, with their
+/// derivative seeds, from StandardThermoModel::originalParams. The species with
+/// any other standard thermodynamic model (or without original parameters) are
+/// evaluated one at a time using Species::standardThermoProps. The kernels
+/// use `double` numbers when neither temperature, pressure nor the model
+/// parameters carry derivative information, and the properties computed in the
+/// last evaluation (in each thread) are reused if temperature and pressure do
+/// not change. The evaluation in batches can be disabled globally with
+/// StandardThermoModelBatch::disable, in which case the standard thermodynamic
+/// models of all species are evaluated one at a time.
+/// @ingroup StandardThermoModels
+class StandardThermoModelBatch
+{
+public:
+    /// Construct a default StandardThermoModelBatch object.
+    StandardThermoModelBatch();
+
+    /// Construct a StandardThermoModelBatch object with given species.
+    explicit StandardThermoModelBatch(SpeciesList const& species);
+
+    /// Return the indices of the species whose standard thermodynamic models are evaluated in batches.
+    auto indicesSpeciesInBatches() const -> Indices const&;
+
+    /// Return the indices of the species whose standard thermodynamic models are evaluated one at a time.
+    auto indicesSpeciesNotInBatches() const -> Indices const&;
+
+    /// Evaluate the standard thermodynamic properties of the species at given temperature and pressure.
+    /// @param T The temperature (in K)
+    /// @param P The pressure (in Pa)
+    /// @param[out] G0 The standard molar Gibbs energies of formation of the species (in J/mol)
+    /// @param[out] H0 The standard molar enthalpies of formation of the species (in J/mol)
+    /// @param[out] V0 The standard molar volumes of the species (in m³/mol)
+    /// @param[out] VT0 The temperature derivative of the standard molar volumes of the species (in m³/(mol·K))
+    /// @param[out] VP0 The pressure derivative of the standard molar volumes of the species (in m³/(mol·Pa))
+    /// @param[out] Cp0 The standard molar isobaric heat capacities of the species (in J/(mol·K))
+    auto eval(real const& T, real const& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void;
+
+    /// Return true if the evaluation of standard thermodynamic models in batches is currently enabled.
+    static auto isEnabled() -> bool;
+
+    /// Return true if the evaluation of standard thermodynamic models in batches is currently disabled.
+    static auto isDisabled() -> bool;
+
+    /// Enable the evaluation of standard thermodynamic models in batches (the default).
+    static auto enable() -> void;
+
+    /// Disable the evaluation of standard thermodynamic models in batches.
+    /// The standard thermodynamic models of all species are then evaluated one
+    /// at a time using Species::standardThermoProps, as if none of them could
+    /// be evaluated in batches.
+    static auto disable() -> void;
+
+private:
+    struct Impl;
+
+    SharedPtr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,337 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/SpeciesList.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelBatch.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelConstant.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelHKF.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelHollandPowell.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelMaierKelley.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelNasa.hpp>
+using namespace Reaktoro;
+
+namespace test {
+
+/// Return a list of species whose standard thermodynamic models are of different families.
+auto createSpeciesList() -> SpeciesList
+{
+    StandardThermoModelParamsHKF co2aq;
+    co2aq.Gf     = -385974.0;
+    co2aq.Hf     = -413797.6;
+    co2aq.Sr     =  117.5704;
+    co2aq.a1     =  2.6135774e-05;
+    co2aq.a2     =  3125.9082;
+    co2aq.a3     =  0.00011772102;
+    co2aq.a4     = -129197.74;
+    co2aq.c1     =  167.49598;
+    co2aq.c2     =  368208.74;
+    co2aq.wref   = -8368.0;
+    co2aq.charge =  0.0;
+
+    StandardThermoModelParamsHKF co3aq;
+    co3aq.Gf     = -527983.14;
+    co3aq.Hf     = -675234.84;
+    co3aq.Sr     = -49.9988;
+    co3aq.a1     =  1.1934442e-05;
+    co3aq.a2     = -1667.073;
+    co3aq.a3     =  0.00026837013;
+    co3aq.a4     = -109382.31;
+    co3aq.c1     = -13.89339;
+    co3aq.c2     = -719300.73;
+    co3aq.wref   =  1418961.8;
+    co3aq.charge = -2.0;
+
+    StandardThermoModelParamsMaierKelley co2g;
+    co2g.Gf   = -394358.74;
+    co2g.Hf   = -393509.38;
+    co2g.Sr   =  213.73964;
+    co2g.Vr   =  0.0;
+    co2g.a    =  44.22488;
+    co2g.b    =  0.0087864;
+    co2g.c    = -861904.0;
+    co2g.Tmax =  2500.0;
+
+    StandardThermoModelParamsHollandPowell quartz;
+    quartz.Gf       = -856280.0;
+    quartz.Hf       = -910700.0;
+    quartz.Sr       =  41.43;
+    quartz.Vr       =  2.269e-05;
+    quartz.a        =  92.9;
+    quartz.b        = -0.000642;
+    quartz.c        = -714900.0;
+    quartz.d        = -716.1;
+    quartz.alpha0   =  0.65e-5;
+    quartz.kappa0   =  73000000000.0;
+    quartz.kappa0p  =  6.0;
+    quartz.kappa0pp = -8.2e-11;
+    quartz.numatoms =  3.0;
+
+    StandardThermoModelParamsHollandPowell calcite = quartz;
+    calcite.Vr     = 3.689e-05;
+    calcite.kappa0 = 0.0;
+
+    StandardThermoModelParamsNasa::Polynomial polynomial;
+    polynomial.a1 = 1.0e+04;
+    polynomial.a2 = 1.0e+02;
+    polynomial.a3 = 4.0;
+    polynomial.a4 = 1.0e-03;
+    polynomial.a5 = 1.0e-06;
+    polynomial.a6 = 1.0e-09;
+    polynomial.a7 = 1.0e-12;
+    polynomial.b1 = 1.0e+03;
+    polynomial.b2 = 1.0e+01;
+
+    StandardThermoModelParamsNasa ch4g;
+    ch4g.polynomials.resize(2, polynomial);
+    ch4g.polynomials[0].Tmin = 200.0;
+    ch4g.polynomials[0].Tmax = 1000.0;
+    ch4g.polynomials[1].Tmin = 1000.0;
+    ch4g.polynomials[1].Tmax = 6000.0;
+    ch4g.polynomials[1].a3 = 5.0;
+
+    StandardThermoModelParamsNasa o2g = ch4g;
+    o2g.polynomials.resize(1);
+    o2g.polynomials[0].Tmin = 400.0;
+
+    StandardThermoModelParamsNasa ng;
+    ng.H0 = 472680.0;
+
+    return SpeciesList({
+        Species("CO2(aq)").withStandardThermoModel(StandardThermoModelHKF(co2aq)),
+        Species("CH4(g)").withStandardThermoModel(StandardThermoModelNasa(ch4g)),
+        Species("CO3-2(aq)").withStandardThermoModel(StandardThermoModelHKF(co3aq)),
+        Species("Quartz").withStandardThermoModel(StandardThermoModelHollandPowell(quartz)),
+        Species("H2(aq)").withStandardGibbsEnergy(17723.0),
+        Species("CO2(g)").withStandardThermoModel(StandardThermoModelMaierKelley(co2g)),
+        Species("O2(g)").withStandardThermoModel(StandardThermoModelNasa(o2g)),
+        Species("Calcite").withStandardThermoModel(StandardThermoModelHollandPowell(calcite)),
+        Species("N(g)").withStandardThermoModel(StandardThermoModelNasa(ng)),
+    });
+}
+
+} // namespace test
+
+TEST_CASE("Testing StandardThermoModelBatch class", "[StandardThermoModelBatch]")
+{
+    const auto species = test::createSpeciesList();
+    const auto N = species.size();
+
+    StandardThermoModelBatch batch(species);
+
+    CHECK( batch.indicesSpeciesInBatches() == Indices{0, 1, 2, 3, 5, 6, 7, 8} );
+    CHECK( batch.indicesSpeciesNotInBatches() == Indices{4} );
+
+    ArrayXr G0(N), H0(N), V0(N), VT0(N), VP0(N), Cp0(N);
+
+    // Check the batch evaluation produces the same results as the evaluation of each species model
+    auto checkSameAsSpeciesModels = [&](real const& T, real const& P)
+    {
+        batch.eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+
+        for(auto i = 0; i < N; ++i)
+        {
+            INFO("species: " << species[i].name() << ", T = " << T << ", P = " << P);
+            const auto props = species[i].standardThermoProps(T, P);
+            CHECK( G0[i]  == Approx(props.G0)  );
+            CHECK( H0[i]  == Approx(props.H0)  );
+            CHECK( V0[i]  == Approx(props.V0)  );
+            CHECK( VT0[i] == Approx(props.VT0) );
+            CHECK( VP0[i] == Approx(props.VP0) );
+            CHECK( Cp0[i] == Approx(props.Cp0) );
+
+            CHECK( grad(G0[i])  == Approx(grad(props.G0))  );
+            CHECK( grad(H0[i])  == Approx(grad(props.H0))  );
+            CHECK( grad(V0[i])  == Approx(grad(props.V0))  );
+            CHECK( grad(VT0[i]) == Approx(grad(props.VT0)) );
+            CHECK( grad(VP0[i]) == Approx(grad(props.VP0)) );
+            CHECK( grad(Cp0[i]) == Approx(grad(props.Cp0)) );
+        }
+    };
+
+    SECTION("Checking batch evaluation at different temperatures and pressures")
+    {
+        for(auto T : { 298.15, 350.0, 450.0 })
+            for(auto P : { 1.0e5, 100.0e5, 1000.0e5 })
+                checkSameAsSpeciesModels(T, P);
+
+        // Repeat the evaluation at the last temperature and pressure (to check memoization)
+        checkSameAsSpeciesModels(450.0, 1000.0e5);
+    }
+
+    SECTION("Checking batch evaluation with derivatives with respect to temperature")
+    {
+        real T = 350.0;
+        real P = 100.0e5;
+
+        autodiff::seed(T);
+        checkSameAsSpeciesModels(T, P);
+        autodiff::unseed(T);
+
+        CHECK( grad(G0[0]) != 0.0 ); // the standard Gibbs energy of CO2(aq) depends on both temperature and pressure
+    }
+
+    SECTION("Checking batch evaluation with derivatives with respect to pressure")
+    {
+        real T = 350.0;
+        real P = 100.0e5;
+
+        autodiff::seed(P);
+        checkSameAsSpeciesModels(T, P);
+        autodiff::unseed(P);
+
+        CHECK( grad(G0[0]) != 0.0 ); // the standard Gibbs energy of CO2(aq) depends on both temperature and pressure
+    }
+
+    SECTION("Checking species with NASA polynomials outside their temperature range")
+    {
+        batch.eval(300.0, 1.0e5, G0, H0, V0, VT0, VP0, Cp0);
+
+        CHECK( G0[6] == 999'999'999'999 ); // O2(g) has no polynomial below 400 K
+        CHECK( H0[6] == 0.0 );
+        CHECK( G0[8] == 472680.0 ); // N(g) has no polynomial at all, and G0 = H0
+        CHECK( H0[8] == 472680.0 );
+    }
+
+    SECTION("Checking wrong sizes of output arrays are detected")
+    {
+        ArrayXr G0wrong(N - 1);
+        CHECK_THROWS( batch.eval(300.0, 1.0e5, G0wrong, H0, V0, VT0, VP0, Cp0) );
+    }
+}
+
+TEST_CASE("Testing StandardThermoModelBatch class with seeded model parameters", "[StandardThermoModelBatch]")
+{
+    StandardThermoModelParamsHKF co2aq;
+    co2aq.Gf     = -385974.0;
+    co2aq.Hf     = -413797.6;
+    co2aq.Sr     =  117.5704;
+    co2aq.a1     =  2.6135774e-05;
+    co2aq.a2     =  3125.9082;
+    co2aq.a3     =  0.00011772102;
+    co2aq.a4     = -129197.74;
+    co2aq.c1     =  167.49598;
+    co2aq.c2     =  368208.74;
+    co2aq.wref   = -8368.0;
+    co2aq.charge =  0.0;
+
+    StandardThermoModelParamsMaierKelley co2g;
+    co2g.Gf   = -394358.74;
+    co2g.Hf   = -393509.38;
+    co2g.Sr   =  213.73964;
+    co2g.Vr   =  0.0;
+    co2g.a    =  44.22488;
+    co2g.b    =  0.0087864;
+    co2g.c    = -861904.0;
+    co2g.Tmax =  2500.0;
+
+    // Seed the parameters before the models are created, which keep them with their derivative seeds
+    autodiff::seed(co2aq.Gf);
+    autodiff::seed(co2g.Sr);
+
+    const SpeciesList species({
+        Species("CO2(aq)").withStandardThermoModel(StandardThermoModelHKF(co2aq)),
+        Species("CO2(g)").withStandardThermoModel(StandardThermoModelMaierKelley(co2g)),
+    });
+
+    StandardThermoModelBatch batch(species);
+
+    CHECK( batch.indicesSpeciesInBatches() == Indices{0, 1} );
+
+    ArrayXr G0(2), H0(2), V0(2), VT0(2), VP0(2), Cp0(2);
+
+    const real T = 350.0;
+    const real P = 100.0e5;
+
+    batch.eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+
+    for(auto i = 0; i < species.size(); ++i)
+    {
+        INFO("species: " << species[i].name());
+        const auto props = species[i].standardThermoProps(T, P);
+        CHECK( G0[i] == Approx(props.G0) );
+        CHECK( grad(G0[i]) == Approx(grad(props.G0)) );
+        CHECK( grad(H0[i]) == Approx(grad(props.H0)) );
+    }
+
+    CHECK( grad(G0[0]) == Approx(1.0) );              // dG0/dGf = 1 in the HKF model
+    CHECK( grad(G0[1]) == Approx(-(350.0 - 298.15)) ); // dG0/dSr = -(T - Tr) in the Maier-Kelley model
+}
+
+TEST_CASE("Testing StandardThermoModelBatch class against each model family on a temperature-pressure grid", "[StandardThermoModelBatch]")
+{
+    const auto species = test::createSpeciesList();
+
+    // The species without HKF models, which are also checked at temperatures beyond the range of the HKF model
+    const SpeciesList nonaqueous(Vec<Species>{ species[1], species[3], species[5], species[6], species[7], species[8] });
+
+    // Check the batch evaluation produces the same results as the evaluation of each species model on a grid of temperatures and pressures
+    auto checkSameAsSpeciesModels = [](SpeciesList const& species, VectorXd const& temperatures, VectorXd const& pressures)
+    {
+        const auto N = species.size();
+
+        StandardThermoModelBatch batch(species);
+
+        ArrayXr G0(N), H0(N), V0(N), VT0(N), VP0(N), Cp0(N);
+
+        for(auto T : temperatures)
+        {
+            for(auto P : pressures)
+            {
+                batch.eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+
+                for(auto i = 0; i < N; ++i)
+                {
+                    const auto family = species[i].standardThermoModel().params().asDict().begin()->first;
+                    INFO("species: " << species[i].name() << ", model: " << family << ", T = " << T << ", P = " << P);
+                    const auto props = species[i].standardThermoProps(T, P);
+                    CHECK( G0[i]  == Approx(props.G0).epsilon(1e-10)  );
+                    CHECK( H0[i]  == Approx(props.H0).epsilon(1e-10)  );
+                    CHECK( V0[i]  == Approx(props.V0).epsilon(1e-10)  );
+                    CHECK( VT0[i] == Approx(props.VT0).epsilon(1e-10) );
+                    CHECK( VP0[i] == Approx(props.VP0).epsilon(1e-10) );
+                    CHECK( Cp0[i] == Approx(props.Cp0).epsilon(1e-10) );
+                }
+            }
+        }
+    };
+
+    VectorXd pressures(6);
+    pressures << 1.0e5, 50.0e5, 100.0e5, 250.0e5, 500.0e5, 1000.0e5;
+
+    SECTION("Checking all model families with evaluation in batches enabled")
+    {
+        checkSameAsSpeciesModels(species, linspace(273.15, 473.15, 11), pressures);
+        checkSameAsSpeciesModels(nonaqueous, linspace(273.15, 1973.15, 18), pressures);
+    }
+
+    SECTION("Checking all model families with evaluation in batches disabled")
+    {
+        StandardThermoModelBatch::disable();
+
+        CHECK( StandardThermoModelBatch::isDisabled() );
+
+        checkSameAsSpeciesModels(species, linspace(273.15, 473.15, 11), pressures);
+
+        StandardThermoModelBatch::enable();
+
+        CHECK( StandardThermoModelBatch::isEnabled() );
+    }
+}
@@ -29,7 +29,6 @@ using std::log;
 #include <Reaktoro/Serialization/Models/StandardThermoModels.hpp>
 #include <Reaktoro/Water/WaterElectroProps.hpp>
 #include <Reaktoro/Water/WaterElectroPropsJohnsonNorton.hpp>
-#include <Reaktoro/Water/WaterInterpolation.hpp>
 #include <Reaktoro/Water/WaterThermoProps.hpp>
 #include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
 
@@ -76,8 +75,6 @@ auto memoizedWaterElectroPropsJohnsonNorton(const real& T, const real& P) -> Wat
 
 auto StandardThermoModelHKF(const StandardThermoModelParamsHKF& params) -> StandardThermoModel
 {
-    waterThermoPropsWagnerPrussInterpData(StateOfMatter::Liquid); // this call exists to force an initialization operation so that when waterThermoPropsWagnerPrussInterp is called for the first time, this initialization has been performed already.
-
     auto evalfn = [=](StandardThermoProps& props, real T, real P)
     {
         auto& [G0, H0, V0, Cp0, VT0, VP0] = props;
@@ -136,7 +133,7 @@ auto StandardThermoModelHKF(const StandardThermoModelParamsHKF& params) -> Stand
     Data paramsdata;
     paramsdata["HKF"] = params;
 
-    return StandardThermoModel(evalfn, paramsdata);
+    return StandardThermoModel(evalfn, paramsdata).withOriginalParams(params);
 }
 
 } // namespace Reaktoro
@@ -134,7 +134,7 @@ auto StandardThermoModelHollandPowell(const StandardThermoModelParamsHollandPowe
     Data paramsdata;
     paramsdata["HollandPowell"] = params;
 
-    return StandardThermoModel(evalfn, paramsdata);
+    return StandardThermoModel(evalfn, paramsdata).withOriginalParams(params);
 }
 
 } // namespace Reaktoro
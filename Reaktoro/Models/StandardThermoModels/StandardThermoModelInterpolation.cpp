@@ -18,23 +18,28 @@
 #include "StandardThermoModelInterpolation.hpp"
 
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
+#include <Reaktoro/Math/PiecewiseCubicLagrangeInterpolator.hpp>
 #include <Reaktoro/Serialization/Models/StandardThermoModels.hpp>
 
 namespace Reaktoro {
+namespace {
 
-auto StandardThermoModelInterpolation(const StandardThermoModelParamsInterpolation& params) -> StandardThermoModel
+/// Return a function that calculates thermodynamic properties of a species using a given interpolator type.
+template<typename Interpolator>
+auto createStandardThermoModelInterpolation(const StandardThermoModelParamsInterpolation& params) -> StandardThermoModel
 {
     const auto& temperatures = params.temperatures;
     const auto& pressures = params.pressures;
     const auto& Pref = params.Pref;
 
-    BilinearInterpolator iG0(temperatures, pressures, params.G0);
-    BilinearInterpolator iH0(temperatures, pressures, params.H0);
-    BilinearInterpolator iV0(temperatures, pressures, params.V0);
-    BilinearInterpolator iVT0(temperatures, pressures, params.VT0);
-    BilinearInterpolator iVP0(temperatures, pressures, params.VP0);
-    BilinearInterpolator iCp0(temperatures, pressures, params.Cp0);
+    Interpolator iG0(temperatures, pressures, params.G0);
+    Interpolator iH0(temperatures, pressures, params.H0);
+    Interpolator iV0(temperatures, pressures, params.V0);
+    Interpolator iVT0(temperatures, pressures, params.VT0);
+    Interpolator iVP0(temperatures, pressures, params.VP0);
+    Interpolator iCp0(temperatures, pressures, params.Cp0);
 
     auto evalfn = [=](StandardThermoProps& props, real T, real P)
     {
@@ -54,4 +59,15 @@ auto StandardThermoModelInterpolation(const StandardThermoModelParamsInterpolati
     return StandardThermoModel(evalfn, paramsdata);
 }
 
+} // namespace
+
+auto StandardThermoModelInterpolation(const StandardThermoModelParamsInterpolation& params) -> StandardThermoModel
+{
+    if(params.method == "Bilinear")
+        return createStandardThermoModelInterpolation<BilinearInterpolator>(params);
+    if(params.method == "PiecewiseCubicLagrange")
+        return createStandardThermoModelInterpolation<PiecewiseCubicLagrangeInterpolator>(params);
+    errorif(true, "Expecting interpolation method `Bilinear` or `PiecewiseCubicLagrange` in StandardThermoModelInterpolation, but got `", params.method, "`.");
+}
+
 } // namespace Reaktoro
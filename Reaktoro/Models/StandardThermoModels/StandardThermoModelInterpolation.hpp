@@ -52,6 +52,9 @@ struct StandardThermoModelParamsInterpolation
 
     /// The reference pressure used for volume correction of @f$G^{\circ}@f$ (in Pa).
     double Pref = 1e5;
+
+    /// The interpolation method, which can be `Bilinear` or `PiecewiseCubicLagrange`.
+    String method = "Bilinear";
 };
 
 /// Return a function that calculates thermodynamic properties of a species using the Maier-Kelley model.
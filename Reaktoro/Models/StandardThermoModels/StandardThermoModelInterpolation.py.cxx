@@ -34,6 +34,8 @@ void exportStandardThermoModelInterpolation(py::module& m)
         .def_readwrite("VT0",          &StandardThermoModelParamsInterpolation::VT0)
         .def_readwrite("VP0",          &StandardThermoModelParamsInterpolation::VP0)
         .def_readwrite("Cp0",          &StandardThermoModelParamsInterpolation::Cp0)
+        .def_readwrite("Pref",         &StandardThermoModelParamsInterpolation::Pref)
+        .def_readwrite("method",       &StandardThermoModelParamsInterpolation::method)
         ;
 
     m.def("StandardThermoModelInterpolation", StandardThermoModelInterpolation);
@@ -71,3 +71,31 @@ TEST_CASE("Testing StandardThermoModelInterpolation class", "[StandardThermoMode
     CHECK( props.VP0 == 0.0 );
     CHECK( props.Cp0 == 0.0 );
 }
+
+TEST_CASE("Testing StandardThermoModelInterpolation class with piecewise cubic Lagrange interpolation", "[StandardThermoModelInterpolation]")
+{
+    StandardThermoModelParamsInterpolation params;
+    params.temperatures = {1.0, 2.0, 3.0, 4.0};
+    params.pressures = {4.0, 5.0};
+    params.G0 = {{ 1.0,  8.0, 27.0, 64.0},   // G0 = T^3 at P = 4
+                 { 2.0, 16.0, 54.0, 128.0}}; // G0 = 2T^3 at P = 5
+    params.Pref = 4.0;
+    params.method = "PiecewiseCubicLagrange";
+
+    StandardThermoModel model = StandardThermoModelInterpolation(params);
+    StandardThermoProps props;
+
+    props = model(2.5, 4.0);
+
+    CHECK( props.G0 == Approx(2.5*2.5*2.5) );
+
+    props = model(2.5, 4.5);
+
+    CHECK( props.G0 == Approx(1.5 * 2.5*2.5*2.5) );
+
+    CHECK( model.params().at("Interpolation").at("Method").asString() == "PiecewiseCubicLagrange" );
+
+    params.method = "Spline";
+
+    CHECK_THROWS( StandardThermoModelInterpolation(params) );
+}
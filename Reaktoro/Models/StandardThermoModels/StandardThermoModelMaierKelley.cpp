@@ -56,7 +56,7 @@ auto StandardThermoModelMaierKelley(const StandardThermoModelParamsMaierKelley&
     Data paramsdata;
     paramsdata["MaierKelley"] = params;
 
-    return StandardThermoModel(evalfn, paramsdata);
+    return StandardThermoModel(evalfn, paramsdata).withOriginalParams(params);
 }
 
 } // namespace Reaktoro
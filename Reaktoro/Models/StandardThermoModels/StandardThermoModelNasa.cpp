@@ -112,7 +112,7 @@ auto StandardThermoModelNasa(const StandardThermoModelParamsNasa& params) -> Sta
     Data paramsdata;
     paramsdata["Nasa"] = params;
 
-    return StandardThermoModel(evalfn, paramsdata);
+    return StandardThermoModel(evalfn, paramsdata).withOriginalParams(params);
 }
 
 } // namespace Reaktoro
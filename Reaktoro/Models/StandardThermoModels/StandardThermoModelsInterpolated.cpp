@@ -0,0 +1,150 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "StandardThermoModelsInterpolated.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelBatch.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelInterpolation.hpp>
+
+namespace Reaktoro {
+
+auto interpolateStandardThermoModels(ChemicalSystem const& system, Vec<double> const& temperatures, Vec<double> const& pressures, String const& method) -> StandardThermoModelsInterpolated
+{
+    errorif(temperatures.empty(), "Expecting at least one temperature in interpolateStandardThermoModels.");
+    errorif(pressures.empty(), "Expecting at least one pressure in interpolateStandardThermoModels.");
+    errorif(!std::is_sorted(temperatures.begin(), temperatures.end()), "Expecting temperatures in increasing order in interpolateStandardThermoModels.");
+    errorif(!std::is_sorted(pressures.begin(), pressures.end()), "Expecting pressures in increasing order in interpolateStandardThermoModels.");
+
+    const auto& species = system.species();
+
+    const auto N = species.size();
+    const auto numT = temperatures.size();
+    const auto numP = pressures.size();
+
+    // The tables of standard thermodynamic properties of each species, with one row per pressure and one column per temperature
+    Vec<StandardThermoModelParamsInterpolation> params(N);
+    for(auto& p : params)
+    {
+        p.temperatures = temperatures;
+        p.pressures = pressures;
+        p.method = method;
+        for(auto table : { &p.G0, &p.H0, &p.V0, &p.VT0, &p.VP0, &p.Cp0 })
+            table->assign(numP, Vec<double>(numT));
+    }
+
+    // Evaluate the standard thermodynamic properties of all species at once in each point of the grid
+    StandardThermoModelBatch batch(species);
+
+    ArrayXr G0(N), H0(N), V0(N), VT0(N), VP0(N), Cp0(N);
+
+    for(auto j = 0; j < numP; ++j)
+    {
+        for(auto i = 0; i < numT; ++i)
+        {
+            const auto T = temperatures[i];
+            const auto P = pressures[j];
+
+            batch.eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+
+            for(auto k = 0; k < N; ++k)
+            {
+                auto& p = params[k];
+                p.G0[j][i]  = G0[k].val() - V0[k].val() * (P - p.Pref); // StandardThermoModelInterpolation adds V0*(P - Pref) to the interpolated G0
+                p.H0[j][i]  = H0[k].val();
+                p.V0[j][i]  = V0[k].val();
+                p.VT0[j][i] = VT0[k].val();
+                p.VP0[j][i] = VP0[k].val();
+                p.Cp0[j][i] = Cp0[k].val();
+            }
+        }
+    }
+
+    // Create the species with interpolated standard thermodynamic models
+    Vec<Species> newspecies;
+    newspecies.reserve(N);
+    for(auto k = 0; k < N; ++k)
+        newspecies.push_back(species[k].withStandardThermoModel(StandardThermoModelInterpolation(params[k])));
+
+    // Create the phases with the new species (with same activity models)
+    Vec<Phase> newphases;
+    auto offset = 0;
+    for(auto phase : system.phases())
+    {
+        const auto size = phase.species().size();
+        newphases.push_back(phase.withSpecies(Vec<Species>(newspecies.begin() + offset, newspecies.begin() + offset + size)));
+        offset += size;
+    }
+
+    // Create the reactions with the new species in their equations (with same rate models), so that their standard thermodynamic properties are interpolated too
+    const SpeciesList newspecieslist(newspecies);
+    Vec<Reaction> newreactions;
+    for(auto const& reaction : system.reactions())
+    {
+        Pairs<Species, double> pairs;
+        for(auto const& [s, coeff] : reaction.equation())
+        {
+            const auto ispecies = newspecieslist.find(s.name());
+            pairs.emplace_back(ispecies < N ? newspecieslist[ispecies] : s, coeff);
+        }
+        newreactions.push_back(reaction.withEquation(ReactionEquation(pairs)));
+    }
+
+    StandardThermoModelsInterpolated res;
+    res.system = ChemicalSystem(system.database(), PhaseList(newphases), ReactionList(newreactions), system.surfaces());
+    res.errors.resize(N);
+
+    // Estimate the interpolation errors at the center of each cell of the grid
+    auto centers = [](Vec<double> const& points)
+    {
+        if(points.size() == 1)
+            return points;
+        Vec<double> res;
+        for(auto i = 1; i < points.size(); ++i)
+            res.push_back(0.5 * (points[i - 1] + points[i]));
+        return res;
+    };
+
+    for(auto P : centers(pressures))
+    {
+        for(auto T : centers(temperatures))
+        {
+            batch.eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+
+            for(auto k = 0; k < N; ++k)
+            {
+                const auto props = newspecies[k].standardThermoProps(T, P);
+                auto& errors = res.errors[k];
+                errors.G0  = std::max(errors.G0,  std::abs(props.G0.val()  - G0[k].val()));
+                errors.H0  = std::max(errors.H0,  std::abs(props.H0.val()  - H0[k].val()));
+                errors.V0  = std::max(errors.V0,  std::abs(props.V0.val()  - V0[k].val()));
+                errors.VT0 = std::max(errors.VT0, std::abs(props.VT0.val() - VT0[k].val()));
+                errors.VP0 = std::max(errors.VP0, std::abs(props.VP0.val() - VP0[k].val()));
+                errors.Cp0 = std::max(errors.Cp0, std::abs(props.Cp0.val() - Cp0[k].val()));
+            }
+        }
+    }
+
+    return res;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,80 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+
+namespace Reaktoro {
+
+/// The estimated errors in the interpolated standard thermodynamic properties of a species.
+/// These are the maximum absolute differences between the interpolated and the original
+/// standard thermodynamic properties of the species at the centers of the cells of the
+/// temperature-pressure grid used for interpolation, which is where interpolation errors
+/// are expected to be largest.
+struct StandardThermoModelInterpolationErrors
+{
+    /// The estimated error in the standard molar Gibbs energy of formation of the species (in J/mol).
+    double G0 = 0.0;
+
+    /// The estimated error in the standard molar enthalpy of formation of the species (in J/mol).
+    double H0 = 0.0;
+
+    /// The estimated error in the standard molar volume of the species (in m³/mol).
+    double V0 = 0.0;
+
+    /// The estimated error in the temperature derivative of the standard molar volume of the species (in m³/(mol·K)).
+    double VT0 = 0.0;
+
+    /// The estimated error in the pressure derivative of the standard molar volume of the species (in m³/(mol·Pa)).
+    double VP0 = 0.0;
+
+    /// The estimated error in the standard molar isobaric heat capacity of the species (in J/(mol·K)).
+    double Cp0 = 0.0;
+};
+
+/// The chemical system whose species use interpolated standard thermodynamic models.
+/// @see interpolateStandardThermoModels
+struct StandardThermoModelsInterpolated
+{
+    /// The chemical system with the species using interpolated standard thermodynamic models.
+    ChemicalSystem system;
+
+    /// The estimated errors in the interpolated standard thermodynamic properties of each species in the system.
+    Vec<StandardThermoModelInterpolationErrors> errors;
+};
+
+/// Return a copy of a chemical system in which the standard thermodynamic models of all species are interpolated.
+/// The standard thermodynamic properties of all species in the chemical system are
+/// sampled once on the grid of given temperatures and pressures, and the species
+/// of the returned chemical system use StandardThermoModelInterpolation on these
+/// tables instead of their original models. This trades a one-time cost for faster
+/// evaluation of standard thermodynamic properties afterwards, as long as temperature
+/// and pressure stay within the grid (outside it, the interpolation is clamped to its
+/// boundaries). The reactions of the returned chemical system are rebuilt with the
+/// new species in their equations, so that their standard thermodynamic properties
+/// are also computed from the interpolated models. The phases, activity models,
+/// reaction rate models, and surfaces of the system are otherwise unchanged.
+/// @param system The chemical system whose species will have interpolated standard thermodynamic models
+/// @param temperatures The temperatures of the interpolation grid in increasing order (in K)
+/// @param pressures The pressures of the interpolation grid in increasing order (in Pa)
+/// @param method The interpolation method, which can be `Bilinear` or `PiecewiseCubicLagrange`
+auto interpolateStandardThermoModels(ChemicalSystem const& system, Vec<double> const& temperatures, Vec<double> const& pressures, String const& method = "PiecewiseCubicLagrange") -> StandardThermoModelsInterpolated;
+
+} // namespace Reaktoro
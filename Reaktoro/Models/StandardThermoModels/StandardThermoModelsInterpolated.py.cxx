@@ -0,0 +1,44 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelsInterpolated.hpp>
+using namespace Reaktoro;
+
+void exportStandardThermoModelsInterpolated(py::module& m)
+{
+    py::class_<StandardThermoModelInterpolationErrors>(m, "StandardThermoModelInterpolationErrors")
+        .def(py::init<>())
+        .def_readwrite("G0",  &StandardThermoModelInterpolationErrors::G0)
+        .def_readwrite("H0",  &StandardThermoModelInterpolationErrors::H0)
+        .def_readwrite("V0",  &StandardThermoModelInterpolationErrors::V0)
+        .def_readwrite("VT0", &StandardThermoModelInterpolationErrors::VT0)
+        .def_readwrite("VP0", &StandardThermoModelInterpolationErrors::VP0)
+        .def_readwrite("Cp0", &StandardThermoModelInterpolationErrors::Cp0)
+        ;
+
+    py::class_<StandardThermoModelsInterpolated>(m, "StandardThermoModelsInterpolated")
+        .def(py::init<>())
+        .def_readwrite("system", &StandardThermoModelsInterpolated::system)
+        .def_readwrite("errors", &StandardThermoModelsInterpolated::errors)
+        ;
+
+    m.def("interpolateStandardThermoModels", interpolateStandardThermoModels, "Return a copy of a chemical system in which the standard thermodynamic models of all species are interpolated.", py::arg("system"), py::arg("temperatures"), py::arg("pressures"), py::arg("method") = "PiecewiseCubicLagrange");
+}
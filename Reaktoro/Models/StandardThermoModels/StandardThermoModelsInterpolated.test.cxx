@@ -0,0 +1,130 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/Phases.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelHKF.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelMaierKelley.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelsInterpolated.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing interpolateStandardThermoModels function", "[StandardThermoModelsInterpolated]")
+{
+    StandardThermoModelParamsHKF co2aq;
+    co2aq.Gf     = -385974.0;
+    co2aq.Hf     = -413797.6;
+    co2aq.Sr     =  117.5704;
+    co2aq.a1     =  2.6135774e-05;
+    co2aq.a2     =  3125.9082;
+    co2aq.a3     =  0.00011772102;
+    co2aq.a4     = -129197.74;
+    co2aq.c1     =  167.49598;
+    co2aq.c2     =  368208.74;
+    co2aq.wref   = -8368.0;
+    co2aq.charge =  0.0;
+
+    StandardThermoModelParamsMaierKelley co2g;
+    co2g.Gf   = -394358.74;
+    co2g.Hf   = -393509.38;
+    co2g.Sr   =  213.73964;
+    co2g.Vr   =  0.0;
+    co2g.a    =  44.22488;
+    co2g.b    =  0.0087864;
+    co2g.c    = -861904.0;
+    co2g.Tmax =  2500.0;
+
+    Database db;
+    db.addSpecies( Species("H2O(aq)").withStandardGibbsEnergy(-237181.0) );
+    db.addSpecies( Species("CO2(aq)").withStandardThermoModel(StandardThermoModelHKF(co2aq)) );
+    db.addSpecies( Species("CO2(g)").withStandardThermoModel(StandardThermoModelMaierKelley(co2g)) );
+
+    ReactionRateModel ratefn = [](ChemicalProps const& props) { return 0.0; };
+
+    ChemicalSystem system(db,
+        AqueousPhase("H2O(aq) CO2(aq)"),
+        GaseousPhase("CO2(g)"),
+        GeneralReaction("CO2(g) = CO2(aq)").setRateModel(ratefn)
+    );
+
+    const auto temperatures = Vec<double>{ 298.15, 323.15, 348.15, 373.15, 398.15 };
+    const auto pressures = Vec<double>{ 1.0e5, 26.0e5, 51.0e5, 76.0e5, 101.0e5 };
+
+    const auto cubic = interpolateStandardThermoModels(system, temperatures, pressures);
+    const auto bilinear = interpolateStandardThermoModels(system, temperatures, pressures, "Bilinear");
+
+    REQUIRE( cubic.system.species().size() == system.species().size() );
+    REQUIRE( cubic.system.phases().size() == system.phases().size() );
+    REQUIRE( cubic.errors.size() == system.species().size() );
+
+    const auto N = system.species().size();
+
+    for(auto k = 0; k < N; ++k)
+    {
+        auto const& species = system.species(k);
+        auto const& interpolated = cubic.system.species(k);
+
+        INFO("species: " << species.name());
+
+        CHECK( interpolated.name() == species.name() );
+        CHECK( interpolated.standardThermoModel().params().isDict() );
+        CHECK( interpolated.standardThermoModel().params().exists("Interpolation") );
+
+        // Check the interpolated properties are exact on the points of the grid
+        for(auto T : temperatures) for(auto P : pressures)
+        {
+            const auto expected = species.standardThermoProps(T, P);
+            const auto actual = interpolated.standardThermoProps(T, P);
+            CHECK( actual.G0  == Approx(expected.G0)  );
+            CHECK( actual.H0  == Approx(expected.H0)  );
+            CHECK( actual.V0  == Approx(expected.V0)  );
+            CHECK( actual.Cp0 == Approx(expected.Cp0) );
+        }
+
+        // Check the interpolated properties are accurate in between the points of the grid
+        const auto T = 335.0;
+        const auto P = 40.0e5;
+        const auto expected = species.standardThermoProps(T, P);
+        const auto actual = interpolated.standardThermoProps(T, P);
+        CHECK( actual.G0 == Approx(expected.G0).epsilon(1e-6) );
+        CHECK( actual.H0 == Approx(expected.H0).epsilon(1e-6) );
+
+        // Check the estimated errors
+        CHECK( cubic.errors[k].G0 < 1.0 );
+        CHECK( cubic.errors[k].H0 < 1.0 );
+        CHECK( cubic.errors[k].G0 <= bilinear.errors[k].G0 );
+    }
+
+    CHECK( bilinear.errors[1].G0 > 0.0 ); // CO2(aq) with HKF model is not bilinear in temperature and pressure
+
+    // Check the reactions use the species with interpolated standard thermodynamic models
+    REQUIRE( cubic.system.reactions().size() == 1 );
+
+    auto const& reaction = system.reaction(0);
+    auto const& interpolated = cubic.system.reaction(0);
+
+    CHECK( String(interpolated.equation()) == String(reaction.equation()) );
+
+    for(auto const& [species, coeff] : interpolated.equation())
+        CHECK( species.standardThermoModel().params().exists("Interpolation") );
+
+    const auto T = 335.0;
+    const auto P = 40.0e5;
+    CHECK( interpolated.props(T, P).dG0 == Approx(reaction.props(T, P).dG0).epsilon(1e-6) );
+}
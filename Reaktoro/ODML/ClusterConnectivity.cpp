@@ -26,6 +26,15 @@ namespace Reaktoro {
 ClusterConnectivity::ClusterConnectivity()
 {}
 
+auto ClusterConnectivity::withInitialQueues(Deque<PriorityQueue> const& matrix, PriorityQueue const& queue) -> ClusterConnectivity
+{
+    assert(matrix.size() == queue.size());
+    ClusterConnectivity connectivity;
+    connectivity.matrix = matrix;
+    connectivity.queue = queue;
+    return connectivity;
+}
+
 auto ClusterConnectivity::size() const -> Index
 {
     return queue.size();
@@ -73,5 +82,15 @@ auto ClusterConnectivity::order(Index icluster) const -> Deque<Index> const&
     return icluster < size() ? matrix[icluster].order() : queue.order();
 }
 
+auto ClusterConnectivity::matrixQueues() const -> Deque<PriorityQueue> const&
+{
+    return matrix;
+}
+
+auto ClusterConnectivity::usageQueue() const -> PriorityQueue const&
+{
+    return queue;
+}
+
 } // namespace Reaktoro
 
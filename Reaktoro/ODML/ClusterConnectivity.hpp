@@ -30,6 +30,11 @@ public:
     /// Construct a default instance of ClusterConnectivity.
     ClusterConnectivity();
 
+    /// Return a ClusterConnectivity instance with given priority queues of the clusters.
+    /// @param matrix The priority queues for visitation of the clusters when starting from each cluster.
+    /// @param queue The priority queue of the clusters based on their usage count.
+    static auto withInitialQueues(Deque<PriorityQueue> const& matrix, PriorityQueue const& queue) -> ClusterConnectivity;
+
     /// Return number of currently tracked clusters.
     auto size() const -> Index;
 
@@ -51,6 +56,12 @@ public:
     /// then an ordering based on usage count of clusters is returned.
     auto order(Index icluster) const -> Deque<Index> const&;
 
+    /// Return the priority queues for visitation of the clusters when starting from each cluster.
+    auto matrixQueues() const -> Deque<PriorityQueue> const&;
+
+    /// Return the priority queue of the clusters based on their usage count.
+    auto usageQueue() const -> PriorityQueue const&;
+
 private:
     /// The connectivity of each cluster with others in terms of priority queue for visitation.
     Deque<PriorityQueue> matrix;
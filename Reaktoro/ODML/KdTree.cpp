@@ -0,0 +1,215 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "KdTree.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <numeric>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+
+KdTree::KdTree()
+{}
+
+KdTree::KdTree(Index dim)
+: _dim(dim)
+{
+    errorif(dim == 0, "Expecting a positive dimension for the points of a KdTree object, but got zero.");
+}
+
+auto KdTree::dim() const -> Index
+{
+    return _dim;
+}
+
+auto KdTree::size() const -> Index
+{
+    return _nodes.size();
+}
+
+auto KdTree::point(Index ipoint) const -> VectorXdConstRef
+{
+    return VectorXdConstMap(_coords.data() + ipoint * _dim, _dim);
+}
+
+auto KdTree::clear() -> void
+{
+    _coords.clear();
+    _nodes.clear();
+    _root = npos;
+    _rebuild_size = 16;
+}
+
+auto KdTree::insert(VectorXdConstRef point) -> void
+{
+    errorif(_dim == 0, "Cannot insert points in a KdTree object with dimension zero (e.g., one constructed with its default constructor).");
+    errorif(point.size() != _dim, "Expecting a point with dimension ", _dim, " in KdTree::insert, but got one with dimension ", point.size(), ".");
+
+    const auto ipoint = _nodes.size();
+
+    _coords.insert(_coords.end(), point.data(), point.data() + _dim);
+
+    // Rebuild the tree from scratch whenever its size doubles so that it remains reasonably balanced
+    if(ipoint + 1 >= _rebuild_size)
+    {
+        _nodes.emplace_back();
+        rebuild();
+        _rebuild_size *= 2;
+        return;
+    }
+
+    Node node;
+    node.ipoint = ipoint;
+
+    // Descend the tree until the leaf node under which the new point is attached
+    auto parent = npos;
+    auto child = _root;
+    while(child != npos)
+    {
+        parent = child;
+        auto const& current = _nodes[parent];
+        child = point[current.axis] < _coords[current.ipoint * _dim + current.axis] ? current.left : current.right;
+    }
+
+    if(parent == npos)
+        _root = ipoint;
+    else
+    {
+        auto& current = _nodes[parent];
+        node.axis = (current.axis + 1) % _dim;
+        if(point[current.axis] < _coords[current.ipoint * _dim + current.axis])
+            current.left = ipoint;
+        else current.right = ipoint;
+    }
+
+    _nodes.push_back(node);
+}
+
+auto KdTree::nearest(VectorXdConstRef point, Index k, Vec<Index>& indices) const -> void
+{
+    errorif(point.size() != _dim, "Expecting a point with dimension ", _dim, " in KdTree::nearest, but got one with dimension ", point.size(), ".");
+
+    indices.clear();
+
+    if(k == 0 || _root == npos)
+        return;
+
+    // The max-heap of the squared distances and indices of the nearest points found so far
+    Vec<Pair<double, Index>> heap;
+    heap.reserve(k + 1);
+
+    // The stack of nodes still to be visited and the lower bounds of the squared distances to their subtrees
+    Vec<Pair<Index, double>> stack;
+    stack.emplace_back(_root, 0.0);
+
+    while(!stack.empty())
+    {
+        const auto [inode, bound] = stack.back();
+        stack.pop_back();
+
+        // Skip the subtree if it cannot contain points nearer than those already found
+        if(heap.size() == k && bound >= heap.front().first)
+            continue;
+
+        auto const& node = _nodes[inode];
+        auto const* x = _coords.data() + node.ipoint * _dim;
+
+        double distance = 0.0;
+        for(auto i = 0; i < _dim; ++i)
+            distance += (point[i] - x[i]) * (point[i] - x[i]);
+
+        if(heap.size() < k || distance < heap.front().first)
+        {
+            heap.emplace_back(distance, node.ipoint);
+            std::push_heap(heap.begin(), heap.end());
+            if(heap.size() > k)
+            {
+                std::pop_heap(heap.begin(), heap.end());
+                heap.pop_back();
+            }
+        }
+
+        const auto delta = point[node.axis] - x[node.axis];
+        const auto nearside = delta < 0.0 ? node.left : node.right;
+        const auto farside = delta < 0.0 ? node.right : node.left;
+
+        // Push the far subtree first so that the near one is visited before it
+        if(farside != npos)
+            stack.emplace_back(farside, std::max(bound, delta * delta));
+        if(nearside != npos)
+            stack.emplace_back(nearside, bound);
+    }
+
+    std::sort_heap(heap.begin(), heap.end());
+
+    indices.reserve(heap.size());
+    for(auto const& [distance, ipoint] : heap)
+        indices.push_back(ipoint);
+}
+
+auto KdTree::rebuild() -> void
+{
+    Vec<Index> ipoints(_nodes.size());
+    std::iota(ipoints.begin(), ipoints.end(), 0);
+    _root = build(ipoints.data(), ipoints.data() + ipoints.size());
+}
+
+auto KdTree::build(Index* begin, Index* end) -> Index
+{
+    if(begin == end)
+        return npos;
+
+    // Determine the coordinate along which the points in the range are most spread
+    Index axis = 0;
+    double spread = -1.0;
+    for(auto i = 0; i < _dim; ++i)
+    {
+        const auto [xmin, xmax] = std::minmax_element(begin, end,
+            [&](Index l, Index r) { return _coords[l * _dim + i] < _coords[r * _dim + i]; });
+        const auto current = _coords[*xmax * _dim + i] - _coords[*xmin * _dim + i];
+        if(current > spread)
+        {
+            spread = current;
+            axis = i;
+        }
+    }
+
+    // Split the points in the range at the median coordinate along the chosen axis
+    auto middle = begin + (end - begin) / 2;
+    std::nth_element(begin, middle, end,
+        [&](Index l, Index r) { return _coords[l * _dim + axis] < _coords[r * _dim + axis]; });
+
+    // Make sure points with same coordinate as the median are on the right subtree (as assumed in insert)
+    const auto xmedian = _coords[*middle * _dim + axis];
+    middle = std::partition(begin, middle,
+        [&](Index l) { return _coords[l * _dim + axis] < xmedian; });
+
+    const auto inode = *middle;
+
+    _nodes[inode].ipoint = inode;
+    _nodes[inode].axis = axis;
+    _nodes[inode].left = build(begin, middle);
+    _nodes[inode].right = build(middle + 1, end);
+
+    return inode;
+}
+
+} // namespace Reaktoro
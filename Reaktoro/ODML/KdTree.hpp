@@ -0,0 +1,101 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// A k-d tree used to find the nearest points to a given one among those inserted so far.
+class KdTree
+{
+public:
+    /// Construct a default instance of KdTree (with dimension zero, in which no point can be inserted).
+    KdTree();
+
+    /// Construct an instance of KdTree for points with given dimension.
+    /// @warning An exception is thrown if `dim` is zero.
+    explicit KdTree(Index dim);
+
+    /// Return the dimension of the points in the tree.
+    auto dim() const -> Index;
+
+    /// Return the number of points in the tree.
+    auto size() const -> Index;
+
+    /// Return the coordinates of a point in the tree.
+    /// @param ipoint The index of the point (in the order it was inserted).
+    auto point(Index ipoint) const -> VectorXdConstRef;
+
+    /// Remove all points from the tree.
+    auto clear() -> void;
+
+    /// Insert a new point in the tree (its index is the number of points before its insertion).
+    auto insert(VectorXdConstRef point) -> void;
+
+    /// Find the indices of the nearest points to a given one sorted in increasing order of distance.
+    /// @param point The point for which its nearest points are sought.
+    /// @param k The maximum number of nearest points to be found.
+    /// @param[out] indices The indices of the found nearest points.
+    auto nearest(VectorXdConstRef point, Index k, Vec<Index>& indices) const -> void;
+
+private:
+    /// The index used to indicate a non-existent node.
+    static constexpr auto npos = Index(-1);
+
+    /// The node of the tree associated with a point.
+    struct Node
+    {
+        /// The index of the point associated with this node.
+        Index ipoint = 0;
+
+        /// The coordinate of the point used to split the space into left and right subtrees.
+        Index axis = 0;
+
+        /// The index of the left child node (or `npos` if none).
+        Index left = npos;
+
+        /// The index of the right child node (or `npos` if none).
+        Index right = npos;
+    };
+
+    /// Rebuild the tree so that it becomes balanced.
+    auto rebuild() -> void;
+
+    /// Return the index of the root node of a balanced subtree for a given range of points.
+    auto build(Index* begin, Index* end) -> Index;
+
+    /// The dimension of the points in the tree.
+    Index _dim = 0;
+
+    /// The coordinates of the points in the tree stored contiguously.
+    Vec<double> _coords;
+
+    /// The nodes of the tree.
+    Vec<Node> _nodes;
+
+    /// The index of the root node of the tree.
+    Index _root = npos;
+
+    /// The number of points in the tree at which it is rebuilt to restore its balance.
+    Index _rebuild_size = 16;
+};
+
+} // namespace Reaktoro
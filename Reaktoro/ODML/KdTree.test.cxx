@@ -0,0 +1,107 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <algorithm>
+#include <numeric>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/ODML/KdTree.hpp>
+using namespace Reaktoro;
+
+// Return the indices of the nearest points to a given one computed with a brute force search.
+auto bruteForceNearest(Vec<VectorXd> const& points, VectorXd const& point, Index k) -> Vec<Index>
+{
+    Vec<Index> indices(points.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    std::stable_sort(indices.begin(), indices.end(),
+        [&](Index l, Index r) { return (points[l] - point).squaredNorm() < (points[r] - point).squaredNorm(); });
+    indices.resize(std::min(k, indices.size()));
+    return indices;
+}
+
+TEST_CASE("Testing KdTree", "[KdTree]")
+{
+    const auto dim = 5;
+
+    KdTree tree(dim);
+
+    CHECK( tree.dim() == dim );
+    CHECK( tree.size() == 0 );
+
+    Vec<Index> indices;
+
+    tree.nearest(VectorXd::Zero(dim), 3, indices);
+
+    CHECK( indices.empty() );
+
+    CHECK_THROWS( KdTree(0) );
+    CHECK_THROWS( KdTree().insert(VectorXd()) );
+
+    std::srand(0);
+
+    Vec<VectorXd> points;
+
+    // Insert random points, some of them clustered along a line to produce an unbalanced insertion order
+    for(auto i = 0; i < 300; ++i)
+    {
+        VectorXd point = (i % 3 == 0) ? VectorXd(VectorXd::Constant(dim, 0.01 * i)) : VectorXd(VectorXd::Random(dim));
+        points.push_back(point);
+        tree.insert(point);
+    }
+
+    // Insert duplicate points too
+    for(auto i = 0; i < 10; ++i)
+    {
+        points.push_back(points[i]);
+        tree.insert(points[i]);
+    }
+
+    CHECK( tree.size() == points.size() );
+
+    for(auto i = 0; i < points.size(); ++i)
+        CHECK( tree.point(i) == points[i] );
+
+    for(auto k : { 1, 5, 20, 400 })
+    {
+        for(auto j = 0; j < 50; ++j)
+        {
+            const VectorXd point = VectorXd::Random(dim);
+
+            tree.nearest(point, k, indices);
+
+            const auto expected = bruteForceNearest(points, point, k);
+
+            REQUIRE( indices.size() == expected.size() );
+
+            // Compare distances instead of indices because of the duplicate points
+            for(auto i = 0; i < indices.size(); ++i)
+                CHECK( (points[indices[i]] - point).squaredNorm() == Approx((points[expected[i]] - point).squaredNorm()) );
+        }
+    }
+
+    tree.clear();
+
+    CHECK( tree.size() == 0 );
+
+    tree.nearest(VectorXd::Zero(dim), 3, indices);
+
+    CHECK( indices.empty() );
+}
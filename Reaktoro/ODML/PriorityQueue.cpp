@@ -113,6 +113,19 @@ auto PriorityQueue::extend() -> void
     _order.push_back(_order.size());
 }
 
+auto PriorityQueue::remove(Index identity) -> void
+{
+    assert(identity < size());
+
+    _priorities.erase(_priorities.begin() + identity);
+
+    // Remove the entity from the order and shift the identities of the entities after it
+    _order.erase(std::find(_order.begin(), _order.end(), identity));
+    for(auto& i : _order)
+        if(i > identity)
+            i -= 1;
+}
+
 auto PriorityQueue::priorities() const -> Deque<Index> const&
 {
     return _priorities;
@@ -172,6 +172,7 @@ REAKTORO_DATA_ENCODE_DEFINE(StandardThermoModelParamsInterpolation)
     data["VT0"]          = obj.VT0;
     data["VP0"]          = obj.VP0;
     data["Cp0"]          = obj.Cp0;
+    data["Method"]       = obj.method;
 }
 
 REAKTORO_DATA_DECODE_DEFINE(StandardThermoModelParamsInterpolation)
@@ -184,6 +185,7 @@ REAKTORO_DATA_DECODE_DEFINE(StandardThermoModelParamsInterpolation)
     data.optional("VT0").to(obj.VT0);
     data.optional("VP0").to(obj.VP0);
     data.optional("Cp0").to(obj.Cp0);
+    data.optional("Method").to(obj.method);
 }
 
 //----------------------------------------------------------------------
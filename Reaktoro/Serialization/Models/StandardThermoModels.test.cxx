@@ -390,6 +390,11 @@ TEST_CASE("Testing serialization of StandardThermoModelParamsInterpolation", "[S
     CHECK( params.VT0.empty() );
     CHECK( params.VP0.empty() );
     CHECK( params.Cp0.empty() );
+    CHECK( params.method == "Bilinear" );
+
+    const auto cubic = Data::parse(yml + "Method: PiecewiseCubicLagrange").as<StandardThermoModelParamsInterpolation>();
+
+    CHECK( cubic.method == "PiecewiseCubicLagrange" );
 }
 
 TEST_CASE("Testing serialization of StandardThermoModelParamsNasa with polynomials", "[Serialization][Models][StandardThermoModels]")
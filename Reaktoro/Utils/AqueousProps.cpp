@@ -210,11 +210,10 @@ struct AqueousProps::Impl
         // The aqueous species in the aqueous phase
         auto const& aqspecies = phase.species();
 
-        // Collect the species from the database that contains the elements in the aqueous phase
-        const auto species_same_elements = system.database().species().withElements(symbols);
-
-        // Collect the non-aqueous species from the database that contains the elements in the aqueous phase
-        nonaqueous = removefn(species_same_elements, RKT_LAMBDA(x, x.aggregateState() == AggregateState::Aqueous));
+        // Collect the non-aqueous species from the database that contains the elements in the aqueous phase (one aggregate state at a time so that a lazy database creates only these species)
+        for(auto i = 0; i <= static_cast<int>(AggregateState::Undefined); ++i)
+            if(static_cast<AggregateState>(i) != AggregateState::Aqueous)
+                nonaqueous = concatenate(nonaqueous, system.database().speciesWithAggregateStateAndElements(static_cast<AggregateState>(i), symbols));
 
         // Ensure non-aqueous species are sorted by aggregate state (gases, solids, etc)
         std::sort(nonaqueous.begin(), nonaqueous.end(),
@@ -306,7 +305,7 @@ struct AqueousProps::Impl
         props = cprops;
 
         // Update the internal aqueous state object
-        aqstate = aqsolution.state(T, P, x);
+        aqsolution.state(T, P, x, aqstate);
 
         // Update auxiliary vector naq to be used in the echelonization below
         naq = aqprops.speciesAmounts();
@@ -52,6 +52,17 @@ auto convert(String const& mineral, MineralReactionRateModel const& model) -> Re
     };
 }
 
+/// Append the names of the phases on which the rate of a mineral reaction depends (the aqueous phase and the mineral phase).
+auto appendRateDependencies(String const& mineral, ReactionRateModelGeneratorArgs args) -> void
+{
+    const auto iaqueousphase = args.phases.findWithAggregateState(AggregateState::Aqueous);
+    const auto imineralphase = args.phases.findWithSpecies(mineral);
+    if(iaqueousphase < args.phases.size())
+        args.dependencies.push_back(args.phases[iaqueousphase].name());
+    if(imineralphase < args.phases.size())
+        args.dependencies.push_back(args.phases[imineralphase].name());
+}
+
 } // namespace detail
 
 MineralReaction::MineralReaction(String const& mineral)
@@ -65,8 +76,14 @@ auto MineralReaction::setRateModel(MineralReactionRateModel const& model) -> Min
 
 auto MineralReaction::setRateFunction(MineralReactionRateModel const& model) -> MineralReaction&
 {
-    ReactionRateModel converted = detail::convert(mineral(), model);
-    GeneralReaction::setRateModel(converted);
+    const auto mineralname = mineral();
+    ReactionRateModel converted = detail::convert(mineralname, model);
+    ReactionRateModelGenerator generator = [=](ReactionRateModelGeneratorArgs args)
+    {
+        detail::appendRateDependencies(mineralname, args);
+        return converted;
+    };
+    GeneralReaction::setRateModel(generator);
     return *this;
 }
 
@@ -76,6 +93,7 @@ auto MineralReaction::setRateModel(MineralReactionRateModelGenerator const& mode
     ReactionRateModelGenerator converted = [=](ReactionRateModelGeneratorArgs args)
     {
         MineralReactionRateModel model = model_generator(args);
+        detail::appendRateDependencies(mineralname, args);
         return detail::convert(mineralname, model);
     };
     GeneralReaction::setRateModel(converted);
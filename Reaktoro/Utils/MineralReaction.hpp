@@ -24,6 +24,12 @@
 namespace Reaktoro {
 
 /// The class used to configure mineral dissolution/precipitation reactions.
+/// Unless set with GeneralReaction::setRateDependencies, the rate of a mineral
+/// reaction is declared to depend on the aqueous phase and the mineral phase
+/// only, which are the phases used to compute the aqueous properties, the
+/// saturation ratio, and the surface area given to MineralReactionRateModel.
+/// Set the rate dependencies explicitly if the rate model or the surface area
+/// model of the mineral uses the properties of other phases.
 class MineralReaction : public GeneralReaction
 {
 public:
@@ -0,0 +1,66 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Extensions/Supcrt/SupcrtDatabase.hpp>
+#include <Reaktoro/Utils/MineralReaction.hpp>
+#include <Reaktoro/Utils/MineralSurface.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing MineralReaction", "[MineralReaction]")
+{
+    SupcrtDatabase db("supcrtbl");
+
+    MineralReactionRateModel ratefn = [](MineralReactionRateModelArgs args) { return args.area * (1.0 - args.Omega); };
+
+    MineralReactionRateModelGenerator rategen = [=](ReactionRateModelGeneratorArgs args) { return ratefn; };
+
+    auto createChemicalSystem = [&](auto const& reaction)
+    {
+        return ChemicalSystem(db,
+            AqueousPhase("H2O(aq) H+ OH- Ca+2 HCO3- CO2(aq) CO3-2"),
+            GaseousPhase("CO2(g)"),
+            MineralPhase("Calcite"),
+            MineralPhase("Quartz"),
+            reaction,
+            MineralSurface("Calcite", 1.0, "m2")
+        );
+    };
+
+    WHEN("MineralReaction is set with a rate function")
+    {
+        ChemicalSystem system = createChemicalSystem(MineralReaction("Calcite").setRateModel(ratefn));
+        CHECK( system.reaction(0).rateDependencies() == Strings{ "AqueousPhase", "Calcite" } );
+    }
+
+    WHEN("MineralReaction is set with a rate model generator")
+    {
+        ChemicalSystem system = createChemicalSystem(MineralReaction("Calcite").setRateModel(rategen));
+        CHECK( system.reaction(0).rateDependencies() == Strings{ "AqueousPhase", "Calcite" } );
+    }
+
+    WHEN("MineralReaction is set with explicit rate dependencies")
+    {
+        ChemicalSystem system = createChemicalSystem(MineralReaction("Calcite").setRateModel(ratefn).setRateDependencies("AqueousPhase GaseousPhase Calcite"));
+        CHECK( system.reaction(0).rateDependencies() == Strings{ "AqueousPhase", "GaseousPhase", "Calcite" } );
+    }
+}
@@ -23,6 +23,7 @@ using std::log;
 using std::pow;
 
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Water/WaterHelmholtzProps.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
 
@@ -147,6 +148,217 @@ const double E[] = { 0.3, 0.3 };
 template<typename T> auto pow2(T const& x) { return x*x; }
 template<typename T> auto pow3(T const& x) { return x*x*x; }
 
+/// The reduced Helmholtz free energy of water and its partial derivatives at many points.
+struct ReducedHelmholtzArrays
+{
+    ArrayXd phi, phi_d, phi_t, phi_dd, phi_tt, phi_dt, phi_ddd, phi_ttt, phi_dtt, phi_ddt;
+};
+
+/// Compute the reduced Helmholtz free energy of water and its partial derivatives at many points.
+/// The terms of the equation of state are evaluated for all points at once, so that
+/// the loops over the points can be vectorized. If `density_derivatives_only` is true,
+/// only the partial derivatives with respect to reduced density are computed.
+template<bool density_derivatives_only>
+auto reducedHelmholtzArrays(ArrayXdConstRef T, ArrayXdConstRef D, ReducedHelmholtzArrays& res) -> void
+{
+    const auto size = T.size();
+
+    const ArrayXd tau      = waterCriticalTemperature/T;
+    const ArrayXd delta    = D/waterCriticalDensity;
+    const ArrayXd logtau   = tau.log();
+    const ArrayXd logdelta = delta.log();
+    const ArrayXd invtau   = 1.0/tau;
+    const ArrayXd invdelta = 1.0/delta;
+
+    auto& [phi, phi_d, phi_t, phi_dd, phi_tt, phi_dt, phi_ddd, phi_ttt, phi_dtt, phi_ddt] = res;
+
+    for(auto array : { &phi, &phi_d, &phi_t, &phi_dd, &phi_tt, &phi_dt, &phi_ddd, &phi_ttt, &phi_dtt, &phi_ddt })
+        array->setZero(size);
+
+    // The contribution of the ideal-gas part of the reduced Helmholtz free energy
+    phi_d   =  invdelta;
+    phi_dd  = -invdelta.square();
+    phi_ddd =  2.0*invdelta.cube();
+
+    if constexpr(!density_derivatives_only)
+    {
+        phi     =  logdelta + no[1] + no[2]*tau + no[3]*logtau;
+        phi_t   =  no[2] + no[3]*invtau;
+        phi_tt  = -no[3]*invtau.square();
+        phi_ttt =  2.0*no[3]*invtau.cube();
+
+        for(int i = 4; i <= 8; ++i)
+        {
+            const int j = i - 4;
+
+            const ArrayXd ee = (gammao[j] * tau).exp();
+            const ArrayXd aux = gammao[j]/(ee - 1);
+
+            phi     += no[i] * (1.0 - 1.0/ee).log();
+            phi_t   += no[i] * aux;
+            phi_tt  -= no[i] * ee * aux.square();
+            phi_ttt += no[i] * ee * (1 + ee) * aux.cube();
+        }
+    }
+
+    // The contribution of the residual part of the reduced Helmholtz free energy
+    for(int i = 1; i <= 7; ++i)
+    {
+        const ArrayXd Ai    = n[i]*(d[i]*logdelta + t[i]*logtau).exp();
+        const ArrayXd A_d   = d[i]*invdelta * Ai;
+        const ArrayXd A_dd  = (d[i] - 1)*invdelta * A_d;
+        const ArrayXd A_ddd = (d[i] - 2)*invdelta * A_dd;
+
+        phi_d   += A_d;
+        phi_dd  += A_dd;
+        phi_ddd += A_ddd;
+
+        if constexpr(!density_derivatives_only)
+        {
+            const ArrayXd A_t   = t[i]*invtau * Ai;
+            const ArrayXd A_tt  = (t[i] - 1)*invtau * A_t;
+
+            phi     += Ai;
+            phi_t   += A_t;
+            phi_tt  += A_tt;
+            phi_dt  += t[i]*d[i]*invtau*invdelta * Ai;
+            phi_ttt += (t[i] - 2)*invtau * A_tt;
+            phi_dtt += d[i]*invdelta * A_tt;
+            phi_ddt += t[i]*invtau * A_dd;
+        }
+    }
+
+    for(int i = 8; i <= 51; ++i)
+    {
+        const ArrayXd dci   = (c[i]*logdelta).exp();
+        const ArrayXd aux   = d[i] - c[i]*dci - 1;
+        const ArrayXd Bi    = n[i]*(d[i]*logdelta + t[i]*logtau - dci).exp();
+        const ArrayXd B_d   = (aux + 1)*invdelta * Bi;
+        const ArrayXd B_dd  = aux*invdelta * B_d - dci*(c[i]*invdelta).square() * Bi;
+        const ArrayXd B_ddd = aux*invdelta * B_dd - (aux + 2*c[i]*c[i]*dci)*invdelta.square() * B_d - c[i]*c[i]*(c[i] - 2)*dci*invdelta.cube() * Bi;
+
+        phi_d   += B_d;
+        phi_dd  += B_dd;
+        phi_ddd += B_ddd;
+
+        if constexpr(!density_derivatives_only)
+        {
+            const ArrayXd B_t  = t[i]*invtau * Bi;
+            const ArrayXd B_tt = (t[i] - 1)*invtau * B_t;
+            const ArrayXd B_dt = t[i]*invtau * B_d;
+
+            phi     += Bi;
+            phi_t   += B_t;
+            phi_tt  += B_tt;
+            phi_dt  += B_dt;
+            phi_ttt += (t[i] - 2)*invtau * B_tt;
+            phi_dtt += (t[i] - 1)*invtau * B_dt;
+            phi_ddt += aux*invdelta * B_dt - c[i]*c[i]*dci*invdelta.square() * B_t;
+        }
+    }
+
+    for(int i = 52; i <= 54; ++i)
+    {
+        const int j = i - 52;
+
+        const ArrayXd aux1d = d[i]*invdelta - 2*alpha[j]*(delta - epsilon[j]);
+        const ArrayXd aux2d = d[i]*invdelta.square() + 2*alpha[j];
+
+        const ArrayXd Ci   = n[i]*(d[i]*logdelta + t[i]*logtau - alpha[j]*(delta - epsilon[j]).square() - beta[j]*(tau - gamma[j]).square()).exp();
+        const ArrayXd C_d  = aux1d * Ci;
+        const ArrayXd C_dd = aux1d * C_d - aux2d * Ci;
+
+        phi_d   += C_d;
+        phi_dd  += C_dd;
+        phi_ddd += aux1d * C_dd - 2*aux2d * C_d + 2*d[i]*invdelta.cube() * Ci;
+
+        if constexpr(!density_derivatives_only)
+        {
+            const ArrayXd aux1t = t[i]*invtau - 2*beta[j]*(tau - gamma[j]);
+            const ArrayXd aux2t = t[i]*invtau.square() + 2*beta[j];
+
+            const ArrayXd C_t  = aux1t * Ci;
+            const ArrayXd C_tt = aux1t * C_t - aux2t * Ci;
+            const ArrayXd C_dt = aux1d * aux1t * Ci;
+
+            phi     += Ci;
+            phi_t   += C_t;
+            phi_tt  += C_tt;
+            phi_dt  += C_dt;
+            phi_ttt += aux1t * C_tt - 2*aux2t * C_t + 2*t[i]*invtau.cube() * Ci;
+            phi_dtt += aux1t * C_dt - aux2t * C_d;
+            phi_ddt += aux1d * C_dt - aux2d * C_t;
+        }
+    }
+
+    for(int i = 55; i <= 56; ++i)
+    {
+        const int j = i - 55;
+
+        const ArrayXd dm1 = delta - 1;
+        const ArrayXd tm1 = tau - 1;
+        const ArrayXd dd  = dm1.square();
+        const ArrayXd tt  = tm1.square();
+
+        const ArrayXd theta     = -tm1 + A[j]*dd.pow(0.5/E[j]);
+        const ArrayXd theta_d   = (theta + tm1)/dm1/E[j];
+        const ArrayXd theta_dd  = (1.0/E[j] - 1) * theta_d/dm1;
+        const ArrayXd theta_ddd = (1.0/E[j] - 1) * (theta_dd/dm1 - theta_d/dd);
+
+        const ArrayXd psi     = (-C[j]*dd - F[j]*tt).exp();
+        const ArrayXd psi_d   = -2*C[j]*dm1 * psi;
+        const ArrayXd psi_t   = -2*F[j]*tm1 * psi;
+        const ArrayXd psi_dd  = -2*C[j]*(psi + dm1 * psi_d);
+        const ArrayXd psi_tt  = -2*F[j]*(psi + tm1 * psi_t);
+        const ArrayXd psi_dt  =  4*C[j]*F[j]*dm1*tm1 * psi;
+        const ArrayXd psi_ddd = -2*C[j]*(2*psi_d + dm1 * psi_dd);
+        const ArrayXd psi_ttt = -2*F[j]*(2*psi_t + tm1 * psi_tt);
+        const ArrayXd psi_dtt = -2*F[j]*(psi_d + tm1 * psi_dt);
+        const ArrayXd psi_ddt = -2*C[j]*(psi_t + dm1 * psi_dt);
+
+        const ArrayXd theta2    = theta.square();
+        const ArrayXd Delta     = theta2 + B[j]*dd.pow(a[j]);
+        const ArrayXd Delta_d   = 2*(theta*theta_d + a[j]*(Delta - theta2)/dm1);
+        const ArrayXd Delta_t   = -2*theta;
+        const ArrayXd Delta_dd  = 2*(theta_d.square() + theta*theta_dd + a[j] * ((Delta_d - 2*theta*theta_d)/dm1 - (Delta - theta2)/dd));
+        const double  Delta_tt  = 2;
+        const ArrayXd Delta_dt  = -2*theta_d;
+        const ArrayXd Delta_ddd = 2*(3*theta_d*theta_dd + theta*theta_ddd + a[j] * ((Delta_dd - 2*theta_d.square() - 2*theta*theta_dd)/dm1 - 2*(Delta_d - 2*theta*theta_d)/dd + 2*(Delta - theta2)/(dd*dm1)));
+        const ArrayXd Delta_ddt = -2*theta_dd;
+
+        const ArrayXd invDelta = 1.0/Delta;
+        const double bb1       = b[j]*(b[j] - 1);
+        const double bb2       = b[j]*(b[j] - 1)*(b[j] - 2);
+
+        const ArrayXd DeltaPow     = Delta.pow(b[j]);
+        const ArrayXd DeltaPow_d   = b[j]*Delta_d*invDelta * DeltaPow;
+        const ArrayXd DeltaPow_dd  = (b[j]*Delta_dd*invDelta + bb1*(Delta_d*invDelta).square()) * DeltaPow;
+        const ArrayXd DeltaPow_ddd = (b[j]*Delta_ddd*invDelta + 3*bb1*Delta_d*Delta_dd*invDelta.square() + bb2*(Delta_d*invDelta).cube()) * DeltaPow;
+
+        phi_d   += n[i]*(DeltaPow*(psi + delta*psi_d) + DeltaPow_d*delta*psi);
+        phi_dd  += n[i]*(DeltaPow*(2*psi_d + delta*psi_dd) + 2*DeltaPow_d*(psi + delta*psi_d) + DeltaPow_dd*delta*psi);
+        phi_ddd += n[i]*(DeltaPow_ddd*delta*psi + 3*DeltaPow_dd*(psi + delta*psi_d) + 3*DeltaPow_d*(2*psi_d + delta*psi_dd) + DeltaPow*(3*psi_dd + delta*psi_ddd));
+
+        if constexpr(!density_derivatives_only)
+        {
+            const ArrayXd DeltaPow_t   =  b[j]*Delta_t*invDelta * DeltaPow;
+            const ArrayXd DeltaPow_tt  = (b[j]*Delta_tt*invDelta + bb1*(Delta_t*invDelta).square()) * DeltaPow;
+            const ArrayXd DeltaPow_dt  = (b[j]*Delta_dt*invDelta + bb1*Delta_d*Delta_t*invDelta.square()) * DeltaPow;
+            const ArrayXd DeltaPow_ttt = (3*bb1*Delta_t*Delta_tt*invDelta.square() + bb2*(Delta_t*invDelta).cube()) * DeltaPow;
+            const ArrayXd DeltaPow_dtt = (bb1*(Delta_d*Delta_tt + 2*Delta_t*Delta_dt)*invDelta.square() + bb2*Delta_t*Delta_t*Delta_d*invDelta.cube()) * DeltaPow;
+            const ArrayXd DeltaPow_ddt = (b[j]*Delta_ddt*invDelta + bb1*(Delta_t*Delta_dd + 2*Delta_d*Delta_dt)*invDelta.square() + bb2*Delta_d*Delta_d*Delta_t*invDelta.cube()) * DeltaPow;
+
+            phi     += n[i]*DeltaPow*delta*psi;
+            phi_t   += n[i]*delta*(DeltaPow_t*psi + DeltaPow*psi_t);
+            phi_tt  += n[i]*delta*(DeltaPow_tt*psi + 2*DeltaPow_t*psi_t + DeltaPow*psi_tt);
+            phi_dt  += n[i]*(DeltaPow*(psi_t + delta*psi_dt) + delta*DeltaPow_d*psi_t + DeltaPow_t*(psi + delta*psi_d) + DeltaPow_dt*delta*psi);
+            phi_ttt += n[i]*delta*(DeltaPow_ttt*psi + 3*DeltaPow_tt*psi_t + 3*DeltaPow_t*psi_tt + DeltaPow*psi_ttt);
+            phi_dtt += n[i]*(DeltaPow_tt*psi + 2*DeltaPow_t*psi_t + DeltaPow*psi_tt) + n[i]*delta*(DeltaPow_dtt*psi + DeltaPow_tt*psi_d + 2*DeltaPow_dt*psi_t + 2*DeltaPow_t*psi_dt + DeltaPow_d*psi_tt + DeltaPow*psi_dtt);
+            phi_ddt += n[i]*(DeltaPow_ddt*delta*psi + 2*DeltaPow_dt*(psi + delta*psi_d) + DeltaPow_dd*delta*psi_t + DeltaPow_t*(2*psi_d + delta*psi_dd) + 2*DeltaPow_d*(psi_t + delta*psi_dt) + DeltaPow*(2*psi_dt + delta*psi_ddt));
+        }
+    }
+}
+
 } // namespace
 
 auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps
@@ -389,4 +601,77 @@ auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps
     return res;
 }
 
+auto waterHelmholtzPropsWagnerPruss(ArrayXdConstRef T, ArrayXdConstRef D) -> Vec<WaterHelmholtzProps>
+{
+    errorif(T.size() != D.size(), "Expecting arrays of temperatures and densities with the same size in waterHelmholtzPropsWagnerPruss.");
+
+    ReducedHelmholtzArrays phi;
+    reducedHelmholtzArrays<false>(T, D, phi);
+
+    const auto Tcr = waterCriticalTemperature;
+    const auto Dcr = waterCriticalDensity;
+
+    // The specific gas constant in units of J/(kg*K)
+    const auto R = 461.51805;
+
+    const auto dD = 1/Dcr;
+
+    const auto size = T.size();
+
+    Vec<WaterHelmholtzProps> res(size);
+
+    for(auto k = 0; k < size; ++k)
+    {
+        const auto Tk = T[k];
+
+        const auto tT   = -Tcr/(Tk*Tk);
+        const auto tTT  =  2*Tcr/(Tk*Tk*Tk);
+        const auto tTTT = -6*Tcr/(Tk*Tk*Tk*Tk);
+
+        const auto phiT   = phi.phi_t[k]*tT;
+        const auto phiD   = phi.phi_d[k]*dD;
+        const auto phiTT  = phi.phi_tt[k]*tT*tT + phi.phi_t[k]*tTT;
+        const auto phiTD  = phi.phi_dt[k]*tT*dD;
+        const auto phiDD  = phi.phi_dd[k]*dD*dD;
+        const auto phiTTT = phi.phi_ttt[k]*tT*tT*tT + 3*phi.phi_tt[k]*tT*tTT + phi.phi_t[k]*tTTT;
+        const auto phiTTD = phi.phi_dtt[k]*tT*tT*dD + phi.phi_dt[k]*tTT*dD;
+        const auto phiTDD = phi.phi_ddt[k]*tT*dD*dD;
+        const auto phiDDD = phi.phi_ddd[k]*dD*dD*dD;
+
+        auto& r = res[k];
+
+        r.helmholtz    = R*Tk*phi.phi[k];
+        r.helmholtzT   = R*Tk*phiT + R*phi.phi[k];
+        r.helmholtzD   = R*Tk*phiD;
+        r.helmholtzTT  = R*Tk*phiTT + 2*R*phiT;
+        r.helmholtzTD  = R*Tk*phiTD + R*phiD;
+        r.helmholtzDD  = R*Tk*phiDD;
+        r.helmholtzTTT = R*Tk*phiTTT + 3*R*phiTT;
+        r.helmholtzTTD = R*Tk*phiTTD + 2*R*phiTD;
+        r.helmholtzTDD = R*Tk*phiTDD + R*phiDD;
+        r.helmholtzDDD = R*Tk*phiDDD;
+    }
+
+    return res;
+}
+
+auto waterHelmholtzDensityDerivativesWagnerPruss(ArrayXdConstRef T, ArrayXdConstRef D, ArrayXdRef helmholtzD, ArrayXdRef helmholtzDD, ArrayXdRef helmholtzDDD) -> void
+{
+    errorif(T.size() != D.size(), "Expecting arrays of temperatures and densities with the same size in waterHelmholtzDensityDerivativesWagnerPruss.");
+
+    ReducedHelmholtzArrays phi;
+    reducedHelmholtzArrays<true>(T, D, phi);
+
+    const auto Dcr = waterCriticalDensity;
+
+    // The specific gas constant in units of J/(kg*K)
+    const auto R = 461.51805;
+
+    const auto dD = 1/Dcr;
+
+    helmholtzD   = R*T*phi.phi_d*dD;
+    helmholtzDD  = R*T*phi.phi_dd*dD*dD;
+    helmholtzDDD = R*T*phi.phi_ddd*dD*dD*dD;
+}
+
 } // namespace Reaktoro
@@ -18,7 +18,9 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Real.hpp>
+#include <Reaktoro/Common/Types.hpp>
 
 namespace Reaktoro {
 
@@ -32,4 +34,21 @@ struct WaterHelmholtzProps;
 /// @see WaterHelmholtzProps
 auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps;
 
+/// Calculate the Helmholtz free energy states of water at many points using the Wagner and Pruss (1995) equation of state
+/// The terms of the equation of state are evaluated for all points at once, in loops over the points that can be vectorized.
+/// @param T The temperatures of water (in units of K)
+/// @param D The densities of water (in units of kg/m3)
+/// @return The Helmholtz free energy states of water at each point
+/// @see WaterHelmholtzProps
+auto waterHelmholtzPropsWagnerPruss(ArrayXdConstRef T, ArrayXdConstRef D) -> Vec<WaterHelmholtzProps>;
+
+/// Calculate the partial derivatives of the specific Helmholtz free energy of water with respect to density at many points using the Wagner and Pruss (1995) equation of state
+/// These are the derivatives needed to compute the density of water at given temperatures and pressures using Newton's method.
+/// @param T The temperatures of water (in units of K)
+/// @param D The densities of water (in units of kg/m3)
+/// @param[out] helmholtzD The first-order partial derivatives with respect to density at each point
+/// @param[out] helmholtzDD The second-order partial derivatives with respect to density at each point
+/// @param[out] helmholtzDDD The third-order partial derivatives with respect to density at each point
+auto waterHelmholtzDensityDerivativesWagnerPruss(ArrayXdConstRef T, ArrayXdConstRef D, ArrayXdRef helmholtzD, ArrayXdRef helmholtzDD, ArrayXdRef helmholtzDDD) -> void;
+
 } // namespace Reaktoro
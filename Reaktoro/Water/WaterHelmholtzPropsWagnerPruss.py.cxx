@@ -25,5 +25,6 @@ using namespace Reaktoro;
 
 void exportWaterHelmholtzPropsWagnerPruss(py::module& m)
 {
-    m.def("waterHelmholtzPropsWagnerPruss", waterHelmholtzPropsWagnerPruss);
+    m.def("waterHelmholtzPropsWagnerPruss", py::overload_cast<real, real>(waterHelmholtzPropsWagnerPruss));
+    m.def("waterHelmholtzPropsWagnerPruss", py::overload_cast<ArrayXdConstRef, ArrayXdConstRef>(waterHelmholtzPropsWagnerPruss));
 }
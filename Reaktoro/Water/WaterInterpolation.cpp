@@ -18,12 +18,12 @@
 #include "WaterInterpolation.hpp"
 
 // C++ includes
-#include <sstream>
+#include <algorithm>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/InterpolationUtils.hpp>
-#include <Reaktoro/Core/Embedded.hpp>
+#include <Reaktoro/Water/WaterInterpolationData.hpp>
 #include <Reaktoro/Water/WaterThermoProps.hpp>
 
 namespace Reaktoro {
@@ -238,59 +238,56 @@ auto waterDensityWagnerPrussInterp(real const& T, real const& P, StateOfMatter s
     return interpolateQuadratic(PMPa, P0, P1, P2, D0, D1, D2);
 }
 
-auto parseWaterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<WaterThermoProps>>
-{
-    // TODO: Use som here to distinguish different data files to fetch interpolation data. This data must be regenerated for liquid and vapor states.
-    const auto text = Embedded::get("interpolation/WaterThermoPropsWagnerPruss.txt");
-    std::istringstream file(text);
-    String line;
+namespace {
 
-    Vec<Vec<WaterThermoProps>> data;
+/// Return a pointer to the pre-computed thermodynamic properties of water at given pressure row and temperature column of the interpolation data.
+auto waterInterpDataEntry(Index iP, Index iT) -> double const*
+{
+    return waterInterpDataTable + (waterInterpDataOffsets[iP] + iT) * waterInterpDataNumProps;
+}
 
-    while(std::getline(file, line))
+/// Return the weights of the quadratic interpolation at *x* with given points *x0*, *x1* and *x2* (consistent with @ref interpolateQuadratic).
+auto quadraticWeights(real const& x, double x0, double x1, double x2) -> Array<real, 3>
+{
+    if(x0 == x1 || x1 == x2)
     {
-        if(line[0] == 'P')
-        {
-            data.push_back(Vec<WaterThermoProps>());
-        }
-        else
-        {
-            std::istringstream ss(line);
-
-            WaterThermoProps props;
-
-            ss >> props.T.val()
-               >> props.V.val()
-               >> props.S.val()
-               >> props.A.val()
-               >> props.U.val()
-               >> props.H.val()
-               >> props.G.val()
-               >> props.Cv.val()
-               >> props.Cp.val()
-               >> props.D.val()
-               >> props.DT.val()
-               >> props.DP.val()
-               >> props.DTT.val()
-               >> props.DTP.val()
-               >> props.DPP.val()
-               >> props.P.val()
-               >> props.PT.val()
-               >> props.PD.val()
-               >> props.PTT.val()
-               >> props.PTD.val()
-               >> props.PDD.val();
-
-            data.back().push_back(props);
-        }
+        if(x0 == x2) return {{ 1.0, 0.0, 0.0 }};
+        const real l2 = (x - x0)/(x2 - x0);
+        return {{ 1.0 - l2, 0.0, l2 }};
     }
+    const real l0 = ((x - x1)*(x - x2))/((x0 - x1)*(x0 - x2));
+    const real l1 = ((x - x0)*(x - x2))/((x1 - x0)*(x1 - x2));
+    const real l2 = ((x - x0)*(x - x1))/((x2 - x0)*(x2 - x1));
+    return {{ l0, l1, l2 }};
+}
 
+/// Return a WaterThermoProps object with properties given in the same order as its data members.
+template<typename Values>
+auto toWaterThermoProps(Values const& v) -> WaterThermoProps
+{
+    return { v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8], v[9], v[10], v[11], v[12], v[13], v[14], v[15], v[16], v[17], v[18], v[19], v[20] };
+}
+
+/// Return the pre-computed thermodynamic properties of water used for interpolation as WaterThermoProps objects.
+auto createWaterThermoPropsWagnerPrussInterpData() -> Vec<Vec<WaterThermoProps>>
+{
+    Vec<Vec<WaterThermoProps>> data(waterInterpDataNumPressures);
+    for(auto iP = 0; iP < waterInterpDataNumPressures; ++iP)
+    {
+        const auto size = waterInterpDataOffsets[iP + 1] - waterInterpDataOffsets[iP];
+        data[iP].reserve(size);
+        for(auto iT = 0; iT < size; ++iT)
+            data[iP].push_back(toWaterThermoProps(waterInterpDataEntry(iP, iT)));
+    }
     return data;
 }
 
+} // namespace
+
 auto waterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<WaterThermoProps>> const&
 {
-    thread_local Vec<Vec<WaterThermoProps>> data = parseWaterThermoPropsWagnerPrussInterpData(som);
+    // TODO: Use som here to distinguish different data sets for interpolation. This data must be regenerated for liquid and vapor states.
+    static const Vec<Vec<WaterThermoProps>> data = createWaterThermoPropsWagnerPrussInterpData();
     return data;
 }
 
@@ -308,12 +305,12 @@ auto waterThermoPropsWagnerPrussInterp(real const& T, real const& P, StateOfMatt
     const Index iP1 = iPmax > 1 ? iP0 + 1 : 0;
     const Index iP2 = iPmax > 0 ? iP1 + 1 : 0;
 
-    auto const& data = waterThermoPropsWagnerPrussInterpData(som);
+    // The interpolated properties, accumulated directly from the entries of the flat interpolation table
+    Array<real, waterInterpDataNumProps> props = {};
 
-    auto interpolateAtT = [&](Index indexP)
+    auto interpolateAtT = [&](Index indexP, real const& weightP)
     {
         auto const& Ts = temperatures[indexP];
-        auto const& Ds = data[indexP];
 
         const Index iT = std::lower_bound(Ts.begin(), Ts.end(), T) - Ts.begin();
 
@@ -325,18 +322,24 @@ auto waterThermoPropsWagnerPrussInterp(real const& T, real const& P, StateOfMatt
         const Index iT1 = iT0 + 1;
         const Index iT2 = iT0 + 2;
 
-        return interpolateQuadratic(T, Ts[iT0], Ts[iT1], Ts[iT2], Ds[iT0], Ds[iT1], Ds[iT2]);
+        const auto weightsT = quadraticWeights(T, Ts[iT0], Ts[iT1], Ts[iT2]);
+
+        for(auto j = 0; j < 3; ++j)
+        {
+            const real weight = weightP * weightsT[j];
+            const auto entry = waterInterpDataEntry(indexP, iT0 + j);
+            for(auto k = 0; k < waterInterpDataNumProps; ++k)
+                props[k] += weight * entry[k];
+        }
     };
 
-    const auto P0 = pressures[iP0];
-    const auto P1 = pressures[iP1];
-    const auto P2 = pressures[iP2];
+    const auto weightsP = quadraticWeights(PMPa, pressures[iP0], pressures[iP1], pressures[iP2]);
 
-    const auto D0 = interpolateAtT(iP0); // density at T and P=P0
-    const auto D1 = interpolateAtT(iP1); // density at T and P=P1
-    const auto D2 = interpolateAtT(iP2); // density at T and P=P2
+    interpolateAtT(iP0, weightsP[0]); // contribution of the properties at T and P=P0
+    interpolateAtT(iP1, weightsP[1]); // contribution of the properties at T and P=P1
+    interpolateAtT(iP2, weightsP[2]); // contribution of the properties at T and P=P2
 
-    return interpolateQuadratic(PMPa, P0, P1, P2, D0, D1, D2);
+    return toWaterThermoProps(props);
 }
 
 } // namespace Reaktoro
@@ -51,7 +51,8 @@ auto waterThermoPropsWagnerPrussInterp(real const& T, real const& P, StateOfMatt
 /// shown in Table 13.2 of *Wagner, W., Pruss, A. (2002). The IAPWS Formulation 1995 for the
 /// Thermodynamic Properties of Ordinary Water Substance for General and Scientific Use. Journal of
 /// Physical and Chemical Reference Data, 31(2), 387. https://doi.org/10.1063/1.1461829*.
-/// @note The first call to this function will trigger a parsing operation of embedded text data.
+/// @note The interpolation data is compiled into Reaktoro in a flat array with static storage (see
+/// WaterInterpolationData.hpp). The first call to this function copies it into the returned container.
 /// @param som The desired state of matter for water (the actual state of matter may end up being different!)
 auto waterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<WaterThermoProps>> const&;
 
@@ -102,3 +102,24 @@ TEST_CASE("Testing water interpolation methods", "[WaterInterpolation]")
 
     // TODO: To reduce errors above (note the 4.17% error at 723K and 125MPa), more refinement in the interpolation grid is needed.
 }
+
+TEST_CASE("Testing water interpolation data", "[WaterInterpolation]")
+{
+    auto const& data = waterThermoPropsWagnerPrussInterpData(StateOfMatter::Liquid);
+
+    REQUIRE( data.size() == 31 );
+
+    // The second pressure row in the interpolation data corresponds to 0.1 MPa
+    for(auto const& props : data[1])
+    {
+        CHECK( props.P.val() == Approx(0.1e6) );
+
+        // Interpolation at the points of the interpolation data must reproduce the data itself
+        const auto actual = waterThermoPropsWagnerPrussInterp(props.T, props.P, StateOfMatter::Liquid);
+
+        CHECK( actual.T.val()  == Approx(props.T.val()) );
+        CHECK( actual.D.val()  == Approx(props.D.val()) );
+        CHECK( actual.H.val()  == Approx(props.H.val()) );
+        CHECK( actual.Cp.val() == Approx(props.Cp.val()) );
+    }
+}
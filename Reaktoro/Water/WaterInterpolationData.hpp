@@ -0,0 +1,43 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// The number of pressure rows in the pre-computed thermodynamic properties of water used for interpolation.
+constexpr Index waterInterpDataNumPressures = 31;
+
+/// The number of thermodynamic properties of water stored for each temperature and pressure in the interpolation data.
+/// These are stored in the same order as the data members of WaterThermoProps, starting with `T` and ending with `PDD`.
+constexpr Index waterInterpDataNumProps = 21;
+
+/// The pre-computed thermodynamic properties of water (Wagner and Pruss, 2002) used for interpolation.
+/// This array is generated at build time from `embedded/interpolation/WaterThermoPropsWagnerPruss.txt`.
+/// Its entries are stored contiguously, pressure row after pressure row, with waterInterpDataNumProps
+/// values per entry. The entries of the pressure row `i` range from `waterInterpDataOffsets[i]` to
+/// `waterInterpDataOffsets[i + 1]` (exclusive).
+extern const double waterInterpDataTable[];
+
+/// The offsets of the pressure rows in the pre-computed thermodynamic properties of water used for interpolation.
+/// @see waterInterpDataTable
+extern const Index waterInterpDataOffsets[];
+
+} // namespace Reaktoro
@@ -86,6 +86,18 @@ auto waterThermoPropsWagnerPruss(real const& T, real const& P, StateOfMatter som
     return waterThermoProps(T, P, whp);
 }
 
+auto waterThermoPropsWagnerPruss(ArrayXdConstRef T, ArrayXdConstRef P, StateOfMatter som) -> Vec<WaterThermoProps>
+{
+    const ArrayXd D = waterDensityWagnerPruss(T, P, som);
+    const Vec<WaterHelmholtzProps> whps = waterHelmholtzPropsWagnerPruss(T, D);
+    const auto size = T.size();
+    Vec<WaterThermoProps> wts;
+    wts.reserve(size);
+    for(auto k = 0; k < size; ++k)
+        wts.push_back(waterThermoProps(T[k], P[k], whps[k]));
+    return wts;
+}
+
 auto waterThermoPropsWagnerPrussMemoized(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
 {
     static thread_local auto fn = createMemoizedWaterThermoPropsFnWagnerPruss();
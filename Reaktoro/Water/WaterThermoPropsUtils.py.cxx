@@ -27,7 +27,8 @@ using namespace Reaktoro;
 void exportWaterThermoPropsUtils(py::module& m)
 {
     m.def("waterThermoPropsHGK", waterThermoPropsHGK, "Calculate the thermodynamic properties of water using the Haar-Gallagher-Kell (1984) equation of state.");
-    m.def("waterThermoPropsWagnerPruss", waterThermoPropsWagnerPruss, "Calculate the thermodynamic properties of water using the Haar-Gallagher-Kell (1984) equation of state.");
+    m.def("waterThermoPropsWagnerPruss", py::overload_cast<real const&, real const&, StateOfMatter>(waterThermoPropsWagnerPruss), "Calculate the thermodynamic properties of water using the Haar-Gallagher-Kell (1984) equation of state.");
+    m.def("waterThermoPropsWagnerPruss", py::overload_cast<ArrayXdConstRef, ArrayXdConstRef, StateOfMatter>(waterThermoPropsWagnerPruss), "Calculate the thermodynamic properties of water at many temperatures and pressures using the Wagner and Pruss (1995) equation of state.");
     m.def("waterThermoPropsHGKMemoized", waterThermoPropsHGKMemoized, "Calculate the thermodynamic properties of water using the Wagner and Pruss (1995) equation of state.");
     m.def("waterThermoPropsWagnerPrussMemoized", waterThermoPropsWagnerPrussMemoized, "Calculate the thermodynamic properties of water using the Wagner and Pruss (1995) equation of state.");
     m.def("waterThermoPropsWagnerPrussInterpMemoized", waterThermoPropsWagnerPrussInterpMemoized, "Calculate the thermodynamic properties of water using interpolation of pre-computed properties using the Wagner and Pruss (1995) equation of state.");
@@ -26,6 +26,7 @@ using std::pow;
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
 #include <Reaktoro/Water/WaterHelmholtzProps.hpp>
 #include <Reaktoro/Water/WaterHelmholtzPropsHGK.hpp>
@@ -92,7 +93,76 @@ auto waterVaporDensityHGK(real const& T, real const& P) -> real
 
 auto waterDensityWagnerPruss(real const& T, real const& P, StateOfMatter stateofmatter) -> real
 {
-    return waterDensity(T, P, waterHelmholtzPropsWagnerPruss, stateofmatter);
+    const auto model = [](real const& T, real const& D) { return waterHelmholtzPropsWagnerPruss(T, D); };
+    return waterDensity(T, P, model, stateofmatter);
+}
+
+auto waterDensityWagnerPruss(ArrayXdConstRef T, ArrayXdConstRef P, StateOfMatter stateofmatter) -> ArrayXd
+{
+    errorif(T.size() != P.size(), "Expecting arrays of temperatures and pressures with the same size in waterDensityWagnerPruss.");
+
+    // Auxiliary constants for the Newton's iterations
+    const auto max_iters = 100;
+    const auto tolerance = 1.0e-06;
+
+    const auto size = T.size();
+
+    // Determine an adequate initial guess for density at each point based on the desired physical state of water
+    ArrayXd D(size);
+    for(auto k = 0; k < size; ++k)
+        D[k] = waterDensityWagnerPrussInterp(T[k], P[k], stateofmatter).val();
+
+    // The indices of the points whose Newton's iterations have not yet converged
+    Indices active(size);
+    for(auto k = 0; k < size; ++k)
+        active[k] = k;
+
+    ArrayXd Ta, Pa, Da, AD, ADD, ADDD;
+
+    for(int i = 1; i <= max_iters && !active.empty(); ++i)
+    {
+        const auto num_active = active.size();
+
+        Ta = T(active);
+        Pa = P(active);
+        Da = D(active);
+
+        AD.resize(num_active);
+        ADD.resize(num_active);
+        ADDD.resize(num_active);
+
+        // Evaluate the Helmholtz free energy density derivatives at all active points in a single pass
+        waterHelmholtzDensityDerivativesWagnerPruss(Ta, Da, AD, ADD, ADDD);
+
+        auto j = 0; // the number of points still active after this iteration
+
+        for(auto k = 0; k < num_active; ++k)
+        {
+            auto& Dk = D[active[k]];
+
+            const auto F = Dk*Dk*AD[k]/Pa[k] - 1;
+            const auto FD = (2*Dk*AD[k] + Dk*Dk*ADD[k])/Pa[k];
+            const auto FDD = (2*AD[k] + 4*Dk*ADD[k] + Dk*Dk*ADDD[k])/Pa[k];
+
+            const auto g = F*FD;
+            const auto H = FD*FD + F*FDD;
+
+            if(Dk > g/H)
+                Dk -= g/H;
+            else if(Dk > F/FD)
+                Dk -= F/FD;
+            else Dk *= 0.1;
+
+            if(!(std::abs(F) < tolerance || std::abs(g) < tolerance))
+                active[j++] = active[k];
+        }
+
+        active.resize(j);
+    }
+
+    errorif(!active.empty(), "Unable to calculate the density of water because the calculations did not converge at temperature ", T[active.front()], " K and pressure ", P[active.front()], " Pa.");
+
+    return D;
 }
 
 auto waterLiquidDensityWagnerPruss(real const& T, real const& P) -> real
@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Real.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
 
@@ -37,6 +38,15 @@ auto waterDensityHGK(real const& T, real const& P, StateOfMatter stateofmatter)
 /// @return The density of liquid water (in kg/m3)
 auto waterDensityWagnerPruss(real const& T, real const& P, StateOfMatter stateofmatter) -> real;
 
+/// Calculate the densities of water at many temperatures and pressures using the Wagner and Pruss (1995) equation of state
+/// The Newton's iterations for all points are performed in lockstep, with the equation of state evaluated
+/// at once for all points that have not yet converged. The densities are computed without derivatives.
+/// @param T The temperatures of water (in K)
+/// @param P The pressures of water (in Pa)
+/// @param stateofmatter The state of matter of water
+/// @return The densities of water at each point (in kg/m3)
+auto waterDensityWagnerPruss(ArrayXdConstRef T, ArrayXdConstRef P, StateOfMatter stateofmatter) -> ArrayXd;
+
 /// Calculate the density of liquid water using the Haar--Gallagher--Kell (1984) equation of state
 /// @param T The temperature of water (in K)
 /// @param P The pressure of water (in Pa)
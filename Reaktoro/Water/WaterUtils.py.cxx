@@ -25,7 +25,8 @@ using namespace Reaktoro;
 void exportWaterUtils(py::module& m)
 {
     m.def("waterDensityHGK", waterDensityHGK);
-    m.def("waterDensityWagnerPruss", waterDensityWagnerPruss);
+    m.def("waterDensityWagnerPruss", py::overload_cast<real const&, real const&, StateOfMatter>(waterDensityWagnerPruss));
+    m.def("waterDensityWagnerPruss", py::overload_cast<ArrayXdConstRef, ArrayXdConstRef, StateOfMatter>(waterDensityWagnerPruss));
     m.def("waterLiquidDensityHGK", waterLiquidDensityHGK);
     m.def("waterLiquidDensityWagnerPruss", waterLiquidDensityWagnerPruss);
     m.def("waterVaporDensityHGK", waterVaporDensityHGK);
@@ -19,6 +19,10 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Water/WaterHelmholtzProps.hpp>
+#include <Reaktoro/Water/WaterHelmholtzPropsWagnerPruss.hpp>
+#include <Reaktoro/Water/WaterThermoProps.hpp>
+#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
 #include <Reaktoro/Water/WaterUtils.hpp>
 using namespace Reaktoro;
 
@@ -41,3 +45,58 @@ TEST_CASE("Testing water utility methods", "[WaterUtils]")
     CHECK( waterDensityWagnerPruss(T + 400, P, StateOfMatter::Liquid) == Approx(0.322301) );
     CHECK( waterDensityWagnerPruss(T + 500, P, StateOfMatter::Liquid) == Approx(0.280463) );
 }
+
+TEST_CASE("Testing water utility methods evaluated at many points at once", "[WaterUtils]")
+{
+    ArrayXd T(8), P(8);
+    T << 273.15, 298.15, 323.15, 373.15, 473.15, 573.15, 623.15, 773.15;
+    P << 1.0e5,  1.0e5,  5.0e6,  1.0e7,  2.0e7,  5.0e7,  1.0e8,  1.0e5;
+
+    const auto N = T.size();
+
+    for(auto som : { StateOfMatter::Liquid, StateOfMatter::Gas })
+    {
+        const ArrayXd D = waterDensityWagnerPruss(T, P, som);
+
+        REQUIRE( D.size() == N );
+
+        for(auto k = 0; k < N; ++k)
+            CHECK( D[k] == Approx(waterDensityWagnerPruss(T[k], P[k], som).val()) );
+
+        const Vec<WaterHelmholtzProps> whps = waterHelmholtzPropsWagnerPruss(T, D);
+
+        REQUIRE( whps.size() == N );
+
+        for(auto k = 0; k < N; ++k)
+        {
+            const WaterHelmholtzProps expected = waterHelmholtzPropsWagnerPruss(T[k], D[k]);
+            CHECK( whps[k].helmholtz.val()    == Approx(expected.helmholtz.val()) );
+            CHECK( whps[k].helmholtzT.val()   == Approx(expected.helmholtzT.val()) );
+            CHECK( whps[k].helmholtzD.val()   == Approx(expected.helmholtzD.val()) );
+            CHECK( whps[k].helmholtzTT.val()  == Approx(expected.helmholtzTT.val()) );
+            CHECK( whps[k].helmholtzTD.val()  == Approx(expected.helmholtzTD.val()) );
+            CHECK( whps[k].helmholtzDD.val()  == Approx(expected.helmholtzDD.val()) );
+            CHECK( whps[k].helmholtzTTT.val() == Approx(expected.helmholtzTTT.val()) );
+            CHECK( whps[k].helmholtzTTD.val() == Approx(expected.helmholtzTTD.val()) );
+            CHECK( whps[k].helmholtzTDD.val() == Approx(expected.helmholtzTDD.val()) );
+            CHECK( whps[k].helmholtzDDD.val() == Approx(expected.helmholtzDDD.val()) );
+        }
+
+        const Vec<WaterThermoProps> wts = waterThermoPropsWagnerPruss(T, P, som);
+
+        REQUIRE( wts.size() == N );
+
+        for(auto k = 0; k < N; ++k)
+        {
+            const WaterThermoProps expected = waterThermoPropsWagnerPruss(T[k], P[k], som);
+            CHECK( wts[k].D.val()  == Approx(expected.D.val()) );
+            CHECK( wts[k].V.val()  == Approx(expected.V.val()) );
+            CHECK( wts[k].S.val()  == Approx(expected.S.val()) );
+            CHECK( wts[k].H.val()  == Approx(expected.H.val()) );
+            CHECK( wts[k].G.val()  == Approx(expected.G.val()) );
+            CHECK( wts[k].Cp.val() == Approx(expected.Cp.val()) );
+            CHECK( wts[k].DT.val() == Approx(expected.DT.val()) );
+            CHECK( wts[k].DP.val() == Approx(expected.DP.val()) );
+        }
+    }
+}
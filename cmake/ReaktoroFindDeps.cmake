@@ -42,6 +42,9 @@ ReaktoroFindPackage(ThermoFun 0.4.5 REQUIRED)
 ReaktoroFindPackage(tsl-ordered-map 1.0.0 REQUIRED)
 ReaktoroFindPackage(yaml-cpp 0.6.3 REQUIRED)
 
+# Required system dependencies
+find_package(Threads REQUIRED)
+
 # Optional dependencies
 ReaktoroFindPackage(Catch2 2.6.2)
 ReaktoroFindPackage(Python COMPONENTS Interpreter Development)
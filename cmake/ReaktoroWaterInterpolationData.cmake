@@ -0,0 +1,61 @@
+# Generate a C++ source file with the pre-computed thermodynamic properties of
+# water used for interpolation, stored in a flat array with static storage.
+#
+# This script converts the text file
+# embedded/interpolation/WaterThermoPropsWagnerPruss.txt, in which each block of
+# lines starting with `P = ...` contains the properties of water along a
+# pressure row, into arrays that are compiled into Reaktoro. This avoids
+# parsing the text file at runtime when water properties are interpolated.
+#
+# Usage:
+#
+#     cmake -DINPUT=<path to txt file> -DOUTPUT=<path to cpp file> -P ReaktoroWaterInterpolationData.cmake
+
+if(NOT INPUT OR NOT OUTPUT)
+    message(FATAL_ERROR "Expecting INPUT and OUTPUT variables when generating the water interpolation data.")
+endif()
+
+file(STRINGS ${INPUT} lines)
+
+set(values "")
+set(offsets "0")
+set(numentries 0)
+set(numrows 0)
+
+foreach(line IN LISTS lines)
+    if(line MATCHES "^P")
+        if(numrows GREATER 0)
+            string(APPEND offsets ", ${numentries}")
+        endif()
+        math(EXPR numrows "${numrows} + 1")
+    elseif(NOT line STREQUAL "")
+        string(STRIP "${line}" line)
+        string(REGEX REPLACE "[ \t]+" ", " line "${line}")
+        string(APPEND values "    ${line},\n")
+        math(EXPR numentries "${numentries} + 1")
+    endif()
+endforeach()
+
+string(APPEND offsets ", ${numentries}")
+
+file(WRITE ${OUTPUT}.tmp
+"// This file was generated by cmake/ReaktoroWaterInterpolationData.cmake. Do not edit it.
+
+#include <Reaktoro/Water/WaterInterpolationData.hpp>
+
+namespace Reaktoro {
+
+static_assert(${numrows} == waterInterpDataNumPressures, \"The number of pressure rows in the water interpolation data is not the expected one.\");
+
+extern const double waterInterpDataTable[] =
+{
+${values}};
+
+extern const Index waterInterpDataOffsets[] = { ${offsets} };
+
+} // namespace Reaktoro
+")
+
+# Only touch the output file if its contents changed, to avoid needless recompilation
+configure_file(${OUTPUT}.tmp ${OUTPUT} COPYONLY)
+file(REMOVE ${OUTPUT}.tmp)
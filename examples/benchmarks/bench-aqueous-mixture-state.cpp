@@ -0,0 +1,171 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+//--------------------------------------------------------------------------------------------------
+// Compile Reaktoro in Release mode and execute the command below:
+//
+// examples/benchmarks/bench-aqueous-mixture-state [number of evaluations]
+//
+// The state of an aqueous mixture (water density and dielectric constant, molalities, stoichiometric
+// molalities and ionic strengths) is evaluated many times, first with the method that returns a new
+// AqueousMixtureState object, and then with the method that updates an existing one. The number of
+// heap memory allocations per evaluation is counted by replacing the global operator new. Finally,
+// the number of heap memory allocations per iteration of equilibrium calculations with a Pitzer
+// aqueous phase is reported.
+//--------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+
+#include <Reaktoro/Reaktoro.hpp>
+#include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
+#include <Reaktoro/Water.hpp>
+using namespace Reaktoro;
+
+/// The number of heap memory allocations performed by the program so far.
+std::atomic<std::size_t> numallocations = 0;
+
+auto operator new(std::size_t size) -> void*
+{
+    ++numallocations;
+    if(void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+auto operator delete(void* ptr) noexcept -> void
+{
+    std::free(ptr);
+}
+
+auto operator delete(void* ptr, std::size_t) noexcept -> void
+{
+    std::free(ptr);
+}
+
+int main(int argc, char const *argv[])
+{
+    const auto numevaluations = argc > 1 ? std::stoi(argv[1]) : 100000;
+
+    SupcrtDatabase db("supcrtbl");
+
+    const auto species = db.species().withAggregateState(AggregateState::Aqueous);
+
+    // The water density and dielectric constant are computed with the Wagner-Pruss and Johnson-Norton models (instead of the default constant values)
+    const auto mixture = AqueousMixture(species)
+        .withWaterDensityFn([](real T, real P) { return waterLiquidDensityWagnerPruss(T, P); })
+        .withWaterDielectricConstantFn([](real T, real P) { return waterElectroPropsJohnsonNorton(T, P, waterThermoPropsWagnerPruss(T, P, StateOfMatter::Liquid)).epsilon; });
+
+    const auto N = species.size();
+
+    std::cout << "Aqueous species: " << N << std::endl;
+
+    const real T = 333.15;
+    const real P = 100.0e5;
+
+    // The mole fractions are all different so that the same state is never evaluated twice
+    ArrayXr x = ArrayXr::Constant(N, 1.0e-4);
+    x[mixture.indexWater()] = 0.9;
+    auto perturb = [&](auto i) { x[i % N] *= 1.0 + 1e-6; };
+
+    auto begin = std::chrono::steady_clock::now();
+    auto allocations = numallocations.load();
+
+    double checksum1 = 0.0;
+    for(auto i = 0; i < numevaluations; ++i)
+    {
+        perturb(i);
+        const auto state = mixture.state(T, P, x);
+        checksum1 += state.Is.val();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    const auto allocations1 = numallocations.load() - allocations;
+    const auto elapsed1 = std::chrono::duration<double>(end - begin).count();
+
+    begin = std::chrono::steady_clock::now();
+    allocations = numallocations.load();
+
+    AqueousMixtureState state;
+
+    double checksum2 = 0.0;
+    for(auto i = 0; i < numevaluations; ++i)
+    {
+        perturb(i);
+        mixture.state(T, P, x, state);
+        checksum2 += state.Is.val();
+    }
+
+    end = std::chrono::steady_clock::now();
+
+    const auto allocations2 = numallocations.load() - allocations;
+    const auto elapsed2 = std::chrono::duration<double>(end - begin).count();
+
+    std::cout << "New AqueousMixtureState,     time per evaluation: " << std::setw(10) << 1e6 * elapsed1 / numevaluations << " us, allocations per evaluation: " << std::setw(8) << double(allocations1) / numevaluations << ", checksum: " << checksum1 << std::endl;
+    std::cout << "Updated AqueousMixtureState, time per evaluation: " << std::setw(10) << 1e6 * elapsed2 / numevaluations << " us, allocations per evaluation: " << std::setw(8) << double(allocations2) / numevaluations << ", checksum: " << checksum2 << std::endl;
+    std::cout << "Speedup: " << elapsed1 / elapsed2 << std::endl;
+
+    AqueousPhase solution(speciate("H O C Na Cl Ca Mg S"), exclude("organic"));
+    solution.setActivityModel(ActivityModelPitzer());
+
+    GaseousPhase gases("CO2(g) H2O(g)");
+
+    MineralPhases minerals("Calcite Dolomite Gypsum Halite");
+
+    ChemicalSystem system(db, solution, gases, minerals);
+
+    ChemicalState state0(system);
+    state0.temperature(60.0, "celsius");
+    state0.pressure(100.0, "bar");
+    state0.set("H2O(aq)",   1.0, "kg");
+    state0.set("Na+",       1.0, "mol");
+    state0.set("Cl-",       1.0, "mol");
+    state0.set("CO2(g)",    5.0, "mol");
+    state0.set("Calcite",   1.0, "mol");
+    state0.set("Dolomite",  1.0, "mol");
+    state0.set("Gypsum",    1.0, "mol");
+
+    EquilibriumSolver solver(system);
+
+    // Solve once so that the thread-local workspaces of the activity models are created before counting
+    ChemicalState warmup = state0;
+    solver.solve(warmup);
+
+    const auto numcalculations = 10;
+
+    Index iterations = 0;
+    allocations = numallocations.load();
+
+    for(auto i = 0; i < numcalculations; ++i)
+    {
+        ChemicalState state = state0;
+        const auto result = solver.solve(state);
+        errorif(result.failed(), "Equilibrium calculation failed.");
+        iterations += result.iterations();
+    }
+
+    const auto allocations3 = numallocations.load() - allocations;
+
+    std::cout << "Equilibrium with Pitzer aqueous phase, iterations: " << iterations << ", allocations per iteration: " << double(allocations3) / iterations << std::endl;
+
+    return 0;
+}
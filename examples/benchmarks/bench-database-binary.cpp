@@ -0,0 +1,90 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+//--------------------------------------------------------------------------------------------------
+// Compile Reaktoro in Release mode and execute the command below:
+//
+// examples/benchmarks/bench-database-binary [embedded database file name] [number of loads]
+//
+// An embedded database (by default, supcrtbl.yaml) is loaded several times, first from its YAML
+// (or JSON) text, and then from the binary database file produced by Database::saveBinary (the
+// same format produced by the reaktoro-database-converter utility). The times spent parsing the
+// text into a Data object and reading the binary file into a Data object are reported, as well as
+// the times until a Database object is built with all its Species objects. For the lazy database
+// returned by Database::fromBinaryFile, this includes creating the species of an aqueous phase
+// with the elements H, O, C, Na and Cl (as done when constructing a ChemicalSystem object), and
+// then creating all the remaining species.
+//--------------------------------------------------------------------------------------------------
+
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+
+#include <Reaktoro/Reaktoro.hpp>
+#include <Reaktoro/Core/Embedded.hpp>
+#include <Reaktoro/Core/Support/DatabaseParser.hpp>
+using namespace Reaktoro;
+
+/// Return the average time (in seconds) of a number of executions of a function.
+template<typename Function>
+auto averageTime(int numloads, Function const& f)
+{
+    const auto begin = std::chrono::steady_clock::now();
+    for(auto i = 0; i < numloads; ++i)
+        f();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - begin).count() / numloads;
+}
+
+int main(int argc, char const *argv[])
+{
+    const String name = argc > 1 ? argv[1] : "supcrtbl.yaml";
+    const auto numloads = argc > 2 ? std::stoi(argv[2]) : 5;
+
+    const auto text = Embedded::get("databases/reaktoro/" + name);
+    const auto isjson = endswith(name, ".json");
+
+    auto parse = [&]() { return isjson ? Data::parseJson(text) : Data::parseYaml(text); };
+
+    const auto path = (std::filesystem::temp_directory_path() / "bench-database-binary.rkdb").string();
+
+    Database(DatabaseParser(parse())).saveBinary(path);
+
+    Database db;
+
+    const auto tparse = averageTime(numloads, [&]() { parse(); });
+    const auto tbinary = averageTime(numloads, [&]() { Data::loadBinary(path); });
+    const auto tdbtext = averageTime(numloads, [&]() { db = DatabaseParser(parse()); });
+    const auto tdbbinary = averageTime(numloads, [&]() { db = Database::fromFile(path); });
+    const auto tdblazy = averageTime(numloads, [&]() { db = Database::fromBinaryFile(path); });
+    const auto tdblazyaq = averageTime(numloads, [&]() { db = Database::fromBinaryFile(path); db.speciesWithAggregateStateAndElements(AggregateState::Aqueous, "H O C Na Cl"); });
+    const auto tdblazyall = averageTime(numloads, [&]() { db = Database::fromBinaryFile(path); db.species(); });
+
+    std::cout << "Database " << name << " with " << db.species().size() << " species" << std::endl;
+    std::cout << "Text to Data:                      " << std::setw(10) << 1e3 * tparse << " ms" << std::endl;
+    std::cout << "Binary to Data:                    " << std::setw(10) << 1e3 * tbinary << " ms (speedup: " << tparse / tbinary << ")" << std::endl;
+    std::cout << "Text to Database:                  " << std::setw(10) << 1e3 * tdbtext << " ms" << std::endl;
+    std::cout << "Binary to Database:                " << std::setw(10) << 1e3 * tdbbinary << " ms (speedup: " << tdbtext / tdbbinary << ")" << std::endl;
+    std::cout << "Binary to lazy Database:           " << std::setw(10) << 1e3 * tdblazy << " ms (speedup: " << tdbtext / tdblazy << ")" << std::endl;
+    std::cout << "  + aqueous species of H O C Na Cl:" << std::setw(10) << 1e3 * tdblazyaq << " ms (speedup: " << tdbtext / tdblazyaq << ")" << std::endl;
+    std::cout << "  + all species:                   " << std::setw(10) << 1e3 * tdblazyall << " ms (speedup: " << tdbtext / tdblazyall << ")" << std::endl;
+
+    std::filesystem::remove(path);
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+//--------------------------------------------------------------------------------------------------
+// Compile Reaktoro in Release mode and execute the command below:
+//
+// examples/benchmarks/bench-equilibrium-hessian-seed-group-size [number of calculations]
+//
+// The chemical system below has an aqueous phase, a gaseous phase and several pure mineral phases.
+// The Hessian of the Gibbs energy function is computed exactly, so that the cost of its columns
+// dominates the equilibrium calculations. These columns are computed by seeding one species amount
+// at a time (group size of one) and by seeding together species amounts in independent phases.
+//--------------------------------------------------------------------------------------------------
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+int main(int argc, char const *argv[])
+{
+    const auto numcalculations = argc > 1 ? std::stoi(argv[1]) : 100;
+
+    SupcrtDatabase db("supcrtbl");
+
+    AqueousPhase solution(speciate("H O C Na Cl Ca Mg S Si"), exclude("organic"));
+    solution.setActivityModel(ActivityModelPitzer());
+
+    GaseousPhase gases("CO2(g) H2O(g) CH4(g)");
+    gases.setActivityModel(ActivityModelPengRobinson());
+
+    MineralPhases minerals("Calcite Dolomite Magnesite Gypsum Anhydrite Halite Quartz");
+
+    ChemicalSystem system(db, solution, gases, minerals);
+
+    ChemicalState state0(system);
+    state0.temperature(60.0, "celsius");
+    state0.pressure(100.0, "bar");
+    state0.set("H2O(aq)",   1.0, "kg");
+    state0.set("Na+",       1.0, "mol");
+    state0.set("Cl-",       1.0, "mol");
+    state0.set("CO2(g)",    5.0, "mol");
+    state0.set("Calcite",   1.0, "mol");
+    state0.set("Dolomite",  1.0, "mol");
+    state0.set("Gypsum",    1.0, "mol");
+    state0.set("Quartz",    1.0, "mol");
+
+    std::cout << "Species: " << system.species().size() << ", phases: " << system.phases().size() << std::endl;
+
+    for(auto groupsize : { 1, 2, 4, 8, 16 })
+    {
+        EquilibriumOptions options;
+        options.hessian = GibbsHessian::Exact;
+        options.hessian_seed_group_size = groupsize;
+
+        EquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        Index iterations = 0;
+
+        const auto begin = std::chrono::steady_clock::now();
+
+        for(auto i = 0; i < numcalculations; ++i)
+        {
+            ChemicalState state = state0;
+            const auto result = solver.solve(state);
+            errorif(result.failed(), "Equilibrium calculation failed with seed group size ", groupsize, ".");
+            iterations += result.iterations();
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+
+        const auto elapsed = std::chrono::duration<double>(end - begin).count();
+
+        std::cout << "Seed group size: " << std::setw(2) << groupsize
+                  << ", time per calculation: " << std::setw(10) << 1e3 * elapsed / numcalculations << " ms"
+                  << ", iterations: " << iterations << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+//--------------------------------------------------------------------------------------------------
+// Compile Reaktoro in Release mode and execute the command below:
+//
+// examples/benchmarks/bench-equilibrium-solver-allocations [number of calculations]
+//
+// Consecutive equilibrium calculations with the same specifications are performed starting from
+// the same equilibrium state. The number of heap memory allocations in each calculation is counted
+// by replacing the global operator new (which is why this is an executable of its own and not a
+// test in reaktoro-cpptests). After two warm-up calculations, in which the optimization problem of
+// the solver is prepared and its buffers are sized, every calculation must allocate exactly the
+// same number of times; the program fails otherwise. This number is not zero: the operations
+// performed by Reaktoro in a calculation do not allocate (as checked in the test executable
+// reaktoro-cppalloctests), and the remaining allocations happen in the Optima solver itself,
+// whose iterations create temporary vectors and index sets.
+//--------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+/// The number of heap memory allocations performed by the program so far.
+std::atomic<std::size_t> numallocations = 0;
+
+auto operator new(std::size_t size) -> void*
+{
+    ++numallocations;
+    if(void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+auto operator delete(void* ptr) noexcept -> void
+{
+    std::free(ptr);
+}
+
+auto operator delete(void* ptr, std::size_t) noexcept -> void
+{
+    std::free(ptr);
+}
+
+int main(int argc, char const *argv[])
+{
+    const auto numcalculations = argc > 1 ? std::stoi(argv[1]) : 100;
+
+    SupcrtDatabase db("supcrtbl");
+
+    AqueousPhase solution(speciate("H O C Na Cl"), exclude("organic"));
+    solution.setActivityModel(ActivityModelDavies());
+
+    GaseousPhase gases("CO2(g) H2O(g)");
+
+    ChemicalSystem system(db, solution, gases);
+
+    ChemicalState state(system);
+    state.temperature(60.0, "celsius");
+    state.pressure(100.0, "bar");
+    state.set("H2O(aq)", 55.0, "mol");
+    state.set("Na+",     0.01, "mol");
+    state.set("Cl-",     0.01, "mol");
+    state.set("CO2(aq)", 10.0, "mol");
+
+    EquilibriumConditions conditions(system);
+    conditions.temperature(60.0, "celsius");
+    conditions.pressure(100.0, "bar");
+
+    EquilibriumSolver solver(system);
+
+    // Warm up the solver so that the optimization problem is prepared and all internal buffers are sized
+    for(auto i = 0; i < 2; ++i)
+        errorif(solver.solve(state, conditions).failed(), "Equilibrium calculation failed.");
+
+    Vec<std::size_t> allocations(numcalculations);
+
+    for(auto i = 0; i < numcalculations; ++i)
+    {
+        const auto before = numallocations.load();
+        const auto result = solver.solve(state, conditions);
+        allocations[i] = numallocations.load() - before;
+        errorif(result.failed(), "Equilibrium calculation failed.");
+    }
+
+    std::cout << "Equilibrium calculations: " << numcalculations << ", allocations per calculation: " << allocations[0] << std::endl;
+
+    for(auto i = 1; i < numcalculations; ++i)
+        errorif(allocations[i] != allocations[0], "Equilibrium calculation ", i, " allocated ", allocations[i], " times instead of ", allocations[0], " times like the first one after warm-up.");
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+//--------------------------------------------------------------------------------------------------
+// Compile Reaktoro in Release mode and execute the command below:
+//
+// examples/benchmarks/bench-standard-thermo-model-batch [number of evaluations]
+//
+// The standard thermodynamic properties of all species in a SUPCRTBL database (aqueous species
+// with the HKF model, minerals with the Holland-Powell model and gases with the Maier-Kelley model)
+// are evaluated at many different temperatures, first one species at a time, and then using the
+// StandardThermoModelBatch class, which groups the species by model family and evaluates them in
+// single loops over structures of arrays.
+//--------------------------------------------------------------------------------------------------
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+int main(int argc, char const *argv[])
+{
+    const auto numevaluations = argc > 1 ? std::stoi(argv[1]) : 1000;
+
+    SupcrtDatabase db("supcrtbl");
+
+    const auto species = db.species();
+    const auto N = species.size();
+
+    StandardThermoModelBatch batch(species);
+
+    std::cout << "Species: " << N
+              << ", evaluated in batches: " << batch.indicesSpeciesInBatches().size()
+              << ", evaluated one at a time: " << batch.indicesSpeciesNotInBatches().size() << std::endl;
+
+    ArrayXr G0(N), H0(N), V0(N), VT0(N), VP0(N), Cp0(N);
+
+    const auto P = 100.0e5;
+
+    // The temperatures are all different so that memoization of previous evaluations is not used
+    auto temperature = [&](auto i) { return 298.15 + 200.0 * i / numevaluations; };
+
+    auto begin = std::chrono::steady_clock::now();
+
+    double checksum1 = 0.0;
+    for(auto i = 0; i < numevaluations; ++i)
+    {
+        const auto T = temperature(i);
+        for(auto j = 0; j < N; ++j)
+            G0[j] = species[j].standardThermoProps(T, P).G0;
+        checksum1 += G0.sum().val();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    const auto elapsed1 = std::chrono::duration<double>(end - begin).count();
+
+    begin = std::chrono::steady_clock::now();
+
+    double checksum2 = 0.0;
+    for(auto i = 0; i < numevaluations; ++i)
+    {
+        const auto T = temperature(i);
+        batch.eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+        checksum2 += G0.sum().val();
+    }
+
+    end = std::chrono::steady_clock::now();
+
+    const auto elapsed2 = std::chrono::duration<double>(end - begin).count();
+
+    std::cout << "One species at a time, time per evaluation: " << std::setw(10) << 1e6 * elapsed1 / numevaluations << " us, checksum: " << checksum1 << std::endl;
+    std::cout << "Species in batches,    time per evaluation: " << std::setw(10) << 1e6 * elapsed2 / numevaluations << " us, checksum: " << checksum2 << std::endl;
+    std::cout << "Speedup: " << elapsed1 / elapsed2 << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+//--------------------------------------------------------------------------------------------------
+// Convert a database file in YAML or JSON format into a binary database file, which can be loaded
+// much faster with Database::fromBinaryFile (or Database::fromFile with extension .rkdb). The file is
+// written with Database::saveBinary, so it is the same as one saved from a Database object:
+//
+// reaktoro-database-converter <input.yaml|input.json> <output.rkdb>
+// reaktoro-database-converter --embedded <name.yaml|name.json> <output.rkdb>
+//
+// The second form converts one of the databases embedded in Reaktoro (e.g., supcrtbl.json).
+//--------------------------------------------------------------------------------------------------
+
+// C++ includes
+#include <iostream>
+
+// Reaktoro includes
+#include <Reaktoro/Common/StringUtils.hpp>
+#include <Reaktoro/Core/Data.hpp>
+#include <Reaktoro/Core/Database.hpp>
+#include <Reaktoro/Core/Embedded.hpp>
+#include <Reaktoro/Core/Support/DatabaseParser.hpp>
+using namespace Reaktoro;
+
+/// Return the contents of a YAML or JSON database file as a Data object.
+auto loadDatabaseDocument(String const& path, bool embedded) -> Data
+{
+    if(!embedded)
+        return Data::load(path);
+    const auto text = Embedded::get("databases/reaktoro/" + path);
+    return endswith(path, ".json") ? Data::parseJson(text) : Data::parseYaml(text);
+}
+
+int main(int argc, char const* argv[])
+{
+    const auto embedded = argc == 4 && String(argv[1]) == "--embedded";
+
+    if(argc != 3 && !embedded)
+    {
+        std::cerr << "Usage: " << argv[0] << " <input.yaml|input.json> <output.rkdb>" << std::endl;
+        std::cerr << "       " << argv[0] << " --embedded <name.yaml|name.json> <output.rkdb>" << std::endl;
+        return 1;
+    }
+
+    const String input = argv[argc - 2];
+    const String output = argv[argc - 1];
+
+    try
+    {
+        const auto doc = loadDatabaseDocument(input, embedded);
+
+        // Construct the database first, which also ensures the database document is valid
+        const Database db = DatabaseParser(doc);
+
+        db.saveBinary(output);
+
+        std::cout << "Converted " << (embedded ? "embedded database " : "database ") << input << " with "
+                  << db.elements().size() << " elements and " << db.species().size() << " species into " << output << std::endl;
+    }
+    catch(std::exception const& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}